@@ -69,15 +69,14 @@ WHILE NOT WindowShouldClose ' Detect window close button or ESC key
 
     ClearBackground RAYWHITE
 
-    FOR i = 0 TO bunniesCount - 1
-        ' NOTE: When internal batch buffer limit is reached (MAX_BATCH_ELEMENTS),
-        ' a draw call is launched and buffer starts being filled again;
-        ' before issuing a draw call, updated vertex data from internal CPU buffer is send to GPU...
-        ' Process of sending data is costly and it could happen that GPU data has not been completely
-        ' processed for drawing while new data is tried to be sent (updating current in-use buffers)
-        ' it could generates a stall and consequently a frame drop, limiting the number of drawn bunnies
-        DrawTexture texBunny, bunnies(i).position.x, bunnies(i).position.y, bunnies(i).clr
-    NEXT
+    ' NOTE: When internal batch buffer limit is reached (MAX_BATCH_ELEMENTS),
+    ' a draw call is launched and buffer starts being filled again;
+    ' before issuing a draw call, updated vertex data from internal CPU buffer is send to GPU...
+    ' Process of sending data is costly and it could happen that GPU data has not been completely
+    ' processed for drawing while new data is tried to be sent (updating current in-use buffers)
+    ' it could generates a stall and consequently a frame drop, limiting the number of drawn bunnies
+    ' All bunnies are submitted with a single call instead of calling DrawTexture for each bunny
+    IF bunniesCount > 0 THEN DrawTextureBatch texBunny, _OFFSET(bunnies(0).position), NULL, _OFFSET(bunnies(0).clr), LEN(bunnies(0)), bunniesCount
 
     DrawRectangle 0, 0, screenWidth, 40, BLACK
     DrawText TextFormatLong("bunnies: %i", bunniesCount), 120, 10, 20, RGREEN
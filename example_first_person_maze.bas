@@ -26,12 +26,13 @@ DIM AS Material matrl: PeekType mdl.materials, 0, _OFFSET(matrl), LEN(matrl)
 DIM AS MaterialMap matrlmap: PeekType matrl.maps, MATERIAL_MAP_DIFFUSE, _OFFSET(matrlmap), LEN(matrlmap)
 matrlmap.texture = tex: PokeType matrl.maps, MATERIAL_MAP_DIFFUSE, _OFFSET(matrlmap), LEN(matrlmap) ' Set map diffuse texture
 
-' Get map image data to be used for collision detection
-DIM AS _UNSIGNED _OFFSET mapPixels: mapPixels = LoadImageColors(imMap)
-UnloadImage imMap ' Unload image from RAM
-
 DIM AS Vector3 mapPosition: mapPosition.x = -16.0!: mapPosition.y = 0.0!: mapPosition.z = -8.0! ' Set model position
 
+' Build a collision grid from the map image: white pixels are walls (only check R channel), each cell is centered on its cube
+DIM AS Vector2 mapOrigin: mapOrigin.x = mapPosition.x - 0.5!: mapOrigin.y = mapPosition.z - 0.5!
+DIM AS _UNSIGNED _OFFSET mapGrid: mapGrid = LoadCollisionGrid(imMap, 0, 255, mapOrigin, 1.0!)
+UnloadImage imMap ' Unload image from RAM
+
 DisableCursor ' Limit cursor to relative movement inside the window
 
 SetTargetFPS 60 ' Set our game to run at 60 frames-per-second
@@ -61,21 +62,11 @@ DO UNTIL WindowShouldClose
         playerCellY = cubicmap.Rheight - 1
     END IF
 
-    ' Check map collisions using image data and player position
-    ' TODO: Improvement: Just check player surrounding cells for collision
-    DIM AS LONG x, y
-    DIM r AS Rectangle
-    FOR y = 0 TO cubicmap.Rheight - 1
-        FOR x = 0 TO cubicmap.Rwidth - 1
-            IF GetRed(PeekLong(mapPixels, y * cubicmap.Rwidth + x)) = 255 THEN ' Collision: white pixel, only check R channel
-                r.x = mapPosition.x - 0.5! + x * 1.0!: r.y = mapPosition.z - 0.5! + y * 1.0!: r.Rwidth = 1.0!: r.Rheight = 1.0!
-                IF CheckCollisionCircleRec(playerPos, playerRadius, r) THEN
-                    ' Collision detected, reset camera position
-                    camera.position = oldCamPos
-                END IF
-            END IF
-        NEXT
-    NEXT
+    ' Check map collisions using the collision grid and player position (only the cells around the player are tested)
+    IF CheckCollisionGridCircle(mapGrid, playerPos, playerRadius) THEN
+        ' Collision detected, reset camera position
+        camera.position = oldCamPos
+    END IF
 
     BeginDrawing
 
@@ -98,7 +89,7 @@ DO UNTIL WindowShouldClose
 LOOP
 
 ' De-Initialization
-UnloadImageColors mapPixels ' Unload color array
+UnloadCollisionGrid mapGrid ' Unload collision grid
 UnloadTexture cubicmap ' Unload cubicmap texture
 UnloadTexture tex ' Unload map texture
 UnloadModel mdl ' Unload map model
@@ -42,7 +42,18 @@ DIM AS Model mdl: LoadModel "assets/model/gltf/robot.glb", mdl ' Load model
 DIM AS _UNSIGNED LONG animsCount: animsCount = 0
 DIM AS _UNSIGNED LONG animIndex: animIndex = 0
 DIM AS _UNSIGNED LONG animCurrentFrame: animCurrentFrame = 0
+DIM AS _UNSIGNED LONG animPrevIndex: animPrevIndex = 0
+DIM AS _UNSIGNED LONG animPrevFrame: animPrevFrame = 0
+DIM AS SINGLE animBlend: animBlend = 1.0! ' Crossfade weight towards the current animation
 DIM AS _OFFSET mdlAnim: mdlAnim = LoadModelAnimations("assets/model/gltf/robot.glb", animsCount)
+'    // Cache the bone transforms of every animation frame
+DIM AS ModelAnimation anim, prevAnim
+REDIM animCache(0 TO animsCount - 1) AS _UNSIGNED _OFFSET
+DIM AS _UNSIGNED LONG i
+FOR i = 0 TO animsCount - 1
+    PeekType mdlAnim, i, _OFFSET(anim), LEN(anim)
+    animCache(i) = LoadAnimationCache(mdl, anim)
+NEXT i
 '    // Set model position
 DIM AS Vector3 position: position.x = 0: position.y = 0: position.z = 0
 '    // Limit cursor to relative movement inside the window
@@ -59,18 +70,28 @@ WHILE NOT WindowShouldClose
     '    //----------------------------------------------------------------------------------
     UpdateCamera camera, CAMERA_THIRD_PERSON
     '    // Select current animation
-    IF IsKeyPressed(KEY_ONE) THEN
-        animIndex = (animIndex + 1) MOD animsCount
-    ELSE
-        IF IsKeyPressed(KEY_TWO) THEN
+    IF IsKeyPressed(KEY_ONE) OR IsKeyPressed(KEY_TWO) THEN
+        '    // Crossfade from the pose the model is showing now
+        animPrevIndex = animIndex: animPrevFrame = animCurrentFrame: animBlend = 0.0!
+        IF IsKeyPressed(KEY_ONE) THEN
+            animIndex = (animIndex + 1) MOD animsCount
+        ELSE
             animIndex = (animIndex + animsCount - 1) MOD animsCount
         END IF
+        animCurrentFrame = 0
     END IF
 
     '    // Update model animation
-    DIM AS ModelAnimation anim: PeekType mdlAnim, animIndex, _OFFSET(anim), LEN(anim)
+    PeekType mdlAnim, animIndex, _OFFSET(anim), LEN(anim)
     animCurrentFrame = (animCurrentFrame + 1) MOD anim.frameCount
-    UpdateModelAnimation mdl, anim, animCurrentFrame
+    IF animBlend < 1.0! THEN
+        PeekType mdlAnim, animPrevIndex, _OFFSET(prevAnim), LEN(prevAnim)
+        animPrevFrame = (animPrevFrame + 1) MOD prevAnim.frameCount
+        animBlend = animBlend + 0.1!
+        UpdateModelAnimationBlend mdl, prevAnim, animPrevFrame, anim, animCurrentFrame, animBlend
+    ELSE
+        UpdateModelAnimationCached mdl, animCache(animIndex), animCurrentFrame
+    END IF
     '    //----------------------------------------------------------------------------------
 
     '    // Draw
@@ -95,6 +116,10 @@ WHILE NOT WindowShouldClose
 WEND
 '    // De-Initialization
 '    //--------------------------------------------------------------------------------------
+'    // Unload animation caches
+FOR i = 0 TO animsCount - 1
+    UnloadAnimationCache animCache(i)
+NEXT i
 '    // Unload model and meshes/material
 UnloadModel mdl
 '    // Close window and OpenGL context
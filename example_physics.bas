@@ -99,28 +99,27 @@ WHILE NOT WindowShouldClose ' Detect window close button or ESC key
 
     DrawFPS screenWidth - 90, screenHeight - 30
 
-    ' Draw created physics bodies
-    bodiesCount = GetPhysicsBodiesCount
-    FOR i = 0 TO bodiesCount - 1
-
-        bodyPtr = GetPhysicsBody(i)
+    ' Draw created physics bodies, interpolated between the two last physics steps
+    ' Note: the snapshot is the latest state published by the physics thread, so it can be read while the next step runs
+    bodiesCount = UpdatePhysicsSnapshot
+    DIM AS SINGLE alpha: alpha = GetPhysicsSnapshotAlpha
+    DIM state AS PhysicsBodyState
 
-        IF bodyPtr <> NULL THEN
-            DIM AS LONG vertexCount: vertexCount = GetPhysicsShapeVerticesCount(i)
+    FOR i = 0 TO bodiesCount - 1
+        GetPhysicsSnapshotBody i, alpha, state
 
-            DIM j AS LONG: FOR j = 0 TO vertexCount - 1
+        DIM j AS LONG: FOR j = 0 TO state.vertexCount - 1
 
-                ' Get physics bodies shape vertices to draw lines
-                ' Note: GetPhysicsShapeVertex() already calculates rotation transformations
-                DIM AS Vector2 vertexA: GetPhysicsShapeVertex bodyPtr, j, vertexA
+            ' Get physics bodies shape vertices to draw lines
+            ' Note: GetPhysicsSnapshotVertex() already calculates rotation transformations
+            DIM AS Vector2 vertexA: GetPhysicsSnapshotVertex i, j, alpha, vertexA
 
-                DIM AS LONG jj
-                IF j + 1 < vertexCount THEN jj = j + 1 ELSE jj = 0 ' Get next vertex or first to close the shape
-                DIM AS Vector2 vertexB: GetPhysicsShapeVertex bodyPtr, jj, vertexB
+            DIM AS LONG jj
+            IF j + 1 < state.vertexCount THEN jj = j + 1 ELSE jj = 0 ' Get next vertex or first to close the shape
+            DIM AS Vector2 vertexB: GetPhysicsSnapshotVertex i, jj, alpha, vertexB
 
-                DrawLineV vertexA, vertexB, RGREEN ' Draw a line between two vertex positions
-            NEXT
-        END IF
+            DrawLineV vertexA, vertexB, RGREEN ' Draw a line between two vertex positions
+        NEXT
     NEXT
 
     DrawText "Left mouse button to create a polygon", 10, 10, 10, WHITE
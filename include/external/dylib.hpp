@@ -41,6 +41,9 @@
 #endif
 #else
 #include <dlfcn.h>
+#ifndef DYLIB_OPEN_FLAGS
+#define DYLIB_OPEN_FLAGS (RTLD_NOW | RTLD_LOCAL)
+#endif
 #endif
 
 #if (defined(_WIN32) || defined(_WIN64))
@@ -300,7 +303,7 @@ protected:
 #if (defined(_WIN32) || defined(_WIN64))
         return LoadLibraryA(path);
 #else
-        return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        return dlopen(path, DYLIB_OPEN_FLAGS);
 #endif
     }
 
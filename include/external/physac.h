@@ -38,6 +38,11 @@
  *       You can define your own malloc/free implementation replacing stdlib.h malloc()/free() functions.
  *       Otherwise it will include stdlib.h and use the C standard library malloc()/free() function.
  *
+ *   #define PHYSAC_PARALLEL_FOR(count, grain, fn)
+ *       You can define your own parallel loop that calls fn(begin, end) over [0, count) from several threads.
+ *       Physics steps then solve independent islands of bodies in contact at the same time, with the same results.
+ *       Otherwise every island is solved on the physics thread.
+ *
  *
  *   NOTE 1: Physac requires multi-threading, when InitPhysics() a second thread is created to manage physics calculations.
  *   NOTE 2: Physac requires static C library linkage to avoid dependency on MinGW DLL (-static -lpthread)
@@ -98,14 +103,21 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define PHYSAC_MAX_BODIES 64
-#define PHYSAC_MAX_MANIFOLDS 4096
+#define PHYSAC_BODY_POOL_BLOCK 64 // Bodies allocated at once every time the bodies pool grows
 #define PHYSAC_MAX_VERTICES 24
 #define PHYSAC_CIRCLE_VERTICES 24
 
 #define PHYSAC_COLLISION_ITERATIONS 100
 #define PHYSAC_PENETRATION_ALLOWANCE 0.05f
 #define PHYSAC_PENETRATION_CORRECTION 0.4f
+#define PHYSAC_BROADPHASE_MARGIN 0.1f // Extra room around body AABBs so the broadphase never misses a touching pair
+
+// Time before a step deadline, in milliseconds, that the physics thread spins instead of sleeping
+#if defined(_WIN32)
+#define PHYSAC_SPIN_TIME 1.0 // Windows sleeps have 1 ms granularity at best
+#else
+#define PHYSAC_SPIN_TIME 0.25
+#endif
 
 #define PHYSAC_PI 3.14159265358979323846
 #define PHYSAC_DEG2RAD (PHYSAC_PI / 180.0f)
@@ -113,6 +125,12 @@
 #define PHYSAC_MALLOC(size) malloc(size)
 #define PHYSAC_FREE(ptr) free(ptr)
 
+// Runs fn(begin, end) over [0, count) in chunks of grain indices, define it before including physac to spread contact islands over a worker pool
+#if !defined(PHYSAC_PARALLEL_FOR)
+#define PHYSAC_PARALLEL_FOR(count, grain, fn) fn(0, count)
+#endif
+#define PHYSAC_PARALLEL_CONTACTS 64 // Manifolds below which contact islands are solved on the physics thread alone
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 // NOTE: Below types are required for PHYSAC_STANDALONE usage
@@ -142,6 +160,12 @@ typedef enum PhysicsShapeType
     PHYSICS_POLYGON
 } PhysicsShapeType;
 
+typedef enum PhysicsStepMode
+{
+    PHYSICS_STEP_CATCH_UP, // Run every missed step when falling behind real time (default)
+    PHYSICS_STEP_DROP      // Run a single step and drop the missed ones when falling behind real time
+} PhysicsStepMode;
+
 // Previously defined to be used in PhysicsShape struct as circular dependencies
 typedef struct PhysicsBodyData *PhysicsBody;
 
@@ -207,6 +231,24 @@ typedef struct PhysicsManifoldData
     float staticFriction;       // Mixed static friction during collision
 } PhysicsManifoldData, *PhysicsManifold;
 
+typedef struct PhysicsStats
+{
+    unsigned int steps;        // Physics steps run since the last stats reset
+    unsigned int droppedSteps; // Physics steps dropped to keep up with real time (PHYSICS_STEP_DROP mode)
+    float jitterAverage;       // Average delay of steps from their deadline in milliseconds
+    float jitterMax;           // Maximum delay of a step from its deadline in milliseconds
+    float cpuUsage;            // Share of wall time spent running steps or spinning before a deadline (0 to 1)
+} PhysicsStats;
+
+typedef struct PhysicsBodyState
+{
+    PhysicsBody body;         // Physics body reference (only valid while the body is alive)
+    Vector2 position;         // Physics body position, interpolated between the two last steps
+    Vector2 velocity;         // Physics body linear velocity at the last step
+    float orient;             // Physics body rotation in radians, interpolated between the two last steps
+    unsigned int vertexCount; // Physics body shape vertices count
+} PhysicsBodyState;
+
 #if defined(__cplusplus)
 extern "C"
 { // Prevents name mangling of functions
@@ -218,6 +260,13 @@ extern "C"
     PHYSACDEF void InitPhysics(void);                                                                        // Initializes physics values, pointers and creates physics loop thread
     PHYSACDEF void RunPhysicsStep(void);                                                                     // Run physics step, to be used if PHYSICS_NO_THREADS is set in your main loop
     PHYSACDEF void SetPhysicsTimeStep(double delta);                                                         // Sets physics fixed time step in milliseconds. 1.666666 by default
+    PHYSACDEF void SetPhysicsStepMode(int mode);                                                             // Sets how missed physics steps are handled (PHYSICS_STEP_CATCH_UP or PHYSICS_STEP_DROP)
+    PHYSACDEF PhysicsStats GetPhysicsStats(void);                                                            // Returns physics steps timing counters (jitter, dropped steps, CPU usage)
+    PHYSACDEF void ResetPhysicsStats(void);                                                                  // Resets physics steps timing counters
+    PHYSACDEF int UpdatePhysicsSnapshot(void);                                                               // Takes the latest physics state published by the physics thread for reading, returns its bodies count
+    PHYSACDEF float GetPhysicsSnapshotAlpha(void);                                                           // Returns the interpolation factor between the two last steps of the snapshot for the current time
+    PHYSACDEF PhysicsBodyState GetPhysicsSnapshotBody(int index, float alpha);                               // Returns the state of a physics body of the snapshot, interpolated by alpha (1 is the last step)
+    PHYSACDEF Vector2 GetPhysicsSnapshotVertex(int index, int vertex, float alpha);                          // Returns the transformed position of a body shape vertex of the snapshot, interpolated by alpha
     PHYSACDEF bool IsPhysicsEnabled(void);                                                                   // Returns true if physics thread is currently enabled
     PHYSACDEF void SetPhysicsGravity(float x, float y);                                                      // Sets physics global gravity force
     PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float density);                 // Creates a new circle physics body with generic parameters
@@ -260,7 +309,12 @@ extern "C"
 #include <stdlib.h>  // Required for: malloc(), free(), srand(), rand()
 #include <math.h>    // Required for: cosf(), sinf(), fabs(), sqrtf()
 #include <stdint.h>  // Required for: uint64_t
-#include <algorithm> // Required for: min(), max()
+#include <algorithm> // Required for: min(), max(), sort()
+#include <vector>    // Required for: std::vector
+#include <mutex>     // Required for: std::mutex, std::lock_guard
+#include <thread>    // Required for: std::this_thread::sleep_for(), std::this_thread::yield()
+#include <chrono>    // Required for: std::chrono::microseconds
+#include <atomic>    // Required for: std::atomic
 
 #if !defined(PHYSAC_STANDALONE)
 #include "raymath.h" // Required for: Vector2Add(), Vector2Subtract()
@@ -289,6 +343,54 @@ extern "C"
 #define PHYSAC_K 1.0f / 3.0f
 #define PHYSAC_VECTOR_ZERO \
     (Vector2) { 0.0f, 0.0f }
+#define PHYSAC_SNAPSHOT_FRESH 4u
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct PhysicsBroadphaseProxy
+{
+    float minX;         // Body AABB minimum x (sort key of the sweep)
+    float maxX;         // Body AABB maximum x
+    float minY;         // Body AABB minimum y
+    float maxY;         // Body AABB maximum y
+    unsigned int index; // Body index in bodies pointers array
+} PhysicsBroadphaseProxy;
+
+typedef struct PhysicsIsland
+{
+    unsigned int firstContact;  // First manifold index of the island in the island contacts array
+    unsigned int contactsCount; // Island manifolds count
+} PhysicsIsland;
+
+typedef struct PhysicsBodySnapshot
+{
+    PhysicsBody body;          // Physics body reference
+    Vector2 position;          // Position at the last step
+    Vector2 previousPosition;  // Position at the step before
+    Mat2 transform;            // Shape transform at the last step
+    Mat2 previousTransform;    // Shape transform at the step before
+    float orient;              // Rotation at the last step
+    float previousOrient;      // Rotation at the step before
+    Vector2 velocity;          // Linear velocity at the last step
+    unsigned int firstVertex;  // First shape vertex in the snapshot vertices array
+    unsigned int vertexCount;  // Shape vertices count
+} PhysicsBodySnapshot;
+
+typedef struct PhysicsSnapshot
+{
+    double time;                              // Time the last step was due at, in milliseconds
+    std::vector<PhysicsBodySnapshot> bodies;  // Bodies state
+    std::vector<Vector2> vertices;            // Bodies shape vertices in model space (circles are already expanded)
+} PhysicsSnapshot;
+
+typedef struct PhysicsBodyPose
+{
+    Vector2 position;        // Position before the last step of a frame
+    Mat2 transform;          // Shape transform before the last step of a frame
+    float orient;            // Rotation before the last step of a frame
+    unsigned int stepsCount; // Steps count the pose was taken at
+} PhysicsBodyPose;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -305,24 +407,64 @@ static double currentTime = 0.0;                    // Current time in milliseco
 static uint64_t frequency = 0;                      // Hi-res clock frequency
 
 static double accumulator = 0.0;                       // Physics time step delta time accumulator
+static int stepMode = PHYSICS_STEP_CATCH_UP;           // Physics missed steps handling mode
 static unsigned int stepsCount = 0;                    // Total physics steps processed
 static Vector2 gravityForce = {0.0f, 9.81f};           // Physics world gravity force
-static PhysicsBody bodies[PHYSAC_MAX_BODIES];          // Physics bodies pointers array
+static std::vector<PhysicsBody> bodies;                // Physics bodies pointers array
 static unsigned int physicsBodiesCount = 0;            // Physics world current bodies counter
-static PhysicsManifold contacts[PHYSAC_MAX_MANIFOLDS]; // Physics bodies pointers array
+static std::vector<PhysicsManifoldData> contacts;      // Physics step manifolds arena, emptied every step but keeping its memory
 static unsigned int physicsManifoldsCount = 0;         // Physics world current manifolds counter
 
+static std::vector<PhysicsBodyData *> bodyPoolBlocks; // Bodies pool storage, blocks of PHYSAC_BODY_POOL_BLOCK bodies that never move
+static std::vector<unsigned int> bodyPoolFree;        // Free bodies pool slots (body ids), last freed is reused first
+static std::vector<unsigned int> bodyPoolIndices;     // Bodies pointers array index of every bodies pool slot
+static std::mutex physicsMutex;                       // Serializes physics steps with bodies creation and destruction
+
+static std::mutex statsMutex;               // Guards physics stats, read from the game thread
+static unsigned int statsSteps = 0;         // Physics steps run since the last stats reset
+static unsigned int statsDropped = 0;       // Physics steps dropped since the last stats reset
+static unsigned int statsJitterSamples = 0; // Deadlines measured since the last stats reset (one per stepping frame)
+static double statsJitterSum = 0.0;         // Sum of delays from step deadlines in milliseconds
+static double statsJitterMax = 0.0;         // Maximum delay from a step deadline in milliseconds
+static double statsBusyTime = 0.0;          // Time spent running steps or spinning in milliseconds
+static double statsStartTime = 0.0;         // Time of the last stats reset in milliseconds
+
+// Triple buffered snapshots: the physics thread fills the back one and swaps it with the middle one,
+// the game thread swaps its front one with the middle one when a newer snapshot was published
+static PhysicsSnapshot snapshots[3];                   // Physics state snapshots
+static unsigned int snapshotBack = 0;                  // Snapshot being written by the physics thread
+static std::atomic<unsigned int> snapshotMiddle(1);    // Last published snapshot, ORed with PHYSAC_SNAPSHOT_FRESH until taken
+static unsigned int snapshotFront = 2;                 // Snapshot being read by the game thread
+static std::atomic<bool> snapshotsEnabled(false);      // Snapshots are only published once the game thread asked for one
+static std::vector<PhysicsBodyPose> snapshotPoses;     // Bodies pose before the last step of a frame, by body id
+
+static std::vector<PhysicsBroadphaseProxy> broadphaseProxies; // Body AABBs, kept sorted along x between steps
+static std::vector<uint64_t> broadphasePairs;                  // Overlapping body index pairs found by the last sweep (i << 32 | j, i < j)
+
+static std::vector<unsigned int> islandParents;  // Union-find parent of every body index, bodies in contact share a root
+static std::vector<unsigned char> islandMoved;   // Whether contacts write to a body index, static bodies are only read and do not join islands
+static std::vector<unsigned int> islandRoots;    // Island root of every step manifold
+static std::vector<unsigned int> islandOffsets;  // Next free island contacts slot of every island root
+static std::vector<unsigned int> islandContacts; // Step manifolds indices grouped by island, in the serial solving order
+static std::vector<PhysicsIsland> islands;       // Islands found by the last step, largest first
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
-static int FindAvailableBodyIndex();                                                                   // Finds a valid index for a new physics body initialization
+static PhysicsBody AllocatePhysicsBody(void);                                                          // Takes a free slot from the bodies pool for a new physics body
+static void AddPhysicsBody(PhysicsBody body);                                                          // Adds an initialized physics body to the bodies pointers array
 static PolygonData CreateRandomPolygon(float radius, int sides);                                       // Creates a random polygon shape with max vertex distance from polygon pivot
 static PolygonData CreateRectanglePolygon(Vector2 pos, Vector2 size);                                  // Creates a rectangle polygon shape based on a min and max positions
 static void PhysicsLoop(void *arg);                                                                    // Physics loop thread function
 static void PhysicsStep(void);                                                                         // Physics steps calculations (dynamics, collisions and position corrections)
-static int FindAvailableManifoldIndex();                                                               // Finds a valid index for a new manifold initialization
-static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b);                            // Creates a new physics manifold to solve collision
-static void DestroyPhysicsManifold(PhysicsManifold manifold);                                          // Unitializes and destroys a physics manifold
+static void UpdatePhysicsBroadphase(void);                                                             // Sweeps bodies AABBs and collects the pairs that may collide
+static unsigned int FindPhysicsIsland(unsigned int index);                                             // Returns the island root of a body index
+static void BuildPhysicsIslands(void);                                                                 // Groups the step manifolds into islands that share no moving body
+static void SolvePhysicsIsland(const PhysicsIsland *island);                                           // Integrates the collision impulses of an island manifolds
+static void SavePhysicsBodyPoses(void);                                                                // Saves bodies pose before the last step of a frame for snapshot interpolation
+static void PublishPhysicsSnapshot(double time);                                                       // Fills the back snapshot with the current bodies state and publishes it
+static PhysicsManifoldData CreatePhysicsManifold(PhysicsBody a, PhysicsBody b);                        // Creates a new physics manifold to solve collision
+static void AddPhysicsManifold(const PhysicsManifoldData *manifold);                                   // Adds a solved physics manifold to the step manifolds arena
 static void SolvePhysicsManifold(PhysicsManifold manifold);                                            // Solves a created physics manifold between two physics bodies
 static void SolveCircleToCircle(PhysicsManifold manifold);                                             // Solves collision between two circle shape physics bodies
 static void SolveCircleToPolygon(PhysicsManifold manifold);                                            // Solves collision between a circle to a polygon shape physics bodies
@@ -367,17 +509,21 @@ static inline Vector2 Mat2MultiplyVector2(Mat2 matrix, Vector2 vector); // Multi
 // Initializes physics values, pointers and creates physics loop thread
 PHYSACDEF void InitPhysics(void)
 {
+    // Initialize high resolution timer (before the physics thread reads it)
+    InitTimer();
+    ResetPhysicsStats();
+
 #if !defined(PHYSAC_NO_THREADS)
     // NOTE: if defined, user will need to create a thread for PhysicsThread function manually
     // Create physics thread using libqb thread libraries
+    physicsThreadEnabled = true;
     physicsThreadId = libqb_thread_new();
     if (physicsThreadId)
         libqb_thread_start(physicsThreadId, &PhysicsLoop, NULL);
+    else
+        physicsThreadEnabled = false;
 #endif
 
-    // Initialize high resolution timer
-    InitTimer();
-
 #if defined(PHYSAC_DEBUG)
     printf("[PHYSAC] physics module initialized successfully\n");
 #endif
@@ -401,14 +547,10 @@ PHYSACDEF void SetPhysicsGravity(float x, float y)
 // Creates a new circle physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
-
-    int newId = FindAvailableBodyIndex();
-    if (newId != -1)
+    PhysicsBody newBody = AllocatePhysicsBody();
+    if (newBody != NULL)
     {
         // Initialize new body with generic values
-        newBody->id = newId;
         newBody->enabled = true;
         newBody->position = pos;
         newBody->velocity = PHYSAC_VECTOR_ZERO;
@@ -434,8 +576,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float d
         newBody->freezeOrient = false;
 
         // Add new body to bodies pointers array and update bodies count
-        bodies[physicsBodiesCount] = newBody;
-        physicsBodiesCount++;
+        AddPhysicsBody(newBody);
 
 #if defined(PHYSAC_DEBUG)
         printf("[PHYSAC] created polygon physics body id %i\n", newBody->id);
@@ -443,7 +584,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float d
     }
 #if defined(PHYSAC_DEBUG)
     else
-        printf("[PHYSAC] new physics body creation failed because there is any available id to use\n");
+        printf("[PHYSAC] new physics body creation failed because the bodies pool could not grow\n");
 #endif
 
     return newBody;
@@ -452,14 +593,10 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float d
 // Creates a new rectangle physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
-
-    int newId = FindAvailableBodyIndex();
-    if (newId != -1)
+    PhysicsBody newBody = AllocatePhysicsBody();
+    if (newBody != NULL)
     {
         // Initialize new body with generic values
-        newBody->id = newId;
         newBody->enabled = true;
         newBody->position = pos;
         newBody->velocity = (Vector2){0.0f};
@@ -522,8 +659,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
         newBody->freezeOrient = false;
 
         // Add new body to bodies pointers array and update bodies count
-        bodies[physicsBodiesCount] = newBody;
-        physicsBodiesCount++;
+        AddPhysicsBody(newBody);
 
 #if defined(PHYSAC_DEBUG)
         printf("[PHYSAC] created polygon physics body id %i\n", newBody->id);
@@ -531,7 +667,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
     }
 #if defined(PHYSAC_DEBUG)
     else
-        printf("[PHYSAC] new physics body creation failed because there is any available id to use\n");
+        printf("[PHYSAC] new physics body creation failed because the bodies pool could not grow\n");
 #endif
 
     return newBody;
@@ -540,14 +676,10 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
 // Creates a new polygon physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
-
-    int newId = FindAvailableBodyIndex();
-    if (newId != -1)
+    PhysicsBody newBody = AllocatePhysicsBody();
+    if (newBody != NULL)
     {
         // Initialize new body with generic values
-        newBody->id = newId;
         newBody->enabled = true;
         newBody->position = pos;
         newBody->velocity = PHYSAC_VECTOR_ZERO;
@@ -609,8 +741,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
         newBody->freezeOrient = false;
 
         // Add new body to bodies pointers array and update bodies count
-        bodies[physicsBodiesCount] = newBody;
-        physicsBodiesCount++;
+        AddPhysicsBody(newBody);
 
 #if defined(PHYSAC_DEBUG)
         printf("[PHYSAC] created polygon physics body id %i\n", newBody->id);
@@ -618,7 +749,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
     }
 #if defined(PHYSAC_DEBUG)
     else
-        printf("[PHYSAC] new physics body creation failed because there is any available id to use\n");
+        printf("[PHYSAC] new physics body creation failed because the bodies pool could not grow\n");
 #endif
 
     return newBody;
@@ -789,9 +920,13 @@ PHYSACDEF int GetPhysicsBodiesCount(void)
 // Returns a physics body of the bodies pool at a specific index
 PHYSACDEF PhysicsBody GetPhysicsBody(int index)
 {
-    if (index < physicsBodiesCount)
+    PhysicsBody result = NULL;
+
+    if ((index >= 0) && (index < physicsBodiesCount))
     {
-        if (bodies[index] == NULL)
+        result = bodies[index];
+
+        if (result == NULL)
         {
 #if defined(PHYSAC_DEBUG)
             printf("[PHYSAC] error when trying to get a null reference physics body");
@@ -803,7 +938,7 @@ PHYSACDEF PhysicsBody GetPhysicsBody(int index)
         printf("[PHYSAC] physics body index is out of bounds");
 #endif
 
-    return bodies[index];
+    return result;
 }
 
 // Returns the physics body shape type (PHYSICS_CIRCLE or PHYSICS_POLYGON)
@@ -811,7 +946,7 @@ PHYSACDEF int GetPhysicsShapeType(int index)
 {
     int result = -1;
 
-    if (index < physicsBodiesCount)
+    if ((index >= 0) && (index < physicsBodiesCount))
     {
         if (bodies[index] != NULL)
             result = bodies[index]->shape.type;
@@ -834,7 +969,7 @@ PHYSACDEF int GetPhysicsShapeVerticesCount(int index)
 {
     int result = 0;
 
-    if (index < physicsBodiesCount)
+    if ((index >= 0) && (index < physicsBodiesCount))
     {
         if (bodies[index] != NULL)
         {
@@ -913,19 +1048,12 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
 {
     if (body != NULL)
     {
-        int id = body->id;
-        int index = -1;
+        std::lock_guard<std::mutex> lock(physicsMutex);
 
-        for (int i = 0; i < physicsBodiesCount; i++)
-        {
-            if (bodies[i]->id == id)
-            {
-                index = i;
-                break;
-            }
-        }
+        unsigned int id = body->id;
+        unsigned int index = ((id < bodyPoolIndices.size()) ? bodyPoolIndices[id] : physicsBodiesCount);
 
-        if (index == -1)
+        if ((index >= physicsBodiesCount) || (bodies[index] != body))
         {
 #if defined(PHYSAC_DEBUG)
             printf("[PHYSAC] Not possible to find body id %i in pointers array\n", id);
@@ -933,17 +1061,13 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
             return;
         }
 
-        // Free body allocated memory
-        PHYSAC_FREE(body);
-        usedMemory -= sizeof(PhysicsBodyData);
-        bodies[index] = NULL;
+        // Move the last body into the freed pointers array slot
+        bodies[index] = bodies.back();
+        bodyPoolIndices[bodies[index]->id] = index;
+        bodies.pop_back();
 
-        // Reorder physics bodies pointers array and its catched index
-        for (int i = index; i < physicsBodiesCount; i++)
-        {
-            if ((i + 1) < physicsBodiesCount)
-                bodies[i] = bodies[i + 1];
-        }
+        // Give the body slot back to the bodies pool
+        bodyPoolFree.push_back(id);
 
         // Update physics bodies count
         physicsBodiesCount--;
@@ -973,14 +1097,46 @@ PHYSACDEF void ClosePhysics(void)
     }
 #endif
 
-    // Unitialize physics manifolds dynamic memory allocations
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
-        DestroyPhysicsManifold(contacts[i]);
+    // Unitialize physics manifolds arena
+    std::vector<PhysicsManifoldData>().swap(contacts);
+    physicsManifoldsCount = 0;
 
     // Unitialize physics bodies dynamic memory allocations
     for (int i = physicsBodiesCount - 1; i >= 0; i--)
         DestroyPhysicsBody(bodies[i]);
 
+    for (unsigned int i = 0; i < bodyPoolBlocks.size(); i++)
+    {
+        PHYSAC_FREE(bodyPoolBlocks[i]);
+        usedMemory -= sizeof(PhysicsBodyData) * PHYSAC_BODY_POOL_BLOCK;
+    }
+
+    std::vector<PhysicsBodyData *>().swap(bodyPoolBlocks);
+    std::vector<unsigned int>().swap(bodyPoolFree);
+    std::vector<unsigned int>().swap(bodyPoolIndices);
+
+    // Release snapshots, a new world starts without any
+    for (int i = 0; i < 3; i++)
+    {
+        snapshots[i].bodies.clear();
+        snapshots[i].vertices.clear();
+    }
+
+    snapshotMiddle.fetch_and(~PHYSAC_SNAPSHOT_FRESH);
+    std::vector<PhysicsBodyPose>().swap(snapshotPoses);
+
+    // Release broadphase buffers
+    std::vector<PhysicsBroadphaseProxy>().swap(broadphaseProxies);
+    std::vector<uint64_t>().swap(broadphasePairs);
+
+    // Release islands buffers
+    std::vector<unsigned int>().swap(islandParents);
+    std::vector<unsigned char>().swap(islandMoved);
+    std::vector<unsigned int>().swap(islandRoots);
+    std::vector<unsigned int>().swap(islandOffsets);
+    std::vector<unsigned int>().swap(islandContacts);
+    std::vector<PhysicsIsland>().swap(islands);
+
 #if defined(PHYSAC_DEBUG)
     if (physicsBodiesCount > 0 || usedMemory != 0)
         printf("[PHYSAC] physics module closed with %i still allocated bodies [MEMORY: %i bytes]\n", physicsBodiesCount, usedMemory);
@@ -994,33 +1150,47 @@ PHYSACDEF void ClosePhysics(void)
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
-// Finds a valid index for a new physics body initialization
-static int FindAvailableBodyIndex()
+// Takes a free slot from the bodies pool for a new physics body
+// NOTE: the pool grows by whole blocks that are never moved, so body pointers stay valid until the body is destroyed
+static PhysicsBody AllocatePhysicsBody(void)
 {
-    int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_BODIES; i++)
+    std::lock_guard<std::mutex> lock(physicsMutex);
+
+    if (bodyPoolFree.empty())
     {
-        int currentId = i;
+        PhysicsBodyData *block = (PhysicsBodyData *)PHYSAC_MALLOC(sizeof(PhysicsBodyData) * PHYSAC_BODY_POOL_BLOCK);
 
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsBodiesCount; k++)
-        {
-            if (bodies[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
+        if (block == NULL)
+            return NULL;
 
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
+        usedMemory += sizeof(PhysicsBodyData) * PHYSAC_BODY_POOL_BLOCK;
+
+        unsigned int firstId = bodyPoolBlocks.size() * PHYSAC_BODY_POOL_BLOCK;
+        bodyPoolBlocks.push_back(block);
+        bodyPoolIndices.resize(firstId + PHYSAC_BODY_POOL_BLOCK);
+
+        // Push slots in reverse order so lower ids are handed out first
+        for (int i = PHYSAC_BODY_POOL_BLOCK - 1; i >= 0; i--)
+            bodyPoolFree.push_back(firstId + i);
     }
 
-    return index;
+    unsigned int id = bodyPoolFree.back();
+    bodyPoolFree.pop_back();
+
+    PhysicsBody body = &bodyPoolBlocks[id / PHYSAC_BODY_POOL_BLOCK][id % PHYSAC_BODY_POOL_BLOCK];
+    body->id = id;
+
+    return body;
+}
+
+// Adds an initialized physics body to the bodies pointers array
+static void AddPhysicsBody(PhysicsBody body)
+{
+    std::lock_guard<std::mutex> lock(physicsMutex);
+
+    bodyPoolIndices[body->id] = physicsBodiesCount;
+    bodies.push_back(body);
+    physicsBodiesCount++;
 }
 
 // Creates a random polygon shape with max vertex distance from polygon pivot
@@ -1081,30 +1251,43 @@ static void PhysicsLoop(void *arg)
     printf("[PHYSAC] physics thread created successfully\n");
 #endif
 
-    // Initialize physics loop thread values
-    physicsThreadEnabled = true;
-
     // Physics update loop
     while (physicsThreadEnabled)
     {
         RunPhysicsStep();
+
+        // Sleep until the next step deadline, only spinning through its last fraction of a millisecond
+        const double deadline = startTime + deltaTime - accumulator;
+        const double sleepTime = deadline - GetCurrTime() - PHYSAC_SPIN_TIME;
+
+        if (sleepTime > 0.0)
+            std::this_thread::sleep_for(std::chrono::microseconds((long long)(sleepTime * 1000.0)));
+
+        const double spinStart = GetCurrTime();
+        double now = spinStart;
+
+        while (physicsThreadEnabled && (now < deadline))
+        {
+            std::this_thread::yield();
+            now = GetCurrTime();
+        }
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        statsBusyTime += now - spinStart;
     }
 }
 
 // Physics steps calculations (dynamics, collisions and position corrections)
 static void PhysicsStep(void)
 {
+    std::lock_guard<std::mutex> lock(physicsMutex);
+
     // Update current steps count
     stepsCount++;
 
-    // Clear previous generated collisions information
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
-    {
-        PhysicsManifold manifold = contacts[i];
-
-        if (manifold != NULL)
-            DestroyPhysicsManifold(manifold);
-    }
+    // Clear previous generated collisions information (the arena keeps its memory for this step)
+    contacts.clear();
+    physicsManifoldsCount = 0;
 
     // Reset physics bodies grounded state
     for (int i = 0; i < physicsBodiesCount; i++)
@@ -1113,40 +1296,23 @@ static void PhysicsStep(void)
         body->isGrounded = false;
     }
 
+    // Find the body pairs whose AABBs overlap
+    UpdatePhysicsBroadphase();
+
     // Generate new collision information
-    for (int i = 0; i < physicsBodiesCount; i++)
+    for (unsigned int i = 0; i < broadphasePairs.size(); i++)
     {
-        PhysicsBody bodyA = bodies[i];
+        PhysicsBody bodyA = bodies[broadphasePairs[i] >> 32];
+        PhysicsBody bodyB = bodies[broadphasePairs[i] & 0xFFFFFFFFu];
 
-        if (bodyA != NULL)
-        {
-            for (int j = i + 1; j < physicsBodiesCount; j++)
-            {
-                PhysicsBody bodyB = bodies[j];
+        PhysicsManifoldData manifold = CreatePhysicsManifold(bodyA, bodyB);
+        SolvePhysicsManifold(&manifold);
 
-                if (bodyB != NULL)
-                {
-                    if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0))
-                        continue;
-
-                    PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
-                    SolvePhysicsManifold(manifold);
-
-                    if (manifold->contactsCount > 0)
-                    {
-                        // Create a new manifold with same information as previously solved manifold and add it to the manifolds pool last slot
-                        PhysicsManifold newManifold = CreatePhysicsManifold(bodyA, bodyB);
-                        newManifold->penetration = manifold->penetration;
-                        newManifold->normal = manifold->normal;
-                        newManifold->contacts[0] = manifold->contacts[0];
-                        newManifold->contacts[1] = manifold->contacts[1];
-                        newManifold->contactsCount = manifold->contactsCount;
-                        newManifold->restitution = manifold->restitution;
-                        newManifold->dynamicFriction = manifold->dynamicFriction;
-                        newManifold->staticFriction = manifold->staticFriction;
-                    }
-                }
-            }
+        if (manifold.contactsCount > 0)
+        {
+            // Keep colliding pairs only, stored twice as physac always did (every contact gets two impulse and correction passes)
+            AddPhysicsManifold(&manifold);
+            AddPhysicsManifold(&manifold);
         }
     }
 
@@ -1161,24 +1327,21 @@ static void PhysicsStep(void)
 
     // Initialize physics manifolds to solve collisions
     for (int i = 0; i < physicsManifoldsCount; i++)
-    {
-        PhysicsManifold manifold = contacts[i];
-
-        if (manifold != NULL)
-            InitializePhysicsManifolds(manifold);
-    }
+        InitializePhysicsManifolds(&contacts[i]);
 
     // Integrate physics collisions impulses to solve collisions
-    for (int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
-    {
-        for (int j = 0; j < physicsManifoldsCount; j++)
-        {
-            PhysicsManifold manifold = contacts[j];
+    // NOTE: islands share no moving body, so solving them apart in any order gives the same result as the serial loop
+    BuildPhysicsIslands();
 
-            if (manifold != NULL)
-                IntegratePhysicsImpulses(manifold);
-        }
-    }
+    auto solveIslands = [](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            SolvePhysicsIsland(&islands[i]);
+    };
+
+    if (physicsManifoldsCount >= PHYSAC_PARALLEL_CONTACTS)
+        PHYSAC_PARALLEL_FOR(islands.size(), 1, solveIslands);
+    else
+        solveIslands(0, islands.size());
 
     // Integrate velocity to physics bodies
     for (int i = 0; i < physicsBodiesCount; i++)
@@ -1191,12 +1354,7 @@ static void PhysicsStep(void)
 
     // Correct physics bodies positions based on manifolds collision information
     for (int i = 0; i < physicsManifoldsCount; i++)
-    {
-        PhysicsManifold manifold = contacts[i];
-
-        if (manifold != NULL)
-            CorrectPhysicsPositions(manifold);
-    }
+        CorrectPhysicsPositions(&contacts[i]);
 
     // Clear physics bodies forces
     for (int i = 0; i < physicsBodiesCount; i++)
@@ -1211,6 +1369,283 @@ static void PhysicsStep(void)
     }
 }
 
+// Returns the island root of a body index
+static unsigned int FindPhysicsIsland(unsigned int index)
+{
+    while (islandParents[index] != index)
+    {
+        islandParents[index] = islandParents[islandParents[index]]; // Path halving
+        index = islandParents[index];
+    }
+
+    return index;
+}
+
+// Groups the step manifolds into islands that share no moving body
+static void BuildPhysicsIslands(void)
+{
+    islandParents.resize(physicsBodiesCount);
+    islandMoved.resize(physicsBodiesCount);
+    islandOffsets.assign(physicsBodiesCount, 0);
+    islandRoots.resize(physicsManifoldsCount);
+    islandContacts.resize(physicsManifoldsCount);
+    islands.clear();
+
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        islandParents[i] = i;
+        islandMoved[i] = bodies[i]->enabled;
+    }
+
+    // Impulses only write to enabled bodies, except for contacts between massless bodies that stop both of them
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        if (fabs(contacts[i].bodyA->inverseMass + contacts[i].bodyB->inverseMass) <= PHYSAC_EPSILON)
+        {
+            islandMoved[bodyPoolIndices[contacts[i].bodyA->id]] = true;
+            islandMoved[bodyPoolIndices[contacts[i].bodyB->id]] = true;
+        }
+    }
+
+    // Join the bodies of every contact, static bodies touch many islands without joining them
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        unsigned int indexA = bodyPoolIndices[contacts[i].bodyA->id];
+        unsigned int indexB = bodyPoolIndices[contacts[i].bodyB->id];
+
+        if (islandMoved[indexA] && islandMoved[indexB])
+        {
+            unsigned int rootA = FindPhysicsIsland(indexA);
+            unsigned int rootB = FindPhysicsIsland(indexB);
+
+            if (rootA != rootB)
+                islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+    }
+
+    // Count the manifolds of every island
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        unsigned int indexA = bodyPoolIndices[contacts[i].bodyA->id];
+        unsigned int indexB = bodyPoolIndices[contacts[i].bodyB->id];
+
+        islandRoots[i] = FindPhysicsIsland(islandMoved[indexA] ? indexA : indexB);
+        islandOffsets[islandRoots[i]]++;
+    }
+
+    unsigned int firstContact = 0;
+
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        unsigned int contactsCount = islandOffsets[i];
+
+        if (contactsCount > 0)
+        {
+            islands.push_back((PhysicsIsland){firstContact, contactsCount});
+            islandOffsets[i] = firstContact;
+            firstContact += contactsCount;
+        }
+    }
+
+    // Place every manifold in its island keeping the step order
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+        islandContacts[islandOffsets[islandRoots[i]]++] = i;
+
+    // Largest islands are handed out first so a big stack does not start last
+    std::sort(islands.begin(), islands.end(), [](const PhysicsIsland &a, const PhysicsIsland &b) {
+        return ((a.contactsCount != b.contactsCount) ? (a.contactsCount > b.contactsCount) : (a.firstContact < b.firstContact));
+    });
+}
+
+// Integrates the collision impulses of an island manifolds
+static void SolvePhysicsIsland(const PhysicsIsland *island)
+{
+    const unsigned int *indices = &islandContacts[island->firstContact];
+
+    for (int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
+    {
+        for (unsigned int j = 0; j < island->contactsCount; j++)
+            IntegratePhysicsImpulses(&contacts[indices[j]]);
+    }
+}
+
+// Saves bodies pose before the last step of a frame for snapshot interpolation
+static void SavePhysicsBodyPoses(void)
+{
+    std::lock_guard<std::mutex> lock(physicsMutex);
+
+    if (snapshotPoses.size() < bodyPoolIndices.size())
+        snapshotPoses.resize(bodyPoolIndices.size());
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBodyPose *pose = &snapshotPoses[bodies[i]->id];
+
+        pose->position = bodies[i]->position;
+        pose->transform = bodies[i]->shape.transform;
+        pose->orient = bodies[i]->orient;
+        pose->stepsCount = stepsCount;
+    }
+}
+
+// Fills the back snapshot with the current bodies state and publishes it
+static void PublishPhysicsSnapshot(double time)
+{
+    PhysicsSnapshot *snapshot = &snapshots[snapshotBack];
+
+    {
+        std::lock_guard<std::mutex> lock(physicsMutex);
+
+        snapshot->time = time;
+        snapshot->bodies.resize(physicsBodiesCount);
+        snapshot->vertices.clear();
+
+        for (int i = 0; i < physicsBodiesCount; i++)
+        {
+            PhysicsBody body = bodies[i];
+            PhysicsBodySnapshot *state = &snapshot->bodies[i];
+
+            state->body = body;
+            state->position = body->position;
+            state->transform = body->shape.transform;
+            state->orient = body->orient;
+            state->velocity = body->velocity;
+            state->firstVertex = snapshot->vertices.size();
+
+            // Bodies created during the last step have no previous pose
+            const PhysicsBodyPose *pose = ((body->id < snapshotPoses.size()) ? &snapshotPoses[body->id] : NULL);
+
+            if ((pose != NULL) && (pose->stepsCount == stepsCount - 1))
+            {
+                state->previousPosition = pose->position;
+                state->previousTransform = pose->transform;
+                state->previousOrient = pose->orient;
+            }
+            else
+            {
+                state->previousPosition = state->position;
+                state->previousTransform = state->transform;
+                state->previousOrient = state->orient;
+            }
+
+            if (body->shape.type == PHYSICS_CIRCLE)
+            {
+                // Circles are drawn unrotated, as GetPhysicsShapeVertex() does
+                state->transform = state->previousTransform = Mat2Radians(0.0f);
+                state->vertexCount = PHYSAC_CIRCLE_VERTICES;
+
+                for (int j = 0; j < PHYSAC_CIRCLE_VERTICES; j++)
+                    snapshot->vertices.push_back((Vector2){cosf(360.0f / PHYSAC_CIRCLE_VERTICES * j * PHYSAC_DEG2RAD) * body->shape.radius,
+                                                           sinf(360.0f / PHYSAC_CIRCLE_VERTICES * j * PHYSAC_DEG2RAD) * body->shape.radius});
+            }
+            else
+            {
+                state->vertexCount = body->shape.vertexData.vertexCount;
+                snapshot->vertices.insert(snapshot->vertices.end(), body->shape.vertexData.positions, body->shape.vertexData.positions + state->vertexCount);
+            }
+        }
+    }
+
+    snapshotBack = snapshotMiddle.exchange(snapshotBack | PHYSAC_SNAPSHOT_FRESH, std::memory_order_acq_rel) & ~PHYSAC_SNAPSHOT_FRESH;
+}
+
+// Sweeps bodies AABBs and collects the pairs that may collide
+// NOTE: proxies stay sorted along x between steps, so the insertion sort is close to O(n) while bodies move coherently
+static void UpdatePhysicsBroadphase(void)
+{
+    broadphasePairs.clear();
+
+    // Bodies were added or removed, rebuild the proxies list
+    bool rebuild = (broadphaseProxies.size() != physicsBodiesCount);
+
+    if (rebuild)
+    {
+        broadphaseProxies.resize(physicsBodiesCount);
+
+        for (int i = 0; i < physicsBodiesCount; i++)
+            broadphaseProxies[i].index = i;
+    }
+
+    // Refresh bodies AABBs
+    for (unsigned int i = 0; i < broadphaseProxies.size(); i++)
+    {
+        PhysicsBroadphaseProxy *proxy = &broadphaseProxies[i];
+        PhysicsBody body = bodies[proxy->index];
+
+        if (body->shape.type == PHYSICS_CIRCLE)
+        {
+            proxy->minX = body->position.x - body->shape.radius;
+            proxy->maxX = body->position.x + body->shape.radius;
+            proxy->minY = body->position.y - body->shape.radius;
+            proxy->maxY = body->position.y + body->shape.radius;
+        }
+        else
+        {
+            proxy->minX = proxy->minY = PHYSAC_FLT_MAX;
+            proxy->maxX = proxy->maxY = -PHYSAC_FLT_MAX;
+
+            for (int j = 0; j < body->shape.vertexData.vertexCount; j++)
+            {
+                Vector2 vertex = Vector2Add(body->position, Mat2MultiplyVector2(body->shape.transform, body->shape.vertexData.positions[j]));
+
+                proxy->minX = std::min(proxy->minX, vertex.x);
+                proxy->maxX = std::max(proxy->maxX, vertex.x);
+                proxy->minY = std::min(proxy->minY, vertex.y);
+                proxy->maxY = std::max(proxy->maxY, vertex.y);
+            }
+        }
+
+        proxy->minX -= PHYSAC_BROADPHASE_MARGIN;
+        proxy->maxX += PHYSAC_BROADPHASE_MARGIN;
+        proxy->minY -= PHYSAC_BROADPHASE_MARGIN;
+        proxy->maxY += PHYSAC_BROADPHASE_MARGIN;
+    }
+
+    // Restore x order, with an insertion sort when the previous order is still valid (bodies barely move between steps)
+    if (rebuild)
+        std::sort(broadphaseProxies.begin(), broadphaseProxies.end(), [](const PhysicsBroadphaseProxy &a, const PhysicsBroadphaseProxy &b) { return a.minX < b.minX; });
+    else
+    {
+        for (unsigned int i = 1; i < broadphaseProxies.size(); i++)
+        {
+            PhysicsBroadphaseProxy proxy = broadphaseProxies[i];
+            int j = (int)i - 1;
+
+            while ((j >= 0) && (broadphaseProxies[j].minX > proxy.minX))
+            {
+                broadphaseProxies[j + 1] = broadphaseProxies[j];
+                j--;
+            }
+
+            broadphaseProxies[j + 1] = proxy;
+        }
+    }
+
+    // Sweep along x and test y overlap of the bodies whose x intervals overlap
+    for (unsigned int i = 0; i < broadphaseProxies.size(); i++)
+    {
+        const PhysicsBroadphaseProxy *proxyA = &broadphaseProxies[i];
+
+        for (unsigned int j = i + 1; (j < broadphaseProxies.size()) && (broadphaseProxies[j].minX <= proxyA->maxX); j++)
+        {
+            const PhysicsBroadphaseProxy *proxyB = &broadphaseProxies[j];
+
+            if ((proxyB->minY > proxyA->maxY) || (proxyA->minY > proxyB->maxY))
+                continue;
+
+            if ((bodies[proxyA->index]->inverseMass == 0) && (bodies[proxyB->index]->inverseMass == 0))
+                continue;
+
+            uint64_t a = std::min(proxyA->index, proxyB->index);
+            uint64_t b = std::max(proxyA->index, proxyB->index);
+            broadphasePairs.push_back((a << 32) | b);
+        }
+    }
+
+    // Keep the bodies array pair order so contacts are solved in the same sequence as a brute force pass
+    std::sort(broadphasePairs.begin(), broadphasePairs.end());
+}
+
 // Wrapper to ensure PhysicsStep is run with at a fixed time step
 PHYSACDEF void RunPhysicsStep(void)
 {
@@ -1223,11 +1658,44 @@ PHYSACDEF void RunPhysicsStep(void)
     // Store the time elapsed since the last frame began
     accumulator += delta;
 
-    // Fixed time stepping loop
-    while (accumulator >= deltaTime)
+    if (accumulator >= deltaTime)
     {
-        PhysicsStep();
-        accumulator -= deltaTime;
+        // The first pending step was due when the accumulator reached deltaTime
+        const double jitter = accumulator - deltaTime;
+        unsigned int steps = 0;
+        unsigned int dropped = 0;
+
+        // Drop every missed step but one when falling behind
+        if ((stepMode == PHYSICS_STEP_DROP) && (accumulator >= 2.0 * deltaTime))
+        {
+            dropped = (unsigned int)(accumulator / deltaTime) - 1;
+            accumulator -= dropped * deltaTime;
+        }
+
+        const bool publish = snapshotsEnabled.load(std::memory_order_relaxed);
+
+        // Fixed time stepping loop
+        while (accumulator >= deltaTime)
+        {
+            // Keep the poses before the last step so snapshots can be interpolated
+            if (publish && (accumulator < 2.0 * deltaTime))
+                SavePhysicsBodyPoses();
+
+            PhysicsStep();
+            accumulator -= deltaTime;
+            steps++;
+        }
+
+        if (publish)
+            PublishPhysicsSnapshot(currentTime - accumulator);
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        statsSteps += steps;
+        statsDropped += dropped;
+        statsJitterSamples++;
+        statsJitterSum += jitter;
+        statsJitterMax = std::max(statsJitterMax, jitter);
+        statsBusyTime += GetCurrTime() - currentTime;
     }
 
     // Record the starting of this frame
@@ -1239,113 +1707,143 @@ PHYSACDEF void SetPhysicsTimeStep(double delta)
     deltaTime = delta;
 }
 
-// Finds a valid index for a new manifold initialization
-static int FindAvailableManifoldIndex()
+// Takes the latest physics state published by the physics thread for reading, returns its bodies count
+// NOTE: snapshots are published after every stepping frame once this has been called, reading them never blocks the physics thread
+PHYSACDEF int UpdatePhysicsSnapshot(void)
 {
-    int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_MANIFOLDS; i++)
-    {
-        int currentId = i;
+    snapshotsEnabled.store(true, std::memory_order_relaxed);
 
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsManifoldsCount; k++)
-        {
-            if (contacts[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
+    if (snapshotMiddle.load(std::memory_order_acquire) & PHYSAC_SNAPSHOT_FRESH)
+        snapshotFront = snapshotMiddle.exchange(snapshotFront, std::memory_order_acq_rel) & ~PHYSAC_SNAPSHOT_FRESH;
 
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
-    }
+    return snapshots[snapshotFront].bodies.size();
+}
 
-    return index;
+// Returns the interpolation factor between the two last steps of the snapshot for the current time
+// NOTE: rendering with it shows the world one step in the past, but moving smoothly between steps
+PHYSACDEF float GetPhysicsSnapshotAlpha(void)
+{
+    const double alpha = (GetCurrTime() - snapshots[snapshotFront].time) / deltaTime;
+
+    return std::min(std::max(alpha, 0.0), 1.0);
 }
 
-// Creates a new physics manifold to solve collision
-static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
-{
-    PhysicsManifold newManifold = (PhysicsManifold)PHYSAC_MALLOC(sizeof(PhysicsManifoldData));
-    usedMemory += sizeof(PhysicsManifoldData);
-
-    int newId = FindAvailableManifoldIndex();
-    if (newId != -1)
-    {
-        // Initialize new manifold with generic values
-        newManifold->id = newId;
-        newManifold->bodyA = a;
-        newManifold->bodyB = b;
-        newManifold->penetration = 0;
-        newManifold->normal = PHYSAC_VECTOR_ZERO;
-        newManifold->contacts[0] = PHYSAC_VECTOR_ZERO;
-        newManifold->contacts[1] = PHYSAC_VECTOR_ZERO;
-        newManifold->contactsCount = 0;
-        newManifold->restitution = 0.0f;
-        newManifold->dynamicFriction = 0.0f;
-        newManifold->staticFriction = 0.0f;
+// Returns the state of a physics body of the snapshot, interpolated by alpha (1 is the last step)
+PHYSACDEF PhysicsBodyState GetPhysicsSnapshotBody(int index, float alpha)
+{
+    PhysicsBodyState result = {0};
+    const PhysicsSnapshot *snapshot = &snapshots[snapshotFront];
 
-        // Add new body to bodies pointers array and update bodies count
-        contacts[physicsManifoldsCount] = newManifold;
-        physicsManifoldsCount++;
+    if ((index >= 0) && ((unsigned int)index < snapshot->bodies.size()))
+    {
+        const PhysicsBodySnapshot *body = &snapshot->bodies[index];
+
+        result.body = body->body;
+        result.position.x = body->previousPosition.x * (1.0f - alpha) + body->position.x * alpha;
+        result.position.y = body->previousPosition.y * (1.0f - alpha) + body->position.y * alpha;
+        result.velocity = body->velocity;
+        result.orient = body->previousOrient * (1.0f - alpha) + body->orient * alpha;
+        result.vertexCount = body->vertexCount;
     }
 #if defined(PHYSAC_DEBUG)
     else
-        printf("[PHYSAC] new physics manifold creation failed because there is any available id to use\n");
+        printf("[PHYSAC] physics snapshot body index is out of bounds");
 #endif
 
-    return newManifold;
+    return result;
 }
 
-// Unitializes and destroys a physics manifold
-static void DestroyPhysicsManifold(PhysicsManifold manifold)
+// Returns the transformed position of a body shape vertex of the snapshot, interpolated by alpha
+PHYSACDEF Vector2 GetPhysicsSnapshotVertex(int index, int vertex, float alpha)
 {
-    if (manifold != NULL)
+    Vector2 position = {0.0f, 0.0f};
+    const PhysicsSnapshot *snapshot = &snapshots[snapshotFront];
+
+    if ((index >= 0) && ((unsigned int)index < snapshot->bodies.size()) && (vertex >= 0) && ((unsigned int)vertex < snapshot->bodies[index].vertexCount))
     {
-        int id = manifold->id;
-        int index = -1;
+        const PhysicsBodySnapshot *body = &snapshot->bodies[index];
+        const float beta = 1.0f - alpha;
 
-        for (int i = 0; i < physicsManifoldsCount; i++)
-        {
-            if (contacts[i]->id == id)
-            {
-                index = i;
-                break;
-            }
-        }
+        // Blending the transform matrices is close enough to rotating by the blended angle for the few radians a step can turn
+        Mat2 transform = {body->previousTransform.m00 * beta + body->transform.m00 * alpha, body->previousTransform.m01 * beta + body->transform.m01 * alpha,
+                          body->previousTransform.m10 * beta + body->transform.m10 * alpha, body->previousTransform.m11 * beta + body->transform.m11 * alpha};
+        Vector2 center = {body->previousPosition.x * beta + body->position.x * alpha, body->previousPosition.y * beta + body->position.y * alpha};
 
-        if (index == -1)
-        {
+        position = Vector2Add(center, Mat2MultiplyVector2(transform, snapshot->vertices[body->firstVertex + vertex]));
+    }
 #if defined(PHYSAC_DEBUG)
-            printf("[PHYSAC] Not possible to manifold id %i in pointers array\n", id);
+    else
+        printf("[PHYSAC] physics snapshot vertex index is out of bounds");
 #endif
-            return;
-        }
 
-        // Free manifold allocated memory
-        PHYSAC_FREE(manifold);
-        usedMemory -= sizeof(PhysicsManifoldData);
-        contacts[index] = NULL;
+    return position;
+}
 
-        // Reorder physics manifolds pointers array and its catched index
-        for (int i = index; i < physicsManifoldsCount; i++)
-        {
-            if ((i + 1) < physicsManifoldsCount)
-                contacts[i] = contacts[i + 1];
-        }
+// Sets how missed physics steps are handled (PHYSICS_STEP_CATCH_UP or PHYSICS_STEP_DROP)
+PHYSACDEF void SetPhysicsStepMode(int mode)
+{
+    stepMode = mode;
+}
 
-        // Update physics manifolds count
-        physicsManifoldsCount--;
-    }
-#if defined(PHYSAC_DEBUG)
-    else
-        printf("[PHYSAC] error trying to destroy a null referenced manifold\n");
-#endif
+// Returns physics steps timing counters (jitter, dropped steps, CPU usage)
+PHYSACDEF PhysicsStats GetPhysicsStats(void)
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    PhysicsStats stats = {0};
+    const double elapsed = GetCurrTime() - statsStartTime;
+
+    stats.steps = statsSteps;
+    stats.droppedSteps = statsDropped;
+    stats.jitterAverage = ((statsJitterSamples > 0) ? statsJitterSum / statsJitterSamples : 0.0);
+    stats.jitterMax = statsJitterMax;
+    stats.cpuUsage = ((elapsed > 0.0) ? std::min(statsBusyTime / elapsed, 1.0) : 0.0);
+
+    return stats;
+}
+
+// Resets physics steps timing counters
+PHYSACDEF void ResetPhysicsStats(void)
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+
+    statsSteps = 0;
+    statsDropped = 0;
+    statsJitterSamples = 0;
+    statsJitterSum = 0.0;
+    statsJitterMax = 0.0;
+    statsBusyTime = 0.0;
+    statsStartTime = GetCurrTime();
+}
+
+// Creates a new physics manifold to solve collision
+// NOTE: the manifold is returned by value, only colliding ones are added to the step manifolds arena
+static PhysicsManifoldData CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
+{
+    PhysicsManifoldData newManifold = {0};
+
+    // Initialize new manifold with generic values
+    newManifold.bodyA = a;
+    newManifold.bodyB = b;
+    newManifold.penetration = 0;
+    newManifold.normal = PHYSAC_VECTOR_ZERO;
+    newManifold.contacts[0] = PHYSAC_VECTOR_ZERO;
+    newManifold.contacts[1] = PHYSAC_VECTOR_ZERO;
+    newManifold.contactsCount = 0;
+    newManifold.restitution = 0.0f;
+    newManifold.dynamicFriction = 0.0f;
+    newManifold.staticFriction = 0.0f;
+
+    return newManifold;
+}
+
+// Adds a solved physics manifold to the step manifolds arena
+static void AddPhysicsManifold(const PhysicsManifoldData *manifold)
+{
+    // The arena only grows the first steps a world gets this many contacts, then reuses its memory
+    contacts.push_back(*manifold);
+    contacts.back().id = physicsManifoldsCount;
+    physicsManifoldsCount++;
 }
 
 // Solves a created physics manifold between two physics bodies
@@ -7,6 +7,7 @@
 
 #include "raylib.h"
 #define PHYSAC_IMPLEMENTATION
+#define PHYSAC_PARALLEL_FOR(count, grain, fn) ___parallel_for_raylib64(count, grain, fn) // Contact islands share raylib's worker pool
 #include "external/physac.h"
 
 inline qb_bool __IsPhysicsEnabled()
@@ -14,6 +15,21 @@ inline qb_bool __IsPhysicsEnabled()
     return TO_QB_BOOL(IsPhysicsEnabled());
 }
 
+inline void __GetPhysicsStats(void *retVal)
+{
+    *(PhysicsStats *)retVal = GetPhysicsStats();
+}
+
+inline void __GetPhysicsSnapshotBody(int index, float alpha, void *retVal)
+{
+    *(PhysicsBodyState *)retVal = GetPhysicsSnapshotBody(index, alpha);
+}
+
+inline void __GetPhysicsSnapshotVertex(int index, int vertex, float alpha, void *retVal)
+{
+    *(Vector2 *)retVal = GetPhysicsSnapshotVertex(index, vertex, alpha);
+}
+
 inline PhysicsBody __CreatePhysicsBodyCircle(void *pos, float radius, float density)
 {
     return CreatePhysicsBodyCircle(*(Vector2 *)pos, radius, density);
@@ -7,9 +7,34 @@
 
 #pragma once
 
+// Define RAYLIB64_LAZY_BINDING to resolve each raylib function on first use instead of all at once in ___init_raylib64()
+// Define RAYLIB64_DIRECT_LINK to link raylib at build time and call it without going through function pointers
+// Define RAYLIB64_INSTRUMENT to record call counts and timings for every binding (see RAYLIB64_INSTRUMENT_FILE)
+#if defined(RAYLIB64_LAZY_BINDING) && !defined(DYLIB_OPEN_FLAGS)
+#define DYLIB_OPEN_FLAGS (RTLD_LAZY | RTLD_LOCAL)
+#endif
+
 #include <cstdint>
 #include <cstring>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAYLIB64_SSE2 1
+#endif
+#if !defined(RAYLIB64_DIRECT_LINK)
 #include "external/dylib.hpp"
+#endif
 
 // Quick and dirty logging macros
 #define RAYLIB_DEBUG_PRINT(_fmt_, _args_...) fprintf(stderr, "\e[1;37mDEBUG: %s:%d:%s(): \e[1;33m" _fmt_ "\e[1;37m\n", __FILE__, __LINE__, __func__, ##_args_)
@@ -391,565 +416,800 @@ typedef char *(*LoadFileTextCallback)(const char *fileName);
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text);               // FileIO: Save text data
 typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
+#if defined(RAYLIB64_INSTRUMENT)
+// Statistics are written to this file by ___done_raylib64() at exit. A .json extension selects JSON, anything else is CSV
+#if !defined(RAYLIB64_INSTRUMENT_FILE)
+#define RAYLIB64_INSTRUMENT_FILE "raylib64_stats.csv"
+#endif
+#define RAYLIB64_INSTRUMENT_MAX_BINDINGS 1024
+#define RAYLIB64_INSTRUMENT_BUCKETS 16 // Latency histogram buckets; bucket n counts calls faster than 2^(n + 7) ns, the last one counts the rest
+
+// Call statistics for a single binding
+struct ___binding_stats_raylib64
+{
+    const char *name;                                 // raylib function name
+    uint64_t calls;                                   // Total calls
+    uint64_t nanoseconds;                             // Total time spent in raylib
+    uint64_t frameCalls;                              // Calls in the frame being recorded
+    uint64_t frameNanoseconds;                        // Time spent in the frame being recorded
+    uint64_t lastFrameCalls;                          // Calls in the last completed frame
+    uint64_t lastFrameNanoseconds;                    // Time spent in the last completed frame
+    uint64_t histogram[RAYLIB64_INSTRUMENT_BUCKETS]; // Latency histogram
+};
+
+static ___binding_stats_raylib64 ___stats_table_raylib64[RAYLIB64_INSTRUMENT_MAX_BINDINGS];
+static size_t ___stats_count_raylib64 = 0;
+
+// Returns the statistics entry of a binding. This is called just once per call site
+static ___binding_stats_raylib64 *___stats_raylib64(const char *name)
+{
+    for (size_t i = 0; i < ___stats_count_raylib64; i++)
+    {
+        if (!strcmp(___stats_table_raylib64[i].name, name))
+            return &___stats_table_raylib64[i];
+    }
+
+    if (___stats_count_raylib64 >= RAYLIB64_INSTRUMENT_MAX_BINDINGS)
+    {
+        static ___binding_stats_raylib64 overflow = {"(overflow)"};
+        return &overflow;
+    }
+
+    auto binding = &___stats_table_raylib64[___stats_count_raylib64++];
+    binding->name = name;
+
+    return binding;
+}
+
+// Times a single call (from construction to destruction) and records it
+struct ___call_recorder_raylib64
+{
+    ___binding_stats_raylib64 *binding;
+    std::chrono::steady_clock::time_point start;
+
+    ~___call_recorder_raylib64()
+    {
+        auto ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        binding->calls++;
+        binding->nanoseconds += ns;
+        binding->frameCalls++;
+        binding->frameNanoseconds += ns;
+
+        size_t bucket = 0;
+        while (bucket < RAYLIB64_INSTRUMENT_BUCKETS - 1 && ns >= (uint64_t(128) << bucket))
+            bucket++;
+        binding->histogram[bucket]++;
+    }
+};
+
+template <typename R, typename... Args>
+struct ___timed_call_raylib64
+{
+    R (*fn)(Args...);
+    ___binding_stats_raylib64 *binding;
+
+    R operator()(Args... args) const
+    {
+        ___call_recorder_raylib64 recorder = {binding, std::chrono::steady_clock::now()};
+        return fn(args...);
+    }
+};
+
+template <typename R, typename... Args>
+inline ___timed_call_raylib64<R, Args...> ___timed_raylib64(R (*fn)(Args...), ___binding_stats_raylib64 *binding)
+{
+    return {fn, binding};
+}
+
+// C variadic functions (TextFormat, TraceLog) still need a variadic call for the extra arguments
+template <typename R, typename... Args>
+struct ___timed_variadic_call_raylib64
+{
+    R (*fn)(Args..., ...);
+    ___binding_stats_raylib64 *binding;
+
+    template <typename... Extra>
+    R operator()(Args... args, Extra... extra) const
+    {
+        ___call_recorder_raylib64 recorder = {binding, std::chrono::steady_clock::now()};
+        return fn(args..., extra...);
+    }
+};
+
+template <typename R, typename... Args>
+inline ___timed_variadic_call_raylib64<R, Args...> ___timed_raylib64(R (*fn)(Args..., ...), ___binding_stats_raylib64 *binding)
+{
+    return {fn, binding};
+}
+
+// Closes the frame being recorded. This is called by EndDrawing()
+static void ___end_frame_stats_raylib64()
+{
+    for (size_t i = 0; i < ___stats_count_raylib64; i++)
+    {
+        auto binding = &___stats_table_raylib64[i];
+        binding->lastFrameCalls = binding->frameCalls;
+        binding->lastFrameNanoseconds = binding->frameNanoseconds;
+        binding->frameCalls = binding->frameNanoseconds = 0;
+    }
+}
+
+// Writes the statistics table to a CSV or JSON file (selected by the file extension)
+static bool ___dump_stats_raylib64(const char *fileName)
+{
+    auto ext = strrchr(fileName, '.');
+    auto json = ext && !strcmp(ext, ".json");
+
+    auto file = fopen(fileName, "w");
+    if (!file)
+    {
+        RAYLIB_DEBUG_PRINT("Error: Failed to create %s", fileName);
+        return false;
+    }
+
+    if (json)
+        fputs("[\n", file);
+    else
+    {
+        fputs("name,calls,total_ns,avg_ns,last_frame_calls,last_frame_ns", file);
+        for (size_t b = 0; b < RAYLIB64_INSTRUMENT_BUCKETS - 1; b++)
+            fprintf(file, ",lt_%llu_ns", (unsigned long long)(uint64_t(128) << b));
+        fputs(",slower\n", file);
+    }
+
+    for (size_t i = 0; i < ___stats_count_raylib64; i++)
+    {
+        auto binding = &___stats_table_raylib64[i];
+        auto avg = binding->calls ? double(binding->nanoseconds) / double(binding->calls) : 0.0;
+
+        if (json)
+            fprintf(file, "  {\"name\": \"%s\", \"calls\": %llu, \"total_ns\": %llu, \"avg_ns\": %.1f, \"last_frame_calls\": %llu, \"last_frame_ns\": %llu, \"histogram\": [",
+                    binding->name, (unsigned long long)binding->calls, (unsigned long long)binding->nanoseconds, avg,
+                    (unsigned long long)binding->lastFrameCalls, (unsigned long long)binding->lastFrameNanoseconds);
+        else
+            fprintf(file, "%s,%llu,%llu,%.1f,%llu,%llu", binding->name, (unsigned long long)binding->calls, (unsigned long long)binding->nanoseconds, avg,
+                    (unsigned long long)binding->lastFrameCalls, (unsigned long long)binding->lastFrameNanoseconds);
+
+        for (size_t b = 0; b < RAYLIB64_INSTRUMENT_BUCKETS; b++)
+            fprintf(file, json ? (b ? ", %llu" : "%llu") : ",%llu", (unsigned long long)binding->histogram[b]);
+
+        fputs(json ? (i + 1 < ___stats_count_raylib64 ? "]},\n" : "]}\n") : "\n", file);
+    }
+
+    if (json)
+        fputs("]\n", file);
+
+    fclose(file);
+
+    return true;
+}
+#endif
+
+#if defined(RAYLIB64_DIRECT_LINK)
+// raylib is linked at build time (static or import library), so the wrappers call the real functions directly
+#define RAYLIB64_FUNCTION(_ret_, _name_, _params_) _ret_ _name_ _params_
+#define RAYLIB64_TARGET(_name_) raylib64::_name_
+
+namespace raylib64
+{
+    extern "C"
+    {
+#else
 static dylib *_raylib64 = nullptr; //  This is our raylib shared library object
 
+#define RAYLIB64_FUNCTION(_ret_, _name_, _params_) static _ret_(*_##_name_) _params_ = nullptr
+#endif
+
 //  Global raylib function pointers
-static void (*_InitWindow)(int width, int height, char *title) = nullptr;
-static void (*_CloseWindow)() = nullptr;
-static bool (*_WindowShouldClose)() = nullptr;
-static bool (*_IsWindowReady)() = nullptr;
-static bool (*_IsWindowFullscreen)() = nullptr;
-static bool (*_IsWindowHidden)() = nullptr;
-static bool (*_IsWindowMinimized)() = nullptr;
-static bool (*_IsWindowMaximized)() = nullptr;
-static bool (*_IsWindowFocused)() = nullptr;
-static bool (*_IsWindowResized)() = nullptr;
-static bool (*_IsWindowState)(unsigned int flag) = nullptr;
-static void (*_SetWindowState)(unsigned int flags) = nullptr;
-static void (*_ClearWindowState)(unsigned int flags) = nullptr;
-static void (*_ToggleFullscreen)() = nullptr;
-static void (*_ToggleBorderlessWindowed)() = nullptr;
-static void (*_MaximizeWindow)() = nullptr;
-static void (*_MinimizeWindow)() = nullptr;
-static void (*_RestoreWindow)() = nullptr;
-static void (*_SetWindowIcon)(Image image) = nullptr;
-static void (*_SetWindowIcons)(Image *images, int count) = nullptr;
-static void (*_SetWindowTitle)(char *title) = nullptr;
-static void (*_SetWindowPosition)(int x, int y) = nullptr;
-static void (*_SetWindowMonitor)(int monitor) = nullptr;
-static void (*_SetWindowMinSize)(int width, int height) = nullptr;
-static void (*_SetWindowMaxSize)(int width, int height) = nullptr;
-static void (*_SetWindowSize)(int width, int height) = nullptr;
-static void (*_SetWindowOpacity)(float opacity) = nullptr;
-static void (*_SetWindowFocused)() = nullptr;
-static void *(*_GetWindowHandle)() = nullptr;
-static int (*_GetScreenWidth)() = nullptr;
-static int (*_GetScreenHeight)() = nullptr;
-static int (*_GetRenderWidth)() = nullptr;
-static int (*_GetRenderHeight)() = nullptr;
-static int (*_GetMonitorCount)() = nullptr;
-static int (*_GetCurrentMonitor)() = nullptr;
-static Vector2 (*_GetMonitorPosition)(int monitor) = nullptr;
-static int (*_GetMonitorWidth)(int monitor) = nullptr;
-static int (*_GetMonitorHeight)(int monitor) = nullptr;
-static int (*_GetMonitorPhysicalWidth)(int monitor) = nullptr;
-static int (*_GetMonitorPhysicalHeight)(int monitor) = nullptr;
-static int (*_GetMonitorRefreshRate)(int monitor) = nullptr;
-static Vector2 (*_GetWindowPosition)() = nullptr;
-static Vector2 (*_GetWindowScaleDPI)() = nullptr;
-static char *(*_GetMonitorName)(int monitor) = nullptr;
-static void (*_SetClipboardText)(char *text) = nullptr;
-static char *(*_GetClipboardText)() = nullptr;
-static void (*_EnableEventWaiting)() = nullptr;
-static void (*_DisableEventWaiting)() = nullptr;
-static void (*_ShowCursor)() = nullptr;
-static void (*_HideCursor)() = nullptr;
-static bool (*_IsCursorHidden)() = nullptr;
-static void (*_EnableCursor)() = nullptr;
-static void (*_DisableCursor)() = nullptr;
-static bool (*_IsCursorOnScreen)() = nullptr;
-static void (*_ClearBackground)(uint32_t color) = nullptr;
-static void (*_BeginDrawing)() = nullptr;
-static void (*_EndDrawing)() = nullptr;
-static void (*_BeginMode2D)(Camera2D camera) = nullptr;
-static void (*_EndMode2D)() = nullptr;
-static void (*_BeginMode3D)(Camera3D camera) = nullptr;
-static void (*_EndMode3D)() = nullptr;
-static void (*_BeginTextureMode)(RenderTexture target) = nullptr;
-static void (*_EndTextureMode)() = nullptr;
-static void (*_BeginShaderMode)(Shader shader) = nullptr;
-static void (*_EndShaderMode)() = nullptr;
-static void (*_BeginBlendMode)(int mode) = nullptr;
-static void (*_EndBlendMode)() = nullptr;
-static void (*_BeginScissorMode)(int x, int y, int width, int height) = nullptr;
-static void (*_EndScissorMode)() = nullptr;
-static void (*_BeginVrStereoMode)(VrStereoConfig config) = nullptr;
-static void (*_EndVrStereoMode)() = nullptr;
-static VrStereoConfig (*_LoadVrStereoConfig)(VrDeviceInfo device) = nullptr;
-static void (*_UnloadVrStereoConfig)(VrStereoConfig config) = nullptr;
-static Shader (*_LoadShader)(char *vsFileName, char *fsFileName) = nullptr;
-static Shader (*_LoadShaderFromMemory)(char *vsCode, char *fsCode) = nullptr;
-static bool (*_IsShaderReady)(Shader shader) = nullptr;
-static int (*_GetShaderLocation)(Shader shader, char *uniformName) = nullptr;
-static int (*_GetShaderLocationAttrib)(Shader shader, char *attribName) = nullptr;
-static void (*_SetShaderValue)(Shader shader, int locIndex, void *value, int uniformType) = nullptr;
-static void (*_SetShaderValueV)(Shader shader, int locIndex, void *value, int uniformType, int count) = nullptr;
-static void (*_SetShaderValueMatrix)(Shader shader, int locIndex, Matrix mat) = nullptr;
-static void (*_SetShaderValueTexture)(Shader shader, int locIndex, Texture texture) = nullptr;
-static void (*_UnloadShader)(Shader shader) = nullptr;
-static Ray (*_GetMouseRay)(Vector2 mousePosition, Camera3D camera) = nullptr;
-static Matrix (*_GetCameraMatrix)(Camera3D camera) = nullptr;
-static Matrix (*_GetCameraMatrix2D)(Camera2D camera) = nullptr;
-static Vector2 (*_GetWorldToScreen)(Vector3 position, Camera3D camera) = nullptr;
-static Vector2 (*_GetScreenToWorld2D)(Vector2 position, Camera2D camera) = nullptr;
-static Vector2 (*_GetWorldToScreenEx)(Vector3 position, Camera3D camera, int width, int height) = nullptr;
-static Vector2 (*_GetWorldToScreen2D)(Vector2 position, Camera2D camera) = nullptr;
-static void (*_SetTargetFPS)(int fps) = nullptr;
-static float (*_GetFrameTime)() = nullptr;
-static double (*_GetTime)() = nullptr;
-static int (*_GetFPS)() = nullptr;
-static void (*_SwapScreenBuffer)() = nullptr;
-static void (*_PollInputEvents)() = nullptr;
-static void (*_WaitTime)(double seconds) = nullptr;
-static void (*_SetRandomSeed)(unsigned int seed) = nullptr;
-static int (*_GetRandomValue)(int min, int max) = nullptr;
-static int *(*_LoadRandomSequence)(unsigned int count, int min, int max) = nullptr;
-static void (*_UnloadRandomSequence)(int *sequence) = nullptr;
-static void (*_TakeScreenshot)(char *fileName) = nullptr;
-static void (*_SetConfigFlags)(unsigned int flags) = nullptr;
-static void (*_OpenURL)(char *url) = nullptr;
-static void (*_TraceLog)(int logLevel, char *text, ...) = nullptr;
-static void (*_SetTraceLogLevel)(int logLevel) = nullptr;
-static void *(*_MemAlloc)(unsigned int size) = nullptr;
-static void *(*_MemRealloc)(void *ptr, unsigned int size) = nullptr;
-static void (*_MemFree)(void *ptr) = nullptr;
-static void (*_SetTraceLogCallback)(TraceLogCallback callback) = nullptr;
-static void (*_SetLoadFileDataCallback)(LoadFileDataCallback callback) = nullptr;
-static void (*_SetSaveFileDataCallback)(SaveFileDataCallback callback) = nullptr;
-static void (*_SetLoadFileTextCallback)(LoadFileTextCallback callback) = nullptr;
-static void (*_SetSaveFileTextCallback)(SaveFileTextCallback callback) = nullptr;
-static unsigned char *(*_LoadFileData)(char *fileName, int *dataSize) = nullptr;
-static void (*_UnloadFileData)(unsigned char *data) = nullptr;
-static bool (*_SaveFileData)(char *fileName, void *data, int dataSize) = nullptr;
-static bool (*_ExportDataAsCode)(unsigned char *data, int dataSize, char *fileName) = nullptr;
-static char *(*_LoadFileText)(char *fileName) = nullptr;
-static void (*_UnloadFileText)(char *text) = nullptr;
-static bool (*_SaveFileText)(char *fileName, char *text) = nullptr;
-static bool (*_FileExists)(char *fileName) = nullptr;
-static bool (*_DirectoryExists)(char *dirPath) = nullptr;
-static bool (*_IsFileExtension)(char *fileName, char *ext) = nullptr;
-static int (*_GetFileLength)(char *fileName) = nullptr;
-static char *(*_GetFileExtension)(char *fileName) = nullptr;
-static char *(*_GetFileName)(char *filePath) = nullptr;
-static char *(*_GetFileNameWithoutExt)(char *filePath) = nullptr;
-static char *(*_GetDirectoryPath)(char *filePath) = nullptr;
-static char *(*_GetPrevDirectoryPath)(char *dirPath) = nullptr;
-static char *(*_GetWorkingDirectory)() = nullptr;
-static char *(*_GetApplicationDirectory)() = nullptr;
-static bool (*_ChangeDirectory)(char *dir) = nullptr;
-static bool (*_IsPathFile)(char *path) = nullptr;
-static FilePathList (*_LoadDirectoryFiles)(char *dirPath) = nullptr;
-static FilePathList (*_LoadDirectoryFilesEx)(char *basePath, char *filter, bool scanSubdirs) = nullptr;
-static void (*_UnloadDirectoryFiles)(FilePathList files) = nullptr;
-static bool (*_IsFileDropped)() = nullptr;
-static FilePathList (*_LoadDroppedFiles)() = nullptr;
-static void (*_UnloadDroppedFiles)(FilePathList files) = nullptr;
-static long (*_GetFileModTime)(char *fileName) = nullptr;
-static unsigned char *(*_CompressData)(unsigned char *data, int dataSize, int *compDataSize) = nullptr;
-static unsigned char *(*_DecompressData)(unsigned char *compData, int compDataSize, int *dataSize) = nullptr;
-static char *(*_EncodeDataBase64)(unsigned char *data, int dataSize, int *outputSize) = nullptr;
-static unsigned char *(*_DecodeDataBase64)(unsigned char *data, int *outputSize) = nullptr;
-static AutomationEventList (*_LoadAutomationEventList)(char *fileName) = nullptr;
-static void (*_UnloadAutomationEventList)(AutomationEventList *list) = nullptr;
-static bool (*_ExportAutomationEventList)(AutomationEventList list, char *fileName) = nullptr;
-static void (*_SetAutomationEventList)(AutomationEventList *list) = nullptr;
-static void (*_SetAutomationEventBaseFrame)(int frame) = nullptr;
-static void (*_StartAutomationEventRecording)() = nullptr;
-static void (*_StopAutomationEventRecording)() = nullptr;
-static void (*_PlayAutomationEvent)(AutomationEvent event) = nullptr;
-static bool (*_IsKeyPressed)(int key) = nullptr;
-static bool (*_IsKeyPressedRepeat)(int key) = nullptr;
-static bool (*_IsKeyDown)(int key) = nullptr;
-static bool (*_IsKeyReleased)(int key) = nullptr;
-static bool (*_IsKeyUp)(int key) = nullptr;
-static int (*_GetKeyPressed)() = nullptr;
-static int (*_GetCharPressed)() = nullptr;
-static void (*_SetExitKey)(int key) = nullptr;
-static bool (*_IsGamepadAvailable)(int gamepad) = nullptr;
-static char *(*_GetGamepadName)(int gamepad) = nullptr;
-static bool (*_IsGamepadButtonPressed)(int gamepad, int button) = nullptr;
-static bool (*_IsGamepadButtonDown)(int gamepad, int button) = nullptr;
-static bool (*_IsGamepadButtonReleased)(int gamepad, int button) = nullptr;
-static bool (*_IsGamepadButtonUp)(int gamepad, int button) = nullptr;
-static int (*_GetGamepadButtonPressed)() = nullptr;
-static int (*_GetGamepadAxisCount)(int gamepad) = nullptr;
-static float (*_GetGamepadAxisMovement)(int gamepad, int axis) = nullptr;
-static int (*_SetGamepadMappings)(char *mappings) = nullptr;
-static bool (*_IsMouseButtonPressed)(int button) = nullptr;
-static bool (*_IsMouseButtonDown)(int button) = nullptr;
-static bool (*_IsMouseButtonReleased)(int button) = nullptr;
-static bool (*_IsMouseButtonUp)(int button) = nullptr;
-static int (*_GetMouseX)() = nullptr;
-static int (*_GetMouseY)() = nullptr;
-static Vector2 (*_GetMousePosition)() = nullptr;
-static Vector2 (*_GetMouseDelta)() = nullptr;
-static void (*_SetMousePosition)(int x, int y) = nullptr;
-static void (*_SetMouseOffset)(int offsetX, int offsetY) = nullptr;
-static void (*_SetMouseScale)(float scaleX, float scaleY) = nullptr;
-static float (*_GetMouseWheelMove)() = nullptr;
-static Vector2 (*_GetMouseWheelMoveV)() = nullptr;
-static void (*_SetMouseCursor)(int cursor) = nullptr;
-static int (*_GetTouchX)() = nullptr;
-static int (*_GetTouchY)() = nullptr;
-static Vector2 (*_GetTouchPosition)(int index) = nullptr;
-static int (*_GetTouchPointId)(int index) = nullptr;
-static int (*_GetTouchPointCount)() = nullptr;
-static void (*_SetGesturesEnabled)(unsigned int flags) = nullptr;
-static bool (*_IsGestureDetected)(unsigned int gesture) = nullptr;
-static int (*_GetGestureDetected)() = nullptr;
-static float (*_GetGestureHoldDuration)() = nullptr;
-static Vector2 (*_GetGestureDragVector)() = nullptr;
-static float (*_GetGestureDragAngle)() = nullptr;
-static Vector2 (*_GetGesturePinchVector)() = nullptr;
-static float (*_GetGesturePinchAngle)() = nullptr;
-static void (*_UpdateCamera)(Camera3D *camera, int mode) = nullptr;
-static void (*_UpdateCameraPro)(Camera3D *camera, Vector3 movement, Vector3 rotation, float zoom) = nullptr;
-static void (*_SetShapesTexture)(Texture texture, RRectangle source) = nullptr;
-static void (*_DrawPixel)(int posX, int posY, uint32_t color) = nullptr;
-static void (*_DrawPixelV)(Vector2 position, uint32_t color) = nullptr;
-static void (*_DrawLine)(int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color) = nullptr;
-static void (*_DrawLineV)(Vector2 startPos, Vector2 endPos, uint32_t color) = nullptr;
-static void (*_DrawLineEx)(Vector2 startPos, Vector2 endPos, float thick, uint32_t color) = nullptr;
-static void (*_DrawLineStrip)(Vector2 *points, int pointCount, uint32_t color) = nullptr;
-static void (*_DrawLineBezier)(Vector2 startPos, Vector2 endPos, float thick, uint32_t color) = nullptr;
-static void (*_DrawCircle)(int centerX, int centerY, float radius, uint32_t color) = nullptr;
-static void (*_DrawCircleSector)(Vector2 center, float radius, float startAngle, float endAngle, int segments, uint32_t color) = nullptr;
-static void (*_DrawCircleSectorLines)(Vector2 center, float radius, float startAngle, float endAngle, int segments, uint32_t color) = nullptr;
-static void (*_DrawCircleGradient)(int centerX, int centerY, float radius, uint32_t color1, uint32_t color2) = nullptr;
-static void (*_DrawCircleV)(Vector2 center, float radius, uint32_t color) = nullptr;
-static void (*_DrawCircleLines)(int centerX, int centerY, float radius, uint32_t color) = nullptr;
-static void (*_DrawCircleLinesV)(Vector2 center, float radius, uint32_t color) = nullptr;
-static void (*_DrawEllipse)(int centerX, int centerY, float radiusH, float radiusV, uint32_t color) = nullptr;
-static void (*_DrawEllipseLines)(int centerX, int centerY, float radiusH, float radiusV, uint32_t color) = nullptr;
-static void (*_DrawRing)(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color) = nullptr;
-static void (*_DrawRingLines)(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color) = nullptr;
-static void (*_DrawRectangle)(int posX, int posY, int width, int height, uint32_t color) = nullptr;
-static void (*_DrawRectangleV)(Vector2 position, Vector2 size, uint32_t color) = nullptr;
-static void (*_DrawRectangleRec)(RRectangle rec, uint32_t color) = nullptr;
-static void (*_DrawRectanglePro)(RRectangle rec, Vector2 origin, float rotation, uint32_t color) = nullptr;
-static void (*_DrawRectangleGradientV)(int posX, int posY, int width, int height, uint32_t color1, uint32_t color2) = nullptr;
-static void (*_DrawRectangleGradientH)(int posX, int posY, int width, int height, uint32_t color1, uint32_t color2) = nullptr;
-static void (*_DrawRectangleGradientEx)(RRectangle rec, uint32_t col1, uint32_t col2, uint32_t col3, uint32_t col4) = nullptr;
-static void (*_DrawRectangleLines)(int posX, int posY, int width, int height, uint32_t color) = nullptr;
-static void (*_DrawRectangleLinesEx)(RRectangle rec, float lineThick, uint32_t color) = nullptr;
-static void (*_DrawRectangleRounded)(RRectangle rec, float roundness, int segments, uint32_t color) = nullptr;
-static void (*_DrawRectangleRoundedLines)(RRectangle rec, float roundness, int segments, float lineThick, uint32_t color) = nullptr;
-static void (*_DrawTriangle)(Vector2 v1, Vector2 v2, Vector2 v3, uint32_t color) = nullptr;
-static void (*_DrawTriangleLines)(Vector2 v1, Vector2 v2, Vector2 v3, uint32_t color) = nullptr;
-static void (*_DrawTriangleFan)(Vector2 *points, int pointCount, uint32_t color) = nullptr;
-static void (*_DrawTriangleStrip)(Vector2 *points, int pointCount, uint32_t color) = nullptr;
-static void (*_DrawPoly)(Vector2 center, int sides, float radius, float rotation, uint32_t color) = nullptr;
-static void (*_DrawPolyLines)(Vector2 center, int sides, float radius, float rotation, uint32_t color) = nullptr;
-static void (*_DrawPolyLinesEx)(Vector2 center, int sides, float radius, float rotation, float lineThick, uint32_t color) = nullptr;
-static void (*_DrawSplineLinear)(Vector2 *points, int pointCount, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineBasis)(Vector2 *points, int pointCount, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineCatmullRom)(Vector2 *points, int pointCount, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineBezierQuadratic)(Vector2 *points, int pointCount, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineBezierCubic)(Vector2 *points, int pointCount, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineSegmentLinear)(Vector2 p1, Vector2 p2, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineSegmentBasis)(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineSegmentCatmullRom)(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineSegmentBezierQuadratic)(Vector2 p1, Vector2 c2, Vector2 p3, float thick, uint32_t color) = nullptr;
-static void (*_DrawSplineSegmentBezierCubic)(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, uint32_t color) = nullptr;
-static Vector2 (*_GetSplinePointLinear)(Vector2 startPos, Vector2 endPos, float t) = nullptr;
-static Vector2 (*_GetSplinePointBasis)(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) = nullptr;
-static Vector2 (*_GetSplinePointCatmullRom)(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) = nullptr;
-static Vector2 (*_GetSplinePointBezierQuad)(Vector2 p1, Vector2 c2, Vector2 p3, float t) = nullptr;
-static Vector2 (*_GetSplinePointBezierCubic)(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float t) = nullptr;
-static bool (*_CheckCollisionRecs)(RRectangle rec1, RRectangle rec2) = nullptr;
-static bool (*_CheckCollisionCircles)(Vector2 center1, float radius1, Vector2 center2, float radius2) = nullptr;
-static bool (*_CheckCollisionCircleRec)(Vector2 center, float radius, RRectangle rec) = nullptr;
-static bool (*_CheckCollisionPointRec)(Vector2 point, RRectangle rec) = nullptr;
-static bool (*_CheckCollisionPointCircle)(Vector2 point, Vector2 center, float radius) = nullptr;
-static bool (*_CheckCollisionPointTriangle)(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3) = nullptr;
-static bool (*_CheckCollisionPointPoly)(Vector2 point, Vector2 *points, int pointCount) = nullptr;
-static bool (*_CheckCollisionLines)(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint) = nullptr;
-static bool (*_CheckCollisionPointLine)(Vector2 point, Vector2 p1, Vector2 p2, int threshold) = nullptr;
-static RRectangle (*_GetCollisionRec)(RRectangle rec1, RRectangle rec2) = nullptr;
-static Image (*_LoadImage)(char *fileName) = nullptr;
-static Image (*_LoadImageRaw)(char *fileName, int width, int height, int format, int headerSize) = nullptr;
-static Image (*_LoadImageSvg)(char *fileNameOrString, int width, int height) = nullptr;
-static Image (*_LoadImageAnim)(char *fileName, int *frames) = nullptr;
-static Image (*_LoadImageFromMemory)(char *fileType, unsigned char *fileData, int dataSize) = nullptr;
-static Image (*_LoadImageFromTexture)(Texture texture) = nullptr;
-static Image (*_LoadImageFromScreen)() = nullptr;
-static bool (*_IsImageReady)(Image image) = nullptr;
-static void (*_UnloadImage)(Image image) = nullptr;
-static bool (*_ExportImage)(Image image, char *fileName) = nullptr;
-static unsigned char *(*_ExportImageToMemory)(Image image, char *fileType, int *fileSize) = nullptr;
-static bool (*_ExportImageAsCode)(Image image, char *fileName) = nullptr;
-static Image (*_GenImageColor)(int width, int height, uint32_t color) = nullptr;
-static Image (*_GenImageGradientLinear)(int width, int height, int direction, uint32_t start, uint32_t end) = nullptr;
-static Image (*_GenImageGradientRadial)(int width, int height, float density, uint32_t inner, uint32_t outer) = nullptr;
-static Image (*_GenImageGradientSquare)(int width, int height, float density, uint32_t inner, uint32_t outer) = nullptr;
-static Image (*_GenImageChecked)(int width, int height, int checksX, int checksY, uint32_t col1, uint32_t col2) = nullptr;
-static Image (*_GenImageWhiteNoise)(int width, int height, float factor) = nullptr;
-static Image (*_GenImagePerlinNoise)(int width, int height, int offsetX, int offsetY, float scale) = nullptr;
-static Image (*_GenImageCellular)(int width, int height, int tileSize) = nullptr;
-static Image (*_GenImageText)(int width, int height, char *text) = nullptr;
-static Image (*_ImageCopy)(Image image) = nullptr;
-static Image (*_ImageFromImage)(Image image, RRectangle rec) = nullptr;
-static Image (*_ImageText)(char *text, int fontSize, uint32_t color) = nullptr;
-static Image (*_ImageTextEx)(RFont font, char *text, float fontSize, float spacing, uint32_t tint) = nullptr;
-static void (*_ImageFormat)(Image *image, int newFormat) = nullptr;
-static void (*_ImageToPOT)(Image *image, uint32_t fill) = nullptr;
-static void (*_ImageCrop)(Image *image, RRectangle crop) = nullptr;
-static void (*_ImageAlphaCrop)(Image *image, float threshold) = nullptr;
-static void (*_ImageAlphaClear)(Image *image, uint32_t color, float threshold) = nullptr;
-static void (*_ImageAlphaMask)(Image *image, Image alphaMask) = nullptr;
-static void (*_ImageAlphaPremultiply)(Image *image) = nullptr;
-static void (*_ImageBlurGaussian)(Image *image, int blurSize) = nullptr;
-static void (*_ImageResize)(Image *image, int newWidth, int newHeight) = nullptr;
-static void (*_ImageResizeNN)(Image *image, int newWidth, int newHeight) = nullptr;
-static void (*_ImageResizeCanvas)(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, uint32_t fill) = nullptr;
-static void (*_ImageMipmaps)(Image *image) = nullptr;
-static void (*_ImageDither)(Image *image, int rBpp, int gBpp, int bBpp, int aBpp) = nullptr;
-static void (*_ImageFlipVertical)(Image *image) = nullptr;
-static void (*_ImageFlipHorizontal)(Image *image) = nullptr;
-static void (*_ImageRotate)(Image *image, int degrees) = nullptr;
-static void (*_ImageRotateCW)(Image *image) = nullptr;
-static void (*_ImageRotateCCW)(Image *image) = nullptr;
-static void (*_ImageColorTint)(Image *image, uint32_t color) = nullptr;
-static void (*_ImageColorInvert)(Image *image) = nullptr;
-static void (*_ImageColorGrayscale)(Image *image) = nullptr;
-static void (*_ImageColorContrast)(Image *image, float contrast) = nullptr;
-static void (*_ImageColorBrightness)(Image *image, int brightness) = nullptr;
-static void (*_ImageColorReplace)(Image *image, uint32_t color, uint32_t replace) = nullptr;
-static uint32_t *(*_LoadImageColors)(Image image) = nullptr;
-static uint32_t *(*_LoadImagePalette)(Image image, int maxPaletteSize, int *colorCount) = nullptr;
-static void (*_UnloadImageColors)(uint32_t *colors) = nullptr;
-static void (*_UnloadImagePalette)(uint32_t *colors) = nullptr;
-static RRectangle (*_GetImageAlphaBorder)(Image image, float threshold) = nullptr;
-static uint32_t (*_GetImageColor)(Image image, int x, int y) = nullptr;
-static void (*_ImageClearBackground)(Image *dst, uint32_t color) = nullptr;
-static void (*_ImageDrawPixel)(Image *dst, int posX, int posY, uint32_t color) = nullptr;
-static void (*_ImageDrawPixelV)(Image *dst, Vector2 position, uint32_t color) = nullptr;
-static void (*_ImageDrawLine)(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color) = nullptr;
-static void (*_ImageDrawLineV)(Image *dst, Vector2 start, Vector2 end, uint32_t color) = nullptr;
-static void (*_ImageDrawCircle)(Image *dst, int centerX, int centerY, int radius, uint32_t color) = nullptr;
-static void (*_ImageDrawCircleV)(Image *dst, Vector2 center, int radius, uint32_t color) = nullptr;
-static void (*_ImageDrawCircleLines)(Image *dst, int centerX, int centerY, int radius, uint32_t color) = nullptr;
-static void (*_ImageDrawCircleLinesV)(Image *dst, Vector2 center, int radius, uint32_t color) = nullptr;
-static void (*_ImageDrawRectangle)(Image *dst, int posX, int posY, int width, int height, uint32_t color) = nullptr;
-static void (*_ImageDrawRectangleV)(Image *dst, Vector2 position, Vector2 size, uint32_t color) = nullptr;
-static void (*_ImageDrawRectangleRec)(Image *dst, RRectangle rec, uint32_t color) = nullptr;
-static void (*_ImageDrawRectangleLines)(Image *dst, RRectangle rec, int thick, uint32_t color) = nullptr;
-static void (*_ImageDraw)(Image *dst, Image src, RRectangle srcRec, RRectangle dstRec, uint32_t tint) = nullptr;
-static void (*_ImageDrawText)(Image *dst, char *text, int posX, int posY, int fontSize, uint32_t color) = nullptr;
-static void (*_ImageDrawTextEx)(Image *dst, RFont font, char *text, Vector2 position, float fontSize, float spacing, uint32_t tint) = nullptr;
-static Texture (*_LoadTexture)(char *fileName) = nullptr;
-static Texture (*_LoadTextureFromImage)(Image image) = nullptr;
-static Texture (*_LoadTextureCubemap)(Image image, int layout) = nullptr;
-static RenderTexture (*_LoadRenderTexture)(int width, int height) = nullptr;
-static bool (*_IsTextureReady)(Texture texture) = nullptr;
-static void (*_UnloadTexture)(Texture texture) = nullptr;
-static bool (*_IsRenderTextureReady)(RenderTexture target) = nullptr;
-static void (*_UnloadRenderTexture)(RenderTexture target) = nullptr;
-static void (*_UpdateTexture)(Texture texture, void *pixels) = nullptr;
-static void (*_UpdateTextureRec)(Texture texture, RRectangle rec, void *pixels) = nullptr;
-static void (*_GenTextureMipmaps)(Texture *texture) = nullptr;
-static void (*_SetTextureFilter)(Texture texture, int filter) = nullptr;
-static void (*_SetTextureWrap)(Texture texture, int wrap) = nullptr;
-static void (*_DrawTexture)(Texture texture, int posX, int posY, uint32_t tint) = nullptr;
-static void (*_DrawTextureV)(Texture texture, Vector2 position, uint32_t tint) = nullptr;
-static void (*_DrawTextureEx)(Texture texture, Vector2 position, float rotation, float scale, uint32_t tint) = nullptr;
-static void (*_DrawTextureRec)(Texture texture, RRectangle source, Vector2 position, uint32_t tint) = nullptr;
-static void (*_DrawTexturePro)(Texture texture, RRectangle source, RRectangle dest, Vector2 origin, float rotation, uint32_t tint) = nullptr;
-static void (*_DrawTextureNPatch)(Texture texture, NPatchInfo nPatchInfo, RRectangle dest, Vector2 origin, float rotation, uint32_t tint) = nullptr;
-static uint32_t (*_Fade)(uint32_t color, float alpha) = nullptr;
-static int (*_ColorToInt)(uint32_t color) = nullptr;
-static Vector4 (*_ColorNormalize)(uint32_t color) = nullptr;
-static uint32_t (*_ColorFromNormalized)(Vector4 normalized) = nullptr;
-static Vector3 (*_ColorToHSV)(uint32_t color) = nullptr;
-static uint32_t (*_ColorFromHSV)(float hue, float saturation, float value) = nullptr;
-static uint32_t (*_ColorTint)(uint32_t color, uint32_t tint) = nullptr;
-static uint32_t (*_ColorBrightness)(uint32_t color, float factor) = nullptr;
-static uint32_t (*_ColorContrast)(uint32_t color, float contrast) = nullptr;
-static uint32_t (*_ColorAlpha)(uint32_t color, float alpha) = nullptr;
-static uint32_t (*_ColorAlphaBlend)(uint32_t dst, uint32_t src, uint32_t tint) = nullptr;
-static uint32_t (*_GetColor)(unsigned int hexValue) = nullptr;
-static uint32_t (*_GetPixelColor)(void *srcPtr, int format) = nullptr;
-static void (*_SetPixelColor)(void *dstPtr, uint32_t color, int format) = nullptr;
-static int (*_GetPixelDataSize)(int width, int height, int format) = nullptr;
-static RFont (*_GetFontDefault)() = nullptr;
-static RFont (*_LoadFont)(char *fileName) = nullptr;
-static RFont (*_LoadFontEx)(char *fileName, int fontSize, int *codepoints, int codepointCount) = nullptr;
-static RFont (*_LoadFontFromImage)(Image image, uint32_t key, int firstChar) = nullptr;
-static RFont (*_LoadFontFromMemory)(char *fileType, unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount) = nullptr;
-static bool (*_IsFontReady)(RFont font) = nullptr;
-static GlyphInfo *(*_LoadFontData)(unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type) = nullptr;
-static Image (*_GenImageFontAtlas)(GlyphInfo *glyphs, RRectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod) = nullptr;
-static void (*_UnloadFontData)(GlyphInfo *glyphs, int glyphCount) = nullptr;
-static void (*_UnloadFont)(RFont font) = nullptr;
-static bool (*_ExportFontAsCode)(RFont font, char *fileName) = nullptr;
-static void (*_DrawFPS)(int posX, int posY) = nullptr;
-static void (*_DrawText)(char *text, int posX, int posY, int fontSize, uint32_t color) = nullptr;
-static void (*_DrawTextEx)(RFont font, char *text, Vector2 position, float fontSize, float spacing, uint32_t tint) = nullptr;
-static void (*_DrawTextPro)(RFont font, char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, uint32_t tint) = nullptr;
-static void (*_DrawTextCodepoint)(RFont font, int codepoint, Vector2 position, float fontSize, uint32_t tint) = nullptr;
-static void (*_DrawTextCodepoints)(RFont font, int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, uint32_t tint) = nullptr;
-static void (*_SetTextLineSpacing)(int spacing) = nullptr;
-static int (*_MeasureText)(char *text, int fontSize) = nullptr;
-static Vector2 (*_MeasureTextEx)(RFont font, char *text, float fontSize, float spacing) = nullptr;
-static int (*_GetGlyphIndex)(RFont font, int codepoint) = nullptr;
-static GlyphInfo (*_GetGlyphInfo)(RFont font, int codepoint) = nullptr;
-static RRectangle (*_GetGlyphAtlasRec)(RFont font, int codepoint) = nullptr;
-static char *(*_LoadUTF8)(int *codepoints, int length) = nullptr;
-static void (*_UnloadUTF8)(char *text) = nullptr;
-static int *(*_LoadCodepoints)(char *text, int *count) = nullptr;
-static void (*_UnloadCodepoints)(int *codepoints) = nullptr;
-static int (*_GetCodepointCount)(char *text) = nullptr;
-static int (*_GetCodepoint)(char *text, int *codepointSize) = nullptr;
-static int (*_GetCodepointNext)(char *text, int *codepointSize) = nullptr;
-static int (*_GetCodepointPrevious)(char *text, int *codepointSize) = nullptr;
-static char *(*_CodepointToUTF8)(int codepoint, int *utf8Size) = nullptr;
-static int (*_TextCopy)(char *dst, char *src) = nullptr;
-static bool (*_TextIsEqual)(char *text1, char *text2) = nullptr;
-static unsigned int (*_TextLength)(char *text) = nullptr;
-static char *(*_TextFormat)(char *text, ...) = nullptr;
-static char *(*_TextSubtext)(char *text, int position, int length) = nullptr;
-static char *(*_TextReplace)(char *text, char *replace, char *by) = nullptr;
-static char *(*_TextInsert)(char *text, char *insert, int position) = nullptr;
-static char *(*_TextJoin)(char **textList, int count, char *delimiter) = nullptr;
-static char **(*_TextSplit)(char *text, char delimiter, int *count) = nullptr;
-static void (*_TextAppend)(char *text, char *append, int *position) = nullptr;
-static int (*_TextFindIndex)(char *text, char *find) = nullptr;
-static char *(*_TextToUpper)(char *text) = nullptr;
-static char *(*_TextToLower)(char *text) = nullptr;
-static char *(*_TextToPascal)(char *text) = nullptr;
-static int (*_TextToInteger)(char *text) = nullptr;
-static void (*_DrawLine3D)(Vector3 startPos, Vector3 endPos, uint32_t color) = nullptr;
-static void (*_DrawPoint3D)(Vector3 position, uint32_t color) = nullptr;
-static void (*_DrawCircle3D)(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, uint32_t color) = nullptr;
-static void (*_DrawTriangle3D)(Vector3 v1, Vector3 v2, Vector3 v3, uint32_t color) = nullptr;
-static void (*_DrawTriangleStrip3D)(Vector3 *points, int pointCount, uint32_t color) = nullptr;
-static void (*_DrawCube)(Vector3 position, float width, float height, float length, uint32_t color) = nullptr;
-static void (*_DrawCubeV)(Vector3 position, Vector3 size, uint32_t color) = nullptr;
-static void (*_DrawCubeWires)(Vector3 position, float width, float height, float length, uint32_t color) = nullptr;
-static void (*_DrawCubeWiresV)(Vector3 position, Vector3 size, uint32_t color) = nullptr;
-static void (*_DrawSphere)(Vector3 centerPos, float radius, uint32_t color) = nullptr;
-static void (*_DrawSphereEx)(Vector3 centerPos, float radius, int rings, int slices, uint32_t color) = nullptr;
-static void (*_DrawSphereWires)(Vector3 centerPos, float radius, int rings, int slices, uint32_t color) = nullptr;
-static void (*_DrawCylinder)(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color) = nullptr;
-static void (*_DrawCylinderEx)(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, uint32_t color) = nullptr;
-static void (*_DrawCylinderWires)(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color) = nullptr;
-static void (*_DrawCylinderWiresEx)(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, uint32_t color) = nullptr;
-static void (*_DrawCapsule)(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, uint32_t color) = nullptr;
-static void (*_DrawCapsuleWires)(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, uint32_t color) = nullptr;
-static void (*_DrawPlane)(Vector3 centerPos, Vector2 size, uint32_t color) = nullptr;
-static void (*_DrawRay)(Ray ray, uint32_t color) = nullptr;
-static void (*_DrawGrid)(int slices, float spacing) = nullptr;
-static Model (*_LoadModel)(char *fileName) = nullptr;
-static Model (*_LoadModelFromMesh)(Mesh mesh) = nullptr;
-static bool (*_IsModelReady)(Model model) = nullptr;
-static void (*_UnloadModel)(Model model) = nullptr;
-static BoundingBox (*_GetModelBoundingBox)(Model model) = nullptr;
-static void (*_DrawModel)(Model model, Vector3 position, float scale, uint32_t tint) = nullptr;
-static void (*_DrawModelEx)(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, uint32_t tint) = nullptr;
-static void (*_DrawModelWires)(Model model, Vector3 position, float scale, uint32_t tint) = nullptr;
-static void (*_DrawModelWiresEx)(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, uint32_t tint) = nullptr;
-static void (*_DrawBoundingBox)(BoundingBox box, uint32_t color) = nullptr;
-static void (*_DrawBillboard)(Camera3D camera, Texture texture, Vector3 position, float size, uint32_t tint) = nullptr;
-static void (*_DrawBillboardRec)(Camera3D camera, Texture texture, RRectangle source, Vector3 position, Vector2 size, uint32_t tint) = nullptr;
-static void (*_DrawBillboardPro)(Camera3D camera, Texture texture, RRectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, uint32_t tint) = nullptr;
-static void (*_UploadMesh)(Mesh *mesh, bool dynamic) = nullptr;
-static void (*_UpdateMeshBuffer)(Mesh mesh, int index, void *data, int dataSize, int offset) = nullptr;
-static void (*_UnloadMesh)(Mesh mesh) = nullptr;
-static void (*_DrawMesh)(Mesh mesh, Material material, Matrix transform) = nullptr;
-static void (*_DrawMeshInstanced)(Mesh mesh, Material material, Matrix *transforms, int instances) = nullptr;
-static bool (*_ExportMesh)(Mesh mesh, char *fileName) = nullptr;
-static BoundingBox (*_GetMeshBoundingBox)(Mesh mesh) = nullptr;
-static void (*_GenMeshTangents)(Mesh *mesh) = nullptr;
-static Mesh (*_GenMeshPoly)(int sides, float radius) = nullptr;
-static Mesh (*_GenMeshPlane)(float width, float length, int resX, int resZ) = nullptr;
-static Mesh (*_GenMeshCube)(float width, float height, float length) = nullptr;
-static Mesh (*_GenMeshSphere)(float radius, int rings, int slices) = nullptr;
-static Mesh (*_GenMeshHemiSphere)(float radius, int rings, int slices) = nullptr;
-static Mesh (*_GenMeshCylinder)(float radius, float height, int slices) = nullptr;
-static Mesh (*_GenMeshCone)(float radius, float height, int slices) = nullptr;
-static Mesh (*_GenMeshTorus)(float radius, float size, int radSeg, int sides) = nullptr;
-static Mesh (*_GenMeshKnot)(float radius, float size, int radSeg, int sides) = nullptr;
-static Mesh (*_GenMeshHeightmap)(Image heightmap, Vector3 size) = nullptr;
-static Mesh (*_GenMeshCubicmap)(Image cubicmap, Vector3 cubeSize) = nullptr;
-static Material *(*_LoadMaterials)(char *fileName, int *materialCount) = nullptr;
-static Material (*_LoadMaterialDefault)() = nullptr;
-static bool (*_IsMaterialReady)(Material material) = nullptr;
-static void (*_UnloadMaterial)(Material material) = nullptr;
-static void (*_SetMaterialTexture)(Material *material, int mapType, Texture texture) = nullptr;
-static void (*_SetModelMeshMaterial)(Model *model, int meshId, int materialId) = nullptr;
-static ModelAnimation *(*_LoadModelAnimations)(char *fileName, int *animCount) = nullptr;
-static void (*_UpdateModelAnimation)(Model model, ModelAnimation anim, int frame) = nullptr;
-static void (*_UnloadModelAnimation)(ModelAnimation anim) = nullptr;
-static void (*_UnloadModelAnimations)(ModelAnimation *animations, int animCount) = nullptr;
-static bool (*_IsModelAnimationValid)(Model model, ModelAnimation anim) = nullptr;
-static bool (*_CheckCollisionSpheres)(Vector3 center1, float radius1, Vector3 center2, float radius2) = nullptr;
-static bool (*_CheckCollisionBoxes)(BoundingBox box1, BoundingBox box2) = nullptr;
-static bool (*_CheckCollisionBoxSphere)(BoundingBox box, Vector3 center, float radius) = nullptr;
-static RayCollision (*_GetRayCollisionSphere)(Ray ray, Vector3 center, float radius) = nullptr;
-static RayCollision (*_GetRayCollisionBox)(Ray ray, BoundingBox box) = nullptr;
-static RayCollision (*_GetRayCollisionMesh)(Ray ray, Mesh mesh, Matrix transform) = nullptr;
-static RayCollision (*_GetRayCollisionTriangle)(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3) = nullptr;
-static RayCollision (*_GetRayCollisionQuad)(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4) = nullptr;
-static void (*_InitAudioDevice)() = nullptr;
-static void (*_CloseAudioDevice)() = nullptr;
-static bool (*_IsAudioDeviceReady)() = nullptr;
-static void (*_SetMasterVolume)(float volume) = nullptr;
-static float (*_GetMasterVolume)() = nullptr;
-static Wave (*_LoadWave)(char *fileName) = nullptr;
-static Wave (*_LoadWaveFromMemory)(char *fileType, unsigned char *fileData, int dataSize) = nullptr;
-static bool (*_IsWaveReady)(Wave wave) = nullptr;
-static RSound (*_LoadSound)(char *fileName) = nullptr;
-static RSound (*_LoadSoundFromWave)(Wave wave) = nullptr;
-static RSound (*_LoadSoundAlias)(RSound source) = nullptr;
-static bool (*_IsSoundReady)(RSound sound) = nullptr;
-static void (*_UpdateSound)(RSound sound, void *data, int sampleCount) = nullptr;
-static void (*_UnloadWave)(Wave wave) = nullptr;
-static void (*_UnloadSound)(RSound sound) = nullptr;
-static void (*_UnloadSoundAlias)(RSound alias) = nullptr;
-static bool (*_ExportWave)(Wave wave, char *fileName) = nullptr;
-static bool (*_ExportWaveAsCode)(Wave wave, char *fileName) = nullptr;
-static void (*_PlaySound)(RSound sound) = nullptr;
-static void (*_StopSound)(RSound sound) = nullptr;
-static void (*_PauseSound)(RSound sound) = nullptr;
-static void (*_ResumeSound)(RSound sound) = nullptr;
-static bool (*_IsSoundPlaying)(RSound sound) = nullptr;
-static void (*_SetSoundVolume)(RSound sound, float volume) = nullptr;
-static void (*_SetSoundPitch)(RSound sound, float pitch) = nullptr;
-static void (*_SetSoundPan)(RSound sound, float pan) = nullptr;
-static Wave (*_WaveCopy)(Wave wave) = nullptr;
-static void (*_WaveCrop)(Wave *wave, int initSample, int finalSample) = nullptr;
-static void (*_WaveFormat)(Wave *wave, int sampleRate, int sampleSize, int channels) = nullptr;
-static float *(*_LoadWaveSamples)(Wave wave) = nullptr;
-static void (*_UnloadWaveSamples)(float *samples) = nullptr;
-static Music (*_LoadMusicStream)(char *fileName) = nullptr;
-static Music (*_LoadMusicStreamFromMemory)(char *fileType, unsigned char *data, int dataSize) = nullptr;
-static bool (*_IsMusicReady)(Music music) = nullptr;
-static void (*_UnloadMusicStream)(Music music) = nullptr;
-static void (*_PlayMusicStream)(Music music) = nullptr;
-static bool (*_IsMusicStreamPlaying)(Music music) = nullptr;
-static void (*_UpdateMusicStream)(Music music) = nullptr;
-static void (*_StopMusicStream)(Music music) = nullptr;
-static void (*_PauseMusicStream)(Music music) = nullptr;
-static void (*_ResumeMusicStream)(Music music) = nullptr;
-static void (*_SeekMusicStream)(Music music, float position) = nullptr;
-static void (*_SetMusicVolume)(Music music, float volume) = nullptr;
-static void (*_SetMusicPitch)(Music music, float pitch) = nullptr;
-static void (*_SetMusicPan)(Music music, float pan) = nullptr;
-static float (*_GetMusicTimeLength)(Music music) = nullptr;
-static float (*_GetMusicTimePlayed)(Music music) = nullptr;
-static AudioStream (*_LoadAudioStream)(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels) = nullptr;
-static bool (*_IsAudioStreamReady)(AudioStream stream) = nullptr;
-static void (*_UnloadAudioStream)(AudioStream stream) = nullptr;
-static void (*_UpdateAudioStream)(AudioStream stream, void *data, int frameCount) = nullptr;
-static bool (*_IsAudioStreamProcessed)(AudioStream stream) = nullptr;
-static void (*_PlayAudioStream)(AudioStream stream) = nullptr;
-static void (*_PauseAudioStream)(AudioStream stream) = nullptr;
-static void (*_ResumeAudioStream)(AudioStream stream) = nullptr;
-static bool (*_IsAudioStreamPlaying)(AudioStream stream) = nullptr;
-static void (*_StopAudioStream)(AudioStream stream) = nullptr;
-static void (*_SetAudioStreamVolume)(AudioStream stream, float volume) = nullptr;
-static void (*_SetAudioStreamPitch)(AudioStream stream, float pitch) = nullptr;
-static void (*_SetAudioStreamPan)(AudioStream stream, float pan) = nullptr;
-static void (*_SetAudioStreamBufferSizeDefault)(int size) = nullptr;
-static void (*_SetAudioStreamCallback)(AudioStream stream, AudioCallback callback) = nullptr;
-static void (*_AttachAudioStreamProcessor)(AudioStream stream, AudioCallback processor) = nullptr;
-static void (*_DetachAudioStreamProcessor)(AudioStream stream, AudioCallback processor) = nullptr;
-static void (*_AttachAudioMixedProcessor)(AudioCallback processor) = nullptr;
-static void (*_DetachAudioMixedProcessor)(AudioCallback processor) = nullptr;
+RAYLIB64_FUNCTION(void, InitWindow, (int width, int height, char *title));
+RAYLIB64_FUNCTION(void, CloseWindow, ());
+RAYLIB64_FUNCTION(bool, WindowShouldClose, ());
+RAYLIB64_FUNCTION(bool, IsWindowReady, ());
+RAYLIB64_FUNCTION(bool, IsWindowFullscreen, ());
+RAYLIB64_FUNCTION(bool, IsWindowHidden, ());
+RAYLIB64_FUNCTION(bool, IsWindowMinimized, ());
+RAYLIB64_FUNCTION(bool, IsWindowMaximized, ());
+RAYLIB64_FUNCTION(bool, IsWindowFocused, ());
+RAYLIB64_FUNCTION(bool, IsWindowResized, ());
+RAYLIB64_FUNCTION(bool, IsWindowState, (unsigned int flag));
+RAYLIB64_FUNCTION(void, SetWindowState, (unsigned int flags));
+RAYLIB64_FUNCTION(void, ClearWindowState, (unsigned int flags));
+RAYLIB64_FUNCTION(void, ToggleFullscreen, ());
+RAYLIB64_FUNCTION(void, ToggleBorderlessWindowed, ());
+RAYLIB64_FUNCTION(void, MaximizeWindow, ());
+RAYLIB64_FUNCTION(void, MinimizeWindow, ());
+RAYLIB64_FUNCTION(void, RestoreWindow, ());
+RAYLIB64_FUNCTION(void, SetWindowIcon, (Image image));
+RAYLIB64_FUNCTION(void, SetWindowIcons, (Image *images, int count));
+RAYLIB64_FUNCTION(void, SetWindowTitle, (char *title));
+RAYLIB64_FUNCTION(void, SetWindowPosition, (int x, int y));
+RAYLIB64_FUNCTION(void, SetWindowMonitor, (int monitor));
+RAYLIB64_FUNCTION(void, SetWindowMinSize, (int width, int height));
+RAYLIB64_FUNCTION(void, SetWindowMaxSize, (int width, int height));
+RAYLIB64_FUNCTION(void, SetWindowSize, (int width, int height));
+RAYLIB64_FUNCTION(void, SetWindowOpacity, (float opacity));
+RAYLIB64_FUNCTION(void, SetWindowFocused, ());
+RAYLIB64_FUNCTION(void *, GetWindowHandle, ());
+RAYLIB64_FUNCTION(int, GetScreenWidth, ());
+RAYLIB64_FUNCTION(int, GetScreenHeight, ());
+RAYLIB64_FUNCTION(int, GetRenderWidth, ());
+RAYLIB64_FUNCTION(int, GetRenderHeight, ());
+RAYLIB64_FUNCTION(int, GetMonitorCount, ());
+RAYLIB64_FUNCTION(int, GetCurrentMonitor, ());
+RAYLIB64_FUNCTION(Vector2, GetMonitorPosition, (int monitor));
+RAYLIB64_FUNCTION(int, GetMonitorWidth, (int monitor));
+RAYLIB64_FUNCTION(int, GetMonitorHeight, (int monitor));
+RAYLIB64_FUNCTION(int, GetMonitorPhysicalWidth, (int monitor));
+RAYLIB64_FUNCTION(int, GetMonitorPhysicalHeight, (int monitor));
+RAYLIB64_FUNCTION(int, GetMonitorRefreshRate, (int monitor));
+RAYLIB64_FUNCTION(Vector2, GetWindowPosition, ());
+RAYLIB64_FUNCTION(Vector2, GetWindowScaleDPI, ());
+RAYLIB64_FUNCTION(char *, GetMonitorName, (int monitor));
+RAYLIB64_FUNCTION(void, SetClipboardText, (char *text));
+RAYLIB64_FUNCTION(char *, GetClipboardText, ());
+RAYLIB64_FUNCTION(void, EnableEventWaiting, ());
+RAYLIB64_FUNCTION(void, DisableEventWaiting, ());
+RAYLIB64_FUNCTION(void, ShowCursor, ());
+RAYLIB64_FUNCTION(void, HideCursor, ());
+RAYLIB64_FUNCTION(bool, IsCursorHidden, ());
+RAYLIB64_FUNCTION(void, EnableCursor, ());
+RAYLIB64_FUNCTION(void, DisableCursor, ());
+RAYLIB64_FUNCTION(bool, IsCursorOnScreen, ());
+RAYLIB64_FUNCTION(void, ClearBackground, (uint32_t color));
+RAYLIB64_FUNCTION(void, BeginDrawing, ());
+RAYLIB64_FUNCTION(void, EndDrawing, ());
+RAYLIB64_FUNCTION(void, BeginMode2D, (Camera2D camera));
+RAYLIB64_FUNCTION(void, EndMode2D, ());
+RAYLIB64_FUNCTION(void, BeginMode3D, (Camera3D camera));
+RAYLIB64_FUNCTION(void, EndMode3D, ());
+RAYLIB64_FUNCTION(void, BeginTextureMode, (RenderTexture target));
+RAYLIB64_FUNCTION(void, EndTextureMode, ());
+RAYLIB64_FUNCTION(void, BeginShaderMode, (Shader shader));
+RAYLIB64_FUNCTION(void, EndShaderMode, ());
+RAYLIB64_FUNCTION(void, BeginBlendMode, (int mode));
+RAYLIB64_FUNCTION(void, EndBlendMode, ());
+RAYLIB64_FUNCTION(void, BeginScissorMode, (int x, int y, int width, int height));
+RAYLIB64_FUNCTION(void, EndScissorMode, ());
+RAYLIB64_FUNCTION(void, BeginVrStereoMode, (VrStereoConfig config));
+RAYLIB64_FUNCTION(void, EndVrStereoMode, ());
+RAYLIB64_FUNCTION(VrStereoConfig, LoadVrStereoConfig, (VrDeviceInfo device));
+RAYLIB64_FUNCTION(void, UnloadVrStereoConfig, (VrStereoConfig config));
+RAYLIB64_FUNCTION(Shader, LoadShader, (char *vsFileName, char *fsFileName));
+RAYLIB64_FUNCTION(Shader, LoadShaderFromMemory, (char *vsCode, char *fsCode));
+RAYLIB64_FUNCTION(bool, IsShaderReady, (Shader shader));
+RAYLIB64_FUNCTION(int, GetShaderLocation, (Shader shader, char *uniformName));
+RAYLIB64_FUNCTION(int, GetShaderLocationAttrib, (Shader shader, char *attribName));
+RAYLIB64_FUNCTION(void, SetShaderValue, (Shader shader, int locIndex, void *value, int uniformType));
+RAYLIB64_FUNCTION(void, SetShaderValueV, (Shader shader, int locIndex, void *value, int uniformType, int count));
+RAYLIB64_FUNCTION(void, SetShaderValueMatrix, (Shader shader, int locIndex, Matrix mat));
+RAYLIB64_FUNCTION(void, SetShaderValueTexture, (Shader shader, int locIndex, Texture texture));
+RAYLIB64_FUNCTION(void, UnloadShader, (Shader shader));
+RAYLIB64_FUNCTION(Ray, GetMouseRay, (Vector2 mousePosition, Camera3D camera));
+RAYLIB64_FUNCTION(Matrix, GetCameraMatrix, (Camera3D camera));
+RAYLIB64_FUNCTION(Matrix, GetCameraMatrix2D, (Camera2D camera));
+RAYLIB64_FUNCTION(Vector2, GetWorldToScreen, (Vector3 position, Camera3D camera));
+RAYLIB64_FUNCTION(Vector2, GetScreenToWorld2D, (Vector2 position, Camera2D camera));
+RAYLIB64_FUNCTION(Vector2, GetWorldToScreenEx, (Vector3 position, Camera3D camera, int width, int height));
+RAYLIB64_FUNCTION(Vector2, GetWorldToScreen2D, (Vector2 position, Camera2D camera));
+RAYLIB64_FUNCTION(void, SetTargetFPS, (int fps));
+RAYLIB64_FUNCTION(float, GetFrameTime, ());
+RAYLIB64_FUNCTION(double, GetTime, ());
+RAYLIB64_FUNCTION(int, GetFPS, ());
+RAYLIB64_FUNCTION(void, SwapScreenBuffer, ());
+RAYLIB64_FUNCTION(void, PollInputEvents, ());
+RAYLIB64_FUNCTION(void, WaitTime, (double seconds));
+RAYLIB64_FUNCTION(void, SetRandomSeed, (unsigned int seed));
+RAYLIB64_FUNCTION(int, GetRandomValue, (int min, int max));
+RAYLIB64_FUNCTION(int *, LoadRandomSequence, (unsigned int count, int min, int max));
+RAYLIB64_FUNCTION(void, UnloadRandomSequence, (int *sequence));
+RAYLIB64_FUNCTION(void, TakeScreenshot, (char *fileName));
+RAYLIB64_FUNCTION(void, SetConfigFlags, (unsigned int flags));
+RAYLIB64_FUNCTION(void, OpenURL, (char *url));
+RAYLIB64_FUNCTION(void, TraceLog, (int logLevel, char *text, ...));
+RAYLIB64_FUNCTION(void, SetTraceLogLevel, (int logLevel));
+RAYLIB64_FUNCTION(void *, MemAlloc, (unsigned int size));
+RAYLIB64_FUNCTION(void *, MemRealloc, (void *ptr, unsigned int size));
+RAYLIB64_FUNCTION(void, MemFree, (void *ptr));
+RAYLIB64_FUNCTION(void, SetTraceLogCallback, (TraceLogCallback callback));
+RAYLIB64_FUNCTION(void, SetLoadFileDataCallback, (LoadFileDataCallback callback));
+RAYLIB64_FUNCTION(void, SetSaveFileDataCallback, (SaveFileDataCallback callback));
+RAYLIB64_FUNCTION(void, SetLoadFileTextCallback, (LoadFileTextCallback callback));
+RAYLIB64_FUNCTION(void, SetSaveFileTextCallback, (SaveFileTextCallback callback));
+RAYLIB64_FUNCTION(unsigned char *, LoadFileData, (char *fileName, int *dataSize));
+RAYLIB64_FUNCTION(void, UnloadFileData, (unsigned char *data));
+RAYLIB64_FUNCTION(bool, SaveFileData, (char *fileName, void *data, int dataSize));
+RAYLIB64_FUNCTION(bool, ExportDataAsCode, (unsigned char *data, int dataSize, char *fileName));
+RAYLIB64_FUNCTION(char *, LoadFileText, (char *fileName));
+RAYLIB64_FUNCTION(void, UnloadFileText, (char *text));
+RAYLIB64_FUNCTION(bool, SaveFileText, (char *fileName, char *text));
+RAYLIB64_FUNCTION(bool, FileExists, (char *fileName));
+RAYLIB64_FUNCTION(bool, DirectoryExists, (char *dirPath));
+RAYLIB64_FUNCTION(bool, IsFileExtension, (char *fileName, char *ext));
+RAYLIB64_FUNCTION(int, GetFileLength, (char *fileName));
+RAYLIB64_FUNCTION(char *, GetFileExtension, (char *fileName));
+RAYLIB64_FUNCTION(char *, GetFileName, (char *filePath));
+RAYLIB64_FUNCTION(char *, GetFileNameWithoutExt, (char *filePath));
+RAYLIB64_FUNCTION(char *, GetDirectoryPath, (char *filePath));
+RAYLIB64_FUNCTION(char *, GetPrevDirectoryPath, (char *dirPath));
+RAYLIB64_FUNCTION(char *, GetWorkingDirectory, ());
+RAYLIB64_FUNCTION(char *, GetApplicationDirectory, ());
+RAYLIB64_FUNCTION(bool, ChangeDirectory, (char *dir));
+RAYLIB64_FUNCTION(bool, IsPathFile, (char *path));
+RAYLIB64_FUNCTION(FilePathList, LoadDirectoryFiles, (char *dirPath));
+RAYLIB64_FUNCTION(FilePathList, LoadDirectoryFilesEx, (char *basePath, char *filter, bool scanSubdirs));
+RAYLIB64_FUNCTION(void, UnloadDirectoryFiles, (FilePathList files));
+RAYLIB64_FUNCTION(bool, IsFileDropped, ());
+RAYLIB64_FUNCTION(FilePathList, LoadDroppedFiles, ());
+RAYLIB64_FUNCTION(void, UnloadDroppedFiles, (FilePathList files));
+RAYLIB64_FUNCTION(long, GetFileModTime, (char *fileName));
+RAYLIB64_FUNCTION(unsigned char *, CompressData, (unsigned char *data, int dataSize, int *compDataSize));
+RAYLIB64_FUNCTION(unsigned char *, DecompressData, (unsigned char *compData, int compDataSize, int *dataSize));
+RAYLIB64_FUNCTION(char *, EncodeDataBase64, (unsigned char *data, int dataSize, int *outputSize));
+RAYLIB64_FUNCTION(unsigned char *, DecodeDataBase64, (unsigned char *data, int *outputSize));
+RAYLIB64_FUNCTION(AutomationEventList, LoadAutomationEventList, (char *fileName));
+RAYLIB64_FUNCTION(void, UnloadAutomationEventList, (AutomationEventList *list));
+RAYLIB64_FUNCTION(bool, ExportAutomationEventList, (AutomationEventList list, char *fileName));
+RAYLIB64_FUNCTION(void, SetAutomationEventList, (AutomationEventList *list));
+RAYLIB64_FUNCTION(void, SetAutomationEventBaseFrame, (int frame));
+RAYLIB64_FUNCTION(void, StartAutomationEventRecording, ());
+RAYLIB64_FUNCTION(void, StopAutomationEventRecording, ());
+RAYLIB64_FUNCTION(void, PlayAutomationEvent, (AutomationEvent event));
+RAYLIB64_FUNCTION(bool, IsKeyPressed, (int key));
+RAYLIB64_FUNCTION(bool, IsKeyPressedRepeat, (int key));
+RAYLIB64_FUNCTION(bool, IsKeyDown, (int key));
+RAYLIB64_FUNCTION(bool, IsKeyReleased, (int key));
+RAYLIB64_FUNCTION(bool, IsKeyUp, (int key));
+RAYLIB64_FUNCTION(int, GetKeyPressed, ());
+RAYLIB64_FUNCTION(int, GetCharPressed, ());
+RAYLIB64_FUNCTION(void, SetExitKey, (int key));
+RAYLIB64_FUNCTION(bool, IsGamepadAvailable, (int gamepad));
+RAYLIB64_FUNCTION(char *, GetGamepadName, (int gamepad));
+RAYLIB64_FUNCTION(bool, IsGamepadButtonPressed, (int gamepad, int button));
+RAYLIB64_FUNCTION(bool, IsGamepadButtonDown, (int gamepad, int button));
+RAYLIB64_FUNCTION(bool, IsGamepadButtonReleased, (int gamepad, int button));
+RAYLIB64_FUNCTION(bool, IsGamepadButtonUp, (int gamepad, int button));
+RAYLIB64_FUNCTION(int, GetGamepadButtonPressed, ());
+RAYLIB64_FUNCTION(int, GetGamepadAxisCount, (int gamepad));
+RAYLIB64_FUNCTION(float, GetGamepadAxisMovement, (int gamepad, int axis));
+RAYLIB64_FUNCTION(int, SetGamepadMappings, (char *mappings));
+RAYLIB64_FUNCTION(bool, IsMouseButtonPressed, (int button));
+RAYLIB64_FUNCTION(bool, IsMouseButtonDown, (int button));
+RAYLIB64_FUNCTION(bool, IsMouseButtonReleased, (int button));
+RAYLIB64_FUNCTION(bool, IsMouseButtonUp, (int button));
+RAYLIB64_FUNCTION(int, GetMouseX, ());
+RAYLIB64_FUNCTION(int, GetMouseY, ());
+RAYLIB64_FUNCTION(Vector2, GetMousePosition, ());
+RAYLIB64_FUNCTION(Vector2, GetMouseDelta, ());
+RAYLIB64_FUNCTION(void, SetMousePosition, (int x, int y));
+RAYLIB64_FUNCTION(void, SetMouseOffset, (int offsetX, int offsetY));
+RAYLIB64_FUNCTION(void, SetMouseScale, (float scaleX, float scaleY));
+RAYLIB64_FUNCTION(float, GetMouseWheelMove, ());
+RAYLIB64_FUNCTION(Vector2, GetMouseWheelMoveV, ());
+RAYLIB64_FUNCTION(void, SetMouseCursor, (int cursor));
+RAYLIB64_FUNCTION(int, GetTouchX, ());
+RAYLIB64_FUNCTION(int, GetTouchY, ());
+RAYLIB64_FUNCTION(Vector2, GetTouchPosition, (int index));
+RAYLIB64_FUNCTION(int, GetTouchPointId, (int index));
+RAYLIB64_FUNCTION(int, GetTouchPointCount, ());
+RAYLIB64_FUNCTION(void, SetGesturesEnabled, (unsigned int flags));
+RAYLIB64_FUNCTION(bool, IsGestureDetected, (unsigned int gesture));
+RAYLIB64_FUNCTION(int, GetGestureDetected, ());
+RAYLIB64_FUNCTION(float, GetGestureHoldDuration, ());
+RAYLIB64_FUNCTION(Vector2, GetGestureDragVector, ());
+RAYLIB64_FUNCTION(float, GetGestureDragAngle, ());
+RAYLIB64_FUNCTION(Vector2, GetGesturePinchVector, ());
+RAYLIB64_FUNCTION(float, GetGesturePinchAngle, ());
+RAYLIB64_FUNCTION(void, UpdateCamera, (Camera3D *camera, int mode));
+RAYLIB64_FUNCTION(void, UpdateCameraPro, (Camera3D *camera, Vector3 movement, Vector3 rotation, float zoom));
+RAYLIB64_FUNCTION(void, SetShapesTexture, (Texture texture, RRectangle source));
+RAYLIB64_FUNCTION(void, DrawPixel, (int posX, int posY, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPixelV, (Vector2 position, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawLine, (int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawLineV, (Vector2 startPos, Vector2 endPos, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawLineEx, (Vector2 startPos, Vector2 endPos, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawLineStrip, (Vector2 *points, int pointCount, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawLineBezier, (Vector2 startPos, Vector2 endPos, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircle, (int centerX, int centerY, float radius, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircleSector, (Vector2 center, float radius, float startAngle, float endAngle, int segments, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircleSectorLines, (Vector2 center, float radius, float startAngle, float endAngle, int segments, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircleGradient, (int centerX, int centerY, float radius, uint32_t color1, uint32_t color2));
+RAYLIB64_FUNCTION(void, DrawCircleV, (Vector2 center, float radius, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircleLines, (int centerX, int centerY, float radius, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircleLinesV, (Vector2 center, float radius, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawEllipse, (int centerX, int centerY, float radiusH, float radiusV, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawEllipseLines, (int centerX, int centerY, float radiusH, float radiusV, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRing, (Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRingLines, (Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangle, (int posX, int posY, int width, int height, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleV, (Vector2 position, Vector2 size, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleRec, (RRectangle rec, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectanglePro, (RRectangle rec, Vector2 origin, float rotation, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleGradientV, (int posX, int posY, int width, int height, uint32_t color1, uint32_t color2));
+RAYLIB64_FUNCTION(void, DrawRectangleGradientH, (int posX, int posY, int width, int height, uint32_t color1, uint32_t color2));
+RAYLIB64_FUNCTION(void, DrawRectangleGradientEx, (RRectangle rec, uint32_t col1, uint32_t col2, uint32_t col3, uint32_t col4));
+RAYLIB64_FUNCTION(void, DrawRectangleLines, (int posX, int posY, int width, int height, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleLinesEx, (RRectangle rec, float lineThick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleRounded, (RRectangle rec, float roundness, int segments, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRectangleRoundedLines, (RRectangle rec, float roundness, int segments, float lineThick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangle, (Vector2 v1, Vector2 v2, Vector2 v3, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangleLines, (Vector2 v1, Vector2 v2, Vector2 v3, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangleFan, (Vector2 *points, int pointCount, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangleStrip, (Vector2 *points, int pointCount, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPoly, (Vector2 center, int sides, float radius, float rotation, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPolyLines, (Vector2 center, int sides, float radius, float rotation, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPolyLinesEx, (Vector2 center, int sides, float radius, float rotation, float lineThick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineLinear, (Vector2 *points, int pointCount, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineBasis, (Vector2 *points, int pointCount, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineCatmullRom, (Vector2 *points, int pointCount, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineBezierQuadratic, (Vector2 *points, int pointCount, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineBezierCubic, (Vector2 *points, int pointCount, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineSegmentLinear, (Vector2 p1, Vector2 p2, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineSegmentBasis, (Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineSegmentCatmullRom, (Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineSegmentBezierQuadratic, (Vector2 p1, Vector2 c2, Vector2 p3, float thick, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSplineSegmentBezierCubic, (Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, uint32_t color));
+RAYLIB64_FUNCTION(Vector2, GetSplinePointLinear, (Vector2 startPos, Vector2 endPos, float t));
+RAYLIB64_FUNCTION(Vector2, GetSplinePointBasis, (Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t));
+RAYLIB64_FUNCTION(Vector2, GetSplinePointCatmullRom, (Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t));
+RAYLIB64_FUNCTION(Vector2, GetSplinePointBezierQuad, (Vector2 p1, Vector2 c2, Vector2 p3, float t));
+RAYLIB64_FUNCTION(Vector2, GetSplinePointBezierCubic, (Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float t));
+RAYLIB64_FUNCTION(bool, CheckCollisionRecs, (RRectangle rec1, RRectangle rec2));
+RAYLIB64_FUNCTION(bool, CheckCollisionCircles, (Vector2 center1, float radius1, Vector2 center2, float radius2));
+RAYLIB64_FUNCTION(bool, CheckCollisionCircleRec, (Vector2 center, float radius, RRectangle rec));
+RAYLIB64_FUNCTION(bool, CheckCollisionPointRec, (Vector2 point, RRectangle rec));
+RAYLIB64_FUNCTION(bool, CheckCollisionPointCircle, (Vector2 point, Vector2 center, float radius));
+RAYLIB64_FUNCTION(bool, CheckCollisionPointTriangle, (Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3));
+RAYLIB64_FUNCTION(bool, CheckCollisionPointPoly, (Vector2 point, Vector2 *points, int pointCount));
+RAYLIB64_FUNCTION(bool, CheckCollisionLines, (Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint));
+RAYLIB64_FUNCTION(bool, CheckCollisionPointLine, (Vector2 point, Vector2 p1, Vector2 p2, int threshold));
+RAYLIB64_FUNCTION(RRectangle, GetCollisionRec, (RRectangle rec1, RRectangle rec2));
+RAYLIB64_FUNCTION(Image, LoadImage, (char *fileName));
+RAYLIB64_FUNCTION(Image, LoadImageRaw, (char *fileName, int width, int height, int format, int headerSize));
+RAYLIB64_FUNCTION(Image, LoadImageSvg, (char *fileNameOrString, int width, int height));
+RAYLIB64_FUNCTION(Image, LoadImageAnim, (char *fileName, int *frames));
+RAYLIB64_FUNCTION(Image, LoadImageFromMemory, (char *fileType, unsigned char *fileData, int dataSize));
+RAYLIB64_FUNCTION(Image, LoadImageFromTexture, (Texture texture));
+RAYLIB64_FUNCTION(Image, LoadImageFromScreen, ());
+RAYLIB64_FUNCTION(bool, IsImageReady, (Image image));
+RAYLIB64_FUNCTION(void, UnloadImage, (Image image));
+RAYLIB64_FUNCTION(bool, ExportImage, (Image image, char *fileName));
+RAYLIB64_FUNCTION(unsigned char *, ExportImageToMemory, (Image image, char *fileType, int *fileSize));
+RAYLIB64_FUNCTION(bool, ExportImageAsCode, (Image image, char *fileName));
+RAYLIB64_FUNCTION(Image, GenImageColor, (int width, int height, uint32_t color));
+RAYLIB64_FUNCTION(Image, GenImageGradientLinear, (int width, int height, int direction, uint32_t start, uint32_t end));
+RAYLIB64_FUNCTION(Image, GenImageGradientRadial, (int width, int height, float density, uint32_t inner, uint32_t outer));
+RAYLIB64_FUNCTION(Image, GenImageGradientSquare, (int width, int height, float density, uint32_t inner, uint32_t outer));
+RAYLIB64_FUNCTION(Image, GenImageChecked, (int width, int height, int checksX, int checksY, uint32_t col1, uint32_t col2));
+RAYLIB64_FUNCTION(Image, GenImageWhiteNoise, (int width, int height, float factor));
+RAYLIB64_FUNCTION(Image, GenImagePerlinNoise, (int width, int height, int offsetX, int offsetY, float scale));
+RAYLIB64_FUNCTION(Image, GenImageCellular, (int width, int height, int tileSize));
+RAYLIB64_FUNCTION(Image, GenImageText, (int width, int height, char *text));
+RAYLIB64_FUNCTION(Image, ImageCopy, (Image image));
+RAYLIB64_FUNCTION(Image, ImageFromImage, (Image image, RRectangle rec));
+RAYLIB64_FUNCTION(Image, ImageText, (char *text, int fontSize, uint32_t color));
+RAYLIB64_FUNCTION(Image, ImageTextEx, (RFont font, char *text, float fontSize, float spacing, uint32_t tint));
+RAYLIB64_FUNCTION(void, ImageFormat, (Image *image, int newFormat));
+RAYLIB64_FUNCTION(void, ImageToPOT, (Image *image, uint32_t fill));
+RAYLIB64_FUNCTION(void, ImageCrop, (Image *image, RRectangle crop));
+RAYLIB64_FUNCTION(void, ImageAlphaCrop, (Image *image, float threshold));
+RAYLIB64_FUNCTION(void, ImageAlphaClear, (Image *image, uint32_t color, float threshold));
+RAYLIB64_FUNCTION(void, ImageAlphaMask, (Image *image, Image alphaMask));
+RAYLIB64_FUNCTION(void, ImageAlphaPremultiply, (Image *image));
+RAYLIB64_FUNCTION(void, ImageBlurGaussian, (Image *image, int blurSize));
+RAYLIB64_FUNCTION(void, ImageResize, (Image *image, int newWidth, int newHeight));
+RAYLIB64_FUNCTION(void, ImageResizeNN, (Image *image, int newWidth, int newHeight));
+RAYLIB64_FUNCTION(void, ImageResizeCanvas, (Image *image, int newWidth, int newHeight, int offsetX, int offsetY, uint32_t fill));
+RAYLIB64_FUNCTION(void, ImageMipmaps, (Image *image));
+RAYLIB64_FUNCTION(void, ImageDither, (Image *image, int rBpp, int gBpp, int bBpp, int aBpp));
+RAYLIB64_FUNCTION(void, ImageFlipVertical, (Image *image));
+RAYLIB64_FUNCTION(void, ImageFlipHorizontal, (Image *image));
+RAYLIB64_FUNCTION(void, ImageRotate, (Image *image, int degrees));
+RAYLIB64_FUNCTION(void, ImageRotateCW, (Image *image));
+RAYLIB64_FUNCTION(void, ImageRotateCCW, (Image *image));
+RAYLIB64_FUNCTION(void, ImageColorTint, (Image *image, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageColorInvert, (Image *image));
+RAYLIB64_FUNCTION(void, ImageColorGrayscale, (Image *image));
+RAYLIB64_FUNCTION(void, ImageColorContrast, (Image *image, float contrast));
+RAYLIB64_FUNCTION(void, ImageColorBrightness, (Image *image, int brightness));
+RAYLIB64_FUNCTION(void, ImageColorReplace, (Image *image, uint32_t color, uint32_t replace));
+RAYLIB64_FUNCTION(uint32_t *, LoadImageColors, (Image image));
+RAYLIB64_FUNCTION(uint32_t *, LoadImagePalette, (Image image, int maxPaletteSize, int *colorCount));
+RAYLIB64_FUNCTION(void, UnloadImageColors, (uint32_t *colors));
+RAYLIB64_FUNCTION(void, UnloadImagePalette, (uint32_t *colors));
+RAYLIB64_FUNCTION(RRectangle, GetImageAlphaBorder, (Image image, float threshold));
+RAYLIB64_FUNCTION(uint32_t, GetImageColor, (Image image, int x, int y));
+RAYLIB64_FUNCTION(void, ImageClearBackground, (Image *dst, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawPixel, (Image *dst, int posX, int posY, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawPixelV, (Image *dst, Vector2 position, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawLine, (Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawLineV, (Image *dst, Vector2 start, Vector2 end, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawCircle, (Image *dst, int centerX, int centerY, int radius, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawCircleV, (Image *dst, Vector2 center, int radius, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawCircleLines, (Image *dst, int centerX, int centerY, int radius, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawCircleLinesV, (Image *dst, Vector2 center, int radius, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawRectangle, (Image *dst, int posX, int posY, int width, int height, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawRectangleV, (Image *dst, Vector2 position, Vector2 size, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawRectangleRec, (Image *dst, RRectangle rec, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawRectangleLines, (Image *dst, RRectangle rec, int thick, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDraw, (Image *dst, Image src, RRectangle srcRec, RRectangle dstRec, uint32_t tint));
+RAYLIB64_FUNCTION(void, ImageDrawText, (Image *dst, char *text, int posX, int posY, int fontSize, uint32_t color));
+RAYLIB64_FUNCTION(void, ImageDrawTextEx, (Image *dst, RFont font, char *text, Vector2 position, float fontSize, float spacing, uint32_t tint));
+RAYLIB64_FUNCTION(Texture, LoadTexture, (char *fileName));
+RAYLIB64_FUNCTION(Texture, LoadTextureFromImage, (Image image));
+RAYLIB64_FUNCTION(Texture, LoadTextureCubemap, (Image image, int layout));
+RAYLIB64_FUNCTION(RenderTexture, LoadRenderTexture, (int width, int height));
+RAYLIB64_FUNCTION(bool, IsTextureReady, (Texture texture));
+RAYLIB64_FUNCTION(void, UnloadTexture, (Texture texture));
+RAYLIB64_FUNCTION(bool, IsRenderTextureReady, (RenderTexture target));
+RAYLIB64_FUNCTION(void, UnloadRenderTexture, (RenderTexture target));
+RAYLIB64_FUNCTION(void, UpdateTexture, (Texture texture, void *pixels));
+RAYLIB64_FUNCTION(void, UpdateTextureRec, (Texture texture, RRectangle rec, void *pixels));
+RAYLIB64_FUNCTION(void, GenTextureMipmaps, (Texture *texture));
+RAYLIB64_FUNCTION(void, SetTextureFilter, (Texture texture, int filter));
+RAYLIB64_FUNCTION(void, SetTextureWrap, (Texture texture, int wrap));
+RAYLIB64_FUNCTION(void, DrawTexture, (Texture texture, int posX, int posY, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextureV, (Texture texture, Vector2 position, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextureEx, (Texture texture, Vector2 position, float rotation, float scale, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextureRec, (Texture texture, RRectangle source, Vector2 position, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTexturePro, (Texture texture, RRectangle source, RRectangle dest, Vector2 origin, float rotation, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextureNPatch, (Texture texture, NPatchInfo nPatchInfo, RRectangle dest, Vector2 origin, float rotation, uint32_t tint));
+RAYLIB64_FUNCTION(uint32_t, Fade, (uint32_t color, float alpha));
+RAYLIB64_FUNCTION(int, ColorToInt, (uint32_t color));
+RAYLIB64_FUNCTION(Vector4, ColorNormalize, (uint32_t color));
+RAYLIB64_FUNCTION(uint32_t, ColorFromNormalized, (Vector4 normalized));
+RAYLIB64_FUNCTION(Vector3, ColorToHSV, (uint32_t color));
+RAYLIB64_FUNCTION(uint32_t, ColorFromHSV, (float hue, float saturation, float value));
+RAYLIB64_FUNCTION(uint32_t, ColorTint, (uint32_t color, uint32_t tint));
+RAYLIB64_FUNCTION(uint32_t, ColorBrightness, (uint32_t color, float factor));
+RAYLIB64_FUNCTION(uint32_t, ColorContrast, (uint32_t color, float contrast));
+RAYLIB64_FUNCTION(uint32_t, ColorAlpha, (uint32_t color, float alpha));
+RAYLIB64_FUNCTION(uint32_t, ColorAlphaBlend, (uint32_t dst, uint32_t src, uint32_t tint));
+RAYLIB64_FUNCTION(uint32_t, GetColor, (unsigned int hexValue));
+RAYLIB64_FUNCTION(uint32_t, GetPixelColor, (void *srcPtr, int format));
+RAYLIB64_FUNCTION(void, SetPixelColor, (void *dstPtr, uint32_t color, int format));
+RAYLIB64_FUNCTION(int, GetPixelDataSize, (int width, int height, int format));
+RAYLIB64_FUNCTION(RFont, GetFontDefault, ());
+RAYLIB64_FUNCTION(RFont, LoadFont, (char *fileName));
+RAYLIB64_FUNCTION(RFont, LoadFontEx, (char *fileName, int fontSize, int *codepoints, int codepointCount));
+RAYLIB64_FUNCTION(RFont, LoadFontFromImage, (Image image, uint32_t key, int firstChar));
+RAYLIB64_FUNCTION(RFont, LoadFontFromMemory, (char *fileType, unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount));
+RAYLIB64_FUNCTION(bool, IsFontReady, (RFont font));
+RAYLIB64_FUNCTION(GlyphInfo *, LoadFontData, (unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type));
+RAYLIB64_FUNCTION(Image, GenImageFontAtlas, (GlyphInfo *glyphs, RRectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod));
+RAYLIB64_FUNCTION(void, UnloadFontData, (GlyphInfo *glyphs, int glyphCount));
+RAYLIB64_FUNCTION(void, UnloadFont, (RFont font));
+RAYLIB64_FUNCTION(bool, ExportFontAsCode, (RFont font, char *fileName));
+RAYLIB64_FUNCTION(void, DrawFPS, (int posX, int posY));
+RAYLIB64_FUNCTION(void, DrawText, (char *text, int posX, int posY, int fontSize, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTextEx, (RFont font, char *text, Vector2 position, float fontSize, float spacing, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextPro, (RFont font, char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextCodepoint, (RFont font, int codepoint, Vector2 position, float fontSize, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawTextCodepoints, (RFont font, int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, uint32_t tint));
+RAYLIB64_FUNCTION(void, SetTextLineSpacing, (int spacing));
+RAYLIB64_FUNCTION(int, MeasureText, (char *text, int fontSize));
+RAYLIB64_FUNCTION(Vector2, MeasureTextEx, (RFont font, char *text, float fontSize, float spacing));
+RAYLIB64_FUNCTION(int, GetGlyphIndex, (RFont font, int codepoint));
+RAYLIB64_FUNCTION(GlyphInfo, GetGlyphInfo, (RFont font, int codepoint));
+RAYLIB64_FUNCTION(RRectangle, GetGlyphAtlasRec, (RFont font, int codepoint));
+RAYLIB64_FUNCTION(char *, LoadUTF8, (int *codepoints, int length));
+RAYLIB64_FUNCTION(void, UnloadUTF8, (char *text));
+RAYLIB64_FUNCTION(int *, LoadCodepoints, (char *text, int *count));
+RAYLIB64_FUNCTION(void, UnloadCodepoints, (int *codepoints));
+RAYLIB64_FUNCTION(int, GetCodepointCount, (char *text));
+RAYLIB64_FUNCTION(int, GetCodepoint, (char *text, int *codepointSize));
+RAYLIB64_FUNCTION(int, GetCodepointNext, (char *text, int *codepointSize));
+RAYLIB64_FUNCTION(int, GetCodepointPrevious, (char *text, int *codepointSize));
+RAYLIB64_FUNCTION(char *, CodepointToUTF8, (int codepoint, int *utf8Size));
+RAYLIB64_FUNCTION(int, TextCopy, (char *dst, char *src));
+RAYLIB64_FUNCTION(bool, TextIsEqual, (char *text1, char *text2));
+RAYLIB64_FUNCTION(unsigned int, TextLength, (char *text));
+RAYLIB64_FUNCTION(char *, TextFormat, (char *text, ...));
+RAYLIB64_FUNCTION(char *, TextSubtext, (char *text, int position, int length));
+RAYLIB64_FUNCTION(char *, TextReplace, (char *text, char *replace, char *by));
+RAYLIB64_FUNCTION(char *, TextInsert, (char *text, char *insert, int position));
+RAYLIB64_FUNCTION(char *, TextJoin, (char **textList, int count, char *delimiter));
+RAYLIB64_FUNCTION(char **, TextSplit, (char *text, char delimiter, int *count));
+RAYLIB64_FUNCTION(void, TextAppend, (char *text, char *append, int *position));
+RAYLIB64_FUNCTION(int, TextFindIndex, (char *text, char *find));
+RAYLIB64_FUNCTION(char *, TextToUpper, (char *text));
+RAYLIB64_FUNCTION(char *, TextToLower, (char *text));
+RAYLIB64_FUNCTION(char *, TextToPascal, (char *text));
+RAYLIB64_FUNCTION(int, TextToInteger, (char *text));
+RAYLIB64_FUNCTION(void, DrawLine3D, (Vector3 startPos, Vector3 endPos, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPoint3D, (Vector3 position, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCircle3D, (Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangle3D, (Vector3 v1, Vector3 v2, Vector3 v3, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawTriangleStrip3D, (Vector3 *points, int pointCount, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCube, (Vector3 position, float width, float height, float length, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCubeV, (Vector3 position, Vector3 size, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCubeWires, (Vector3 position, float width, float height, float length, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCubeWiresV, (Vector3 position, Vector3 size, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSphere, (Vector3 centerPos, float radius, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSphereEx, (Vector3 centerPos, float radius, int rings, int slices, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawSphereWires, (Vector3 centerPos, float radius, int rings, int slices, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCylinder, (Vector3 position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCylinderEx, (Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCylinderWires, (Vector3 position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCylinderWiresEx, (Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCapsule, (Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawCapsuleWires, (Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawPlane, (Vector3 centerPos, Vector2 size, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawRay, (Ray ray, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawGrid, (int slices, float spacing));
+RAYLIB64_FUNCTION(Model, LoadModel, (char *fileName));
+RAYLIB64_FUNCTION(Model, LoadModelFromMesh, (Mesh mesh));
+RAYLIB64_FUNCTION(bool, IsModelReady, (Model model));
+RAYLIB64_FUNCTION(void, UnloadModel, (Model model));
+RAYLIB64_FUNCTION(BoundingBox, GetModelBoundingBox, (Model model));
+RAYLIB64_FUNCTION(void, DrawModel, (Model model, Vector3 position, float scale, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawModelEx, (Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawModelWires, (Model model, Vector3 position, float scale, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawModelWiresEx, (Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawBoundingBox, (BoundingBox box, uint32_t color));
+RAYLIB64_FUNCTION(void, DrawBillboard, (Camera3D camera, Texture texture, Vector3 position, float size, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawBillboardRec, (Camera3D camera, Texture texture, RRectangle source, Vector3 position, Vector2 size, uint32_t tint));
+RAYLIB64_FUNCTION(void, DrawBillboardPro, (Camera3D camera, Texture texture, RRectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, uint32_t tint));
+RAYLIB64_FUNCTION(void, UploadMesh, (Mesh *mesh, bool dynamic));
+RAYLIB64_FUNCTION(void, UpdateMeshBuffer, (Mesh mesh, int index, void *data, int dataSize, int offset));
+RAYLIB64_FUNCTION(void, UnloadMesh, (Mesh mesh));
+RAYLIB64_FUNCTION(void, DrawMesh, (Mesh mesh, Material material, Matrix transform));
+RAYLIB64_FUNCTION(void, DrawMeshInstanced, (Mesh mesh, Material material, Matrix *transforms, int instances));
+RAYLIB64_FUNCTION(bool, ExportMesh, (Mesh mesh, char *fileName));
+RAYLIB64_FUNCTION(BoundingBox, GetMeshBoundingBox, (Mesh mesh));
+RAYLIB64_FUNCTION(void, GenMeshTangents, (Mesh *mesh));
+RAYLIB64_FUNCTION(Mesh, GenMeshPoly, (int sides, float radius));
+RAYLIB64_FUNCTION(Mesh, GenMeshPlane, (float width, float length, int resX, int resZ));
+RAYLIB64_FUNCTION(Mesh, GenMeshCube, (float width, float height, float length));
+RAYLIB64_FUNCTION(Mesh, GenMeshSphere, (float radius, int rings, int slices));
+RAYLIB64_FUNCTION(Mesh, GenMeshHemiSphere, (float radius, int rings, int slices));
+RAYLIB64_FUNCTION(Mesh, GenMeshCylinder, (float radius, float height, int slices));
+RAYLIB64_FUNCTION(Mesh, GenMeshCone, (float radius, float height, int slices));
+RAYLIB64_FUNCTION(Mesh, GenMeshTorus, (float radius, float size, int radSeg, int sides));
+RAYLIB64_FUNCTION(Mesh, GenMeshKnot, (float radius, float size, int radSeg, int sides));
+RAYLIB64_FUNCTION(Mesh, GenMeshHeightmap, (Image heightmap, Vector3 size));
+RAYLIB64_FUNCTION(Mesh, GenMeshCubicmap, (Image cubicmap, Vector3 cubeSize));
+RAYLIB64_FUNCTION(Material *, LoadMaterials, (char *fileName, int *materialCount));
+RAYLIB64_FUNCTION(Material, LoadMaterialDefault, ());
+RAYLIB64_FUNCTION(bool, IsMaterialReady, (Material material));
+RAYLIB64_FUNCTION(void, UnloadMaterial, (Material material));
+RAYLIB64_FUNCTION(void, SetMaterialTexture, (Material *material, int mapType, Texture texture));
+RAYLIB64_FUNCTION(void, SetModelMeshMaterial, (Model *model, int meshId, int materialId));
+RAYLIB64_FUNCTION(ModelAnimation *, LoadModelAnimations, (char *fileName, int *animCount));
+RAYLIB64_FUNCTION(void, UpdateModelAnimation, (Model model, ModelAnimation anim, int frame));
+RAYLIB64_FUNCTION(void, UnloadModelAnimation, (ModelAnimation anim));
+RAYLIB64_FUNCTION(void, UnloadModelAnimations, (ModelAnimation *animations, int animCount));
+RAYLIB64_FUNCTION(bool, IsModelAnimationValid, (Model model, ModelAnimation anim));
+RAYLIB64_FUNCTION(bool, CheckCollisionSpheres, (Vector3 center1, float radius1, Vector3 center2, float radius2));
+RAYLIB64_FUNCTION(bool, CheckCollisionBoxes, (BoundingBox box1, BoundingBox box2));
+RAYLIB64_FUNCTION(bool, CheckCollisionBoxSphere, (BoundingBox box, Vector3 center, float radius));
+RAYLIB64_FUNCTION(RayCollision, GetRayCollisionSphere, (Ray ray, Vector3 center, float radius));
+RAYLIB64_FUNCTION(RayCollision, GetRayCollisionBox, (Ray ray, BoundingBox box));
+RAYLIB64_FUNCTION(RayCollision, GetRayCollisionMesh, (Ray ray, Mesh mesh, Matrix transform));
+RAYLIB64_FUNCTION(RayCollision, GetRayCollisionTriangle, (Ray ray, Vector3 p1, Vector3 p2, Vector3 p3));
+RAYLIB64_FUNCTION(RayCollision, GetRayCollisionQuad, (Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4));
+RAYLIB64_FUNCTION(void, InitAudioDevice, ());
+RAYLIB64_FUNCTION(void, CloseAudioDevice, ());
+RAYLIB64_FUNCTION(bool, IsAudioDeviceReady, ());
+RAYLIB64_FUNCTION(void, SetMasterVolume, (float volume));
+RAYLIB64_FUNCTION(float, GetMasterVolume, ());
+RAYLIB64_FUNCTION(Wave, LoadWave, (char *fileName));
+RAYLIB64_FUNCTION(Wave, LoadWaveFromMemory, (char *fileType, unsigned char *fileData, int dataSize));
+RAYLIB64_FUNCTION(bool, IsWaveReady, (Wave wave));
+RAYLIB64_FUNCTION(RSound, LoadSound, (char *fileName));
+RAYLIB64_FUNCTION(RSound, LoadSoundFromWave, (Wave wave));
+RAYLIB64_FUNCTION(RSound, LoadSoundAlias, (RSound source));
+RAYLIB64_FUNCTION(bool, IsSoundReady, (RSound sound));
+RAYLIB64_FUNCTION(void, UpdateSound, (RSound sound, void *data, int sampleCount));
+RAYLIB64_FUNCTION(void, UnloadWave, (Wave wave));
+RAYLIB64_FUNCTION(void, UnloadSound, (RSound sound));
+RAYLIB64_FUNCTION(void, UnloadSoundAlias, (RSound alias));
+RAYLIB64_FUNCTION(bool, ExportWave, (Wave wave, char *fileName));
+RAYLIB64_FUNCTION(bool, ExportWaveAsCode, (Wave wave, char *fileName));
+RAYLIB64_FUNCTION(void, PlaySound, (RSound sound));
+RAYLIB64_FUNCTION(void, StopSound, (RSound sound));
+RAYLIB64_FUNCTION(void, PauseSound, (RSound sound));
+RAYLIB64_FUNCTION(void, ResumeSound, (RSound sound));
+RAYLIB64_FUNCTION(bool, IsSoundPlaying, (RSound sound));
+RAYLIB64_FUNCTION(void, SetSoundVolume, (RSound sound, float volume));
+RAYLIB64_FUNCTION(void, SetSoundPitch, (RSound sound, float pitch));
+RAYLIB64_FUNCTION(void, SetSoundPan, (RSound sound, float pan));
+RAYLIB64_FUNCTION(Wave, WaveCopy, (Wave wave));
+RAYLIB64_FUNCTION(void, WaveCrop, (Wave *wave, int initSample, int finalSample));
+RAYLIB64_FUNCTION(void, WaveFormat, (Wave *wave, int sampleRate, int sampleSize, int channels));
+RAYLIB64_FUNCTION(float *, LoadWaveSamples, (Wave wave));
+RAYLIB64_FUNCTION(void, UnloadWaveSamples, (float *samples));
+RAYLIB64_FUNCTION(Music, LoadMusicStream, (char *fileName));
+RAYLIB64_FUNCTION(Music, LoadMusicStreamFromMemory, (char *fileType, unsigned char *data, int dataSize));
+RAYLIB64_FUNCTION(bool, IsMusicReady, (Music music));
+RAYLIB64_FUNCTION(void, UnloadMusicStream, (Music music));
+RAYLIB64_FUNCTION(void, PlayMusicStream, (Music music));
+RAYLIB64_FUNCTION(bool, IsMusicStreamPlaying, (Music music));
+RAYLIB64_FUNCTION(void, UpdateMusicStream, (Music music));
+RAYLIB64_FUNCTION(void, StopMusicStream, (Music music));
+RAYLIB64_FUNCTION(void, PauseMusicStream, (Music music));
+RAYLIB64_FUNCTION(void, ResumeMusicStream, (Music music));
+RAYLIB64_FUNCTION(void, SeekMusicStream, (Music music, float position));
+RAYLIB64_FUNCTION(void, SetMusicVolume, (Music music, float volume));
+RAYLIB64_FUNCTION(void, SetMusicPitch, (Music music, float pitch));
+RAYLIB64_FUNCTION(void, SetMusicPan, (Music music, float pan));
+RAYLIB64_FUNCTION(float, GetMusicTimeLength, (Music music));
+RAYLIB64_FUNCTION(float, GetMusicTimePlayed, (Music music));
+RAYLIB64_FUNCTION(AudioStream, LoadAudioStream, (unsigned int sampleRate, unsigned int sampleSize, unsigned int channels));
+RAYLIB64_FUNCTION(bool, IsAudioStreamReady, (AudioStream stream));
+RAYLIB64_FUNCTION(void, UnloadAudioStream, (AudioStream stream));
+RAYLIB64_FUNCTION(void, UpdateAudioStream, (AudioStream stream, void *data, int frameCount));
+RAYLIB64_FUNCTION(bool, IsAudioStreamProcessed, (AudioStream stream));
+RAYLIB64_FUNCTION(void, PlayAudioStream, (AudioStream stream));
+RAYLIB64_FUNCTION(void, PauseAudioStream, (AudioStream stream));
+RAYLIB64_FUNCTION(void, ResumeAudioStream, (AudioStream stream));
+RAYLIB64_FUNCTION(bool, IsAudioStreamPlaying, (AudioStream stream));
+RAYLIB64_FUNCTION(void, StopAudioStream, (AudioStream stream));
+RAYLIB64_FUNCTION(void, SetAudioStreamVolume, (AudioStream stream, float volume));
+RAYLIB64_FUNCTION(void, SetAudioStreamPitch, (AudioStream stream, float pitch));
+RAYLIB64_FUNCTION(void, SetAudioStreamPan, (AudioStream stream, float pan));
+RAYLIB64_FUNCTION(void, SetAudioStreamBufferSizeDefault, (int size));
+RAYLIB64_FUNCTION(void, SetAudioStreamCallback, (AudioStream stream, AudioCallback callback));
+RAYLIB64_FUNCTION(void, AttachAudioStreamProcessor, (AudioStream stream, AudioCallback processor));
+RAYLIB64_FUNCTION(void, DetachAudioStreamProcessor, (AudioStream stream, AudioCallback processor));
+RAYLIB64_FUNCTION(void, AttachAudioMixedProcessor, (AudioCallback processor));
+RAYLIB64_FUNCTION(void, DetachAudioMixedProcessor, (AudioCallback processor));
+
+//  rlgl functions used by the instance buffer helpers
+RAYLIB64_FUNCTION(void, rlEnableShader, (unsigned int id));
+RAYLIB64_FUNCTION(void, rlDisableShader, ());
+RAYLIB64_FUNCTION(void, rlSetUniform, (int locIndex, const void *value, int uniformType, int count));
+RAYLIB64_FUNCTION(void, rlSetUniformMatrix, (int locIndex, Matrix mat));
+RAYLIB64_FUNCTION(Matrix, rlGetMatrixModelview, ());
+RAYLIB64_FUNCTION(Matrix, rlGetMatrixProjection, ());
+RAYLIB64_FUNCTION(Matrix, rlGetMatrixTransform, ());
+RAYLIB64_FUNCTION(bool, rlIsStereoRenderEnabled, ());
+RAYLIB64_FUNCTION(bool, rlEnableVertexArray, (unsigned int vaoId));
+RAYLIB64_FUNCTION(void, rlDisableVertexArray, ());
+RAYLIB64_FUNCTION(void, rlEnableVertexBuffer, (unsigned int id));
+RAYLIB64_FUNCTION(void, rlDisableVertexBuffer, ());
+RAYLIB64_FUNCTION(void, rlDisableVertexBufferElement, ());
+RAYLIB64_FUNCTION(void, rlEnableVertexAttribute, (unsigned int index));
+RAYLIB64_FUNCTION(void, rlDisableVertexAttribute, (unsigned int index));
+RAYLIB64_FUNCTION(void, rlSetVertexAttribute, (unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer));
+RAYLIB64_FUNCTION(void, rlSetVertexAttributeDivisor, (unsigned int index, int divisor));
+RAYLIB64_FUNCTION(unsigned int, rlLoadVertexBuffer, (const void *buffer, int size, bool dynamic));
+RAYLIB64_FUNCTION(void, rlUpdateVertexBuffer, (unsigned int bufferId, const void *data, int dataSize, int offset));
+RAYLIB64_FUNCTION(void, rlUnloadVertexBuffer, (unsigned int vboId));
+RAYLIB64_FUNCTION(void, rlActiveTextureSlot, (int slot));
+RAYLIB64_FUNCTION(void, rlEnableTexture, (unsigned int id));
+RAYLIB64_FUNCTION(void, rlDisableTexture, ());
+RAYLIB64_FUNCTION(void, rlEnableTextureCubemap, (unsigned int id));
+RAYLIB64_FUNCTION(void, rlDisableTextureCubemap, ());
+RAYLIB64_FUNCTION(void, rlDrawVertexArrayElementsInstanced, (int offset, int count, const void *buffer, int instances));
+RAYLIB64_FUNCTION(void, rlDrawVertexArrayInstanced, (int offset, int count, int instances));
+
+#if defined(RAYLIB64_DIRECT_LINK)
+    }
+}
+
+// Nothing to clean up when raylib is linked at build time
+static void ___done_raylib64()
+{
+#if defined(RAYLIB64_INSTRUMENT)
+    ___dump_stats_raylib64(RAYLIB64_INSTRUMENT_FILE);
+#endif
+}
 
+// Nothing to load when raylib is linked at build time
+qb_bool ___init_raylib64()
+{
+    return QB_TRUE;
+}
+#else
 // This cleans up everything and closes the shared library object
 static void ___done_raylib64()
 {
+#if defined(RAYLIB64_INSTRUMENT)
+    if (_raylib64)
+        ___dump_stats_raylib64(RAYLIB64_INSTRUMENT_FILE);
+#endif
+
     _InitWindow = nullptr;
     _CloseWindow = nullptr;
     _WindowShouldClose = nullptr;
@@ -1502,6 +1762,33 @@ static void ___done_raylib64()
     _DetachAudioStreamProcessor = nullptr;
     _AttachAudioMixedProcessor = nullptr;
     _DetachAudioMixedProcessor = nullptr;
+    _rlEnableShader = nullptr;
+    _rlDisableShader = nullptr;
+    _rlSetUniform = nullptr;
+    _rlSetUniformMatrix = nullptr;
+    _rlGetMatrixModelview = nullptr;
+    _rlGetMatrixProjection = nullptr;
+    _rlGetMatrixTransform = nullptr;
+    _rlIsStereoRenderEnabled = nullptr;
+    _rlEnableVertexArray = nullptr;
+    _rlDisableVertexArray = nullptr;
+    _rlEnableVertexBuffer = nullptr;
+    _rlDisableVertexBuffer = nullptr;
+    _rlDisableVertexBufferElement = nullptr;
+    _rlEnableVertexAttribute = nullptr;
+    _rlDisableVertexAttribute = nullptr;
+    _rlSetVertexAttribute = nullptr;
+    _rlSetVertexAttributeDivisor = nullptr;
+    _rlLoadVertexBuffer = nullptr;
+    _rlUpdateVertexBuffer = nullptr;
+    _rlUnloadVertexBuffer = nullptr;
+    _rlActiveTextureSlot = nullptr;
+    _rlEnableTexture = nullptr;
+    _rlDisableTexture = nullptr;
+    _rlEnableTextureCubemap = nullptr;
+    _rlDisableTextureCubemap = nullptr;
+    _rlDrawVertexArrayElementsInstanced = nullptr;
+    _rlDrawVertexArrayInstanced = nullptr;
 
     delete _raylib64;
     _raylib64 = nullptr;
@@ -1534,6 +1821,7 @@ qb_bool ___init_raylib64()
         }
     }
 
+#if !defined(RAYLIB64_LAZY_BINDING)
     try
     {
         _InitWindow = _raylib64->get_function<void(int, int, char *)>("InitWindow");
@@ -2088,6 +2376,33 @@ qb_bool ___init_raylib64()
         _DetachAudioStreamProcessor = _raylib64->get_function<void(AudioStream, AudioCallback)>("DetachAudioStreamProcessor");
         _AttachAudioMixedProcessor = _raylib64->get_function<void(AudioCallback)>("AttachAudioMixedProcessor");
         _DetachAudioMixedProcessor = _raylib64->get_function<void(AudioCallback)>("DetachAudioMixedProcessor");
+        _rlEnableShader = _raylib64->get_function<void(unsigned int)>("rlEnableShader");
+        _rlDisableShader = _raylib64->get_function<void()>("rlDisableShader");
+        _rlSetUniform = _raylib64->get_function<void(int, const void *, int, int)>("rlSetUniform");
+        _rlSetUniformMatrix = _raylib64->get_function<void(int, Matrix)>("rlSetUniformMatrix");
+        _rlGetMatrixModelview = _raylib64->get_function<Matrix()>("rlGetMatrixModelview");
+        _rlGetMatrixProjection = _raylib64->get_function<Matrix()>("rlGetMatrixProjection");
+        _rlGetMatrixTransform = _raylib64->get_function<Matrix()>("rlGetMatrixTransform");
+        _rlIsStereoRenderEnabled = _raylib64->get_function<bool()>("rlIsStereoRenderEnabled");
+        _rlEnableVertexArray = _raylib64->get_function<bool(unsigned int)>("rlEnableVertexArray");
+        _rlDisableVertexArray = _raylib64->get_function<void()>("rlDisableVertexArray");
+        _rlEnableVertexBuffer = _raylib64->get_function<void(unsigned int)>("rlEnableVertexBuffer");
+        _rlDisableVertexBuffer = _raylib64->get_function<void()>("rlDisableVertexBuffer");
+        _rlDisableVertexBufferElement = _raylib64->get_function<void()>("rlDisableVertexBufferElement");
+        _rlEnableVertexAttribute = _raylib64->get_function<void(unsigned int)>("rlEnableVertexAttribute");
+        _rlDisableVertexAttribute = _raylib64->get_function<void(unsigned int)>("rlDisableVertexAttribute");
+        _rlSetVertexAttribute = _raylib64->get_function<void(unsigned int, int, int, bool, int, const void *)>("rlSetVertexAttribute");
+        _rlSetVertexAttributeDivisor = _raylib64->get_function<void(unsigned int, int)>("rlSetVertexAttributeDivisor");
+        _rlLoadVertexBuffer = _raylib64->get_function<unsigned int(const void *, int, bool)>("rlLoadVertexBuffer");
+        _rlUpdateVertexBuffer = _raylib64->get_function<void(unsigned int, const void *, int, int)>("rlUpdateVertexBuffer");
+        _rlUnloadVertexBuffer = _raylib64->get_function<void(unsigned int)>("rlUnloadVertexBuffer");
+        _rlActiveTextureSlot = _raylib64->get_function<void(int)>("rlActiveTextureSlot");
+        _rlEnableTexture = _raylib64->get_function<void(unsigned int)>("rlEnableTexture");
+        _rlDisableTexture = _raylib64->get_function<void()>("rlDisableTexture");
+        _rlEnableTextureCubemap = _raylib64->get_function<void(unsigned int)>("rlEnableTextureCubemap");
+        _rlDisableTextureCubemap = _raylib64->get_function<void()>("rlDisableTextureCubemap");
+        _rlDrawVertexArrayElementsInstanced = _raylib64->get_function<void(int, int, const void *, int)>("rlDrawVertexArrayElementsInstanced");
+        _rlDrawVertexArrayInstanced = _raylib64->get_function<void(int, int, int)>("rlDrawVertexArrayInstanced");
     }
     catch (dylib::symbol_error e)
     {
@@ -2095,6 +2410,7 @@ qb_bool ___init_raylib64()
         ___done_raylib64();
         return QB_FALSE;
     }
+#endif
 
     atexit(___done_raylib64);
 
@@ -2103,6 +2419,46 @@ qb_bool ___init_raylib64()
     return QB_TRUE;
 }
 
+#if defined(RAYLIB64_LAZY_BINDING)
+// This resolves a raylib function pointer the first time it is called
+template <typename T>
+T *___resolve_raylib64(T *&fn, const char *name)
+{
+    if (!_raylib64)
+    {
+        RAYLIB_DEBUG_PRINT("Error: Could not get symbol \"%s\"\nShared library is not loaded", name);
+        exit(EXIT_FAILURE);
+    }
+
+    try
+    {
+        fn = _raylib64->get_function<T>(name);
+    }
+    catch (dylib::symbol_error e)
+    {
+        RAYLIB_DEBUG_PRINT("Error: %s", e.what());
+        exit(EXIT_FAILURE);
+    }
+
+    return fn;
+}
+
+#define RAYLIB64_TARGET(_name_) ((_##_name_) ? (_##_name_) : ___resolve_raylib64(_##_name_, #_name_))
+#else
+#define RAYLIB64_TARGET(_name_) _##_name_
+#endif
+#endif
+
+#if defined(RAYLIB64_INSTRUMENT)
+// Every call is timed and recorded against the binding's entry in the statistics table
+#define RAYLIB64_CALL(_name_) ___timed_raylib64(RAYLIB64_TARGET(_name_), []() {                  \
+    static auto binding = ___stats_raylib64(#_name_);                                             \
+    return binding;                                                                               \
+}())
+#else
+#define RAYLIB64_CALL(_name_) RAYLIB64_TARGET(_name_)
+#endif
+
 // Various interop functions that make life easy when working with external libs
 
 /// @brief Returns QB style bool
@@ -2121,6 +2477,53 @@ inline const uint8_t *CStr(uintptr_t p)
     return (const uint8_t *)p;
 }
 
+// Number of per-thread scratch strings handed out by ToCStringScratch() before they are reused
+#define RAYLIB64_SCRATCH_STRINGS 8
+
+/// @brief Per-thread ring of reusable NUL-terminated string buffers
+struct ___scratch_strings_raylib64
+{
+    char *buffer[RAYLIB64_SCRATCH_STRINGS];
+    size_t capacity[RAYLIB64_SCRATCH_STRINGS];
+    unsigned next;
+
+    ~___scratch_strings_raylib64()
+    {
+        for (auto i = 0; i < RAYLIB64_SCRATCH_STRINGS; i++)
+            free(buffer[i]);
+    }
+};
+
+/// @brief Copies a QB64 string to a NUL-terminated C string in a per-thread scratch buffer. The buffers only grow, so this stops allocating once warmed up
+/// @param s The QB64 string data
+/// @param length The length of the QB64 string
+/// @return A pointer (_OFFSET) to the C string. It stays valid until RAYLIB64_SCRATCH_STRINGS more strings are converted on the same thread
+inline uintptr_t ToCStringScratch(const char *s, size_t length)
+{
+    thread_local ___scratch_strings_raylib64 scratch = {};
+
+    auto slot = scratch.next++ % RAYLIB64_SCRATCH_STRINGS;
+
+    if (scratch.capacity[slot] <= length)
+    {
+        auto capacity = scratch.capacity[slot] ? scratch.capacity[slot] : 64;
+        while (capacity <= length)
+            capacity <<= 1;
+
+        auto buffer = (char *)realloc(scratch.buffer[slot], capacity);
+        if (!buffer)
+            return (uintptr_t) "";
+
+        scratch.buffer[slot] = buffer;
+        scratch.capacity[slot] = capacity;
+    }
+
+    memcpy(scratch.buffer[slot], s, length);
+    scratch.buffer[slot][length] = '\0';
+
+    return (uintptr_t)scratch.buffer[slot];
+}
+
 /// @brief Copies count bytes from src to dst
 /// @param dst The destination memory pointer
 /// @param src The source memory pointer
@@ -2276,6 +2679,77 @@ inline void PokeType(uintptr_t p, uintptr_t o, uintptr_t t, size_t t_size)
     memcpy((uint8_t *)p + (o * t_size), (void *)t, t_size);
 }
 
+/// @brief Copies count blocks of N bytes between two strided arrays. The fixed size lets the compiler use plain (vector) loads and stores instead of a memcpy call
+template <size_t N>
+inline void ___copy_strided_raylib64(uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride, size_t count)
+{
+    for (size_t i = 0; i < count; i++, dst += dstStride, src += srcStride)
+        memcpy(dst, src, N);
+}
+
+/// @brief Copies count blocks of size bytes between two strided arrays
+inline void ___copy_strided_raylib64(uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride, size_t size, size_t count)
+{
+    if (dstStride == size && srcStride == size)
+    {
+        memcpy(dst, src, size * count); // both sides are packed
+        return;
+    }
+
+    switch (size)
+    {
+    case 1:
+        ___copy_strided_raylib64<1>(dst, dstStride, src, srcStride, count);
+        break;
+    case 2:
+        ___copy_strided_raylib64<2>(dst, dstStride, src, srcStride, count);
+        break;
+    case 4:
+        ___copy_strided_raylib64<4>(dst, dstStride, src, srcStride, count);
+        break;
+    case 8:
+        ___copy_strided_raylib64<8>(dst, dstStride, src, srcStride, count);
+        break;
+    case 12:
+        ___copy_strided_raylib64<12>(dst, dstStride, src, srcStride, count);
+        break;
+    case 16:
+        ___copy_strided_raylib64<16>(dst, dstStride, src, srcStride, count);
+        break;
+    default:
+        for (size_t i = 0; i < count; i++, dst += dstStride, src += srcStride)
+            memcpy(dst, src, size);
+    }
+}
+
+/// @brief Gathers count values from native memory into a QB64 array in one call. Same as t[i].field = p[i].field for i = 0 to count - 1
+/// @param p The native base pointer
+/// @param p_offset Byte offset of the first value in p (e.g. element * p_stride + field offset)
+/// @param p_stride Bytes between consecutive values in p
+/// @param t A pointer to the QB64 array (or UDT variable)
+/// @param t_offset Byte offset of the first value in t
+/// @param t_stride Bytes between consecutive values in t
+/// @param t_size The number of bytes copied per value
+/// @param count The number of values to copy
+inline void PeekTypeStrided(uintptr_t p, uintptr_t p_offset, size_t p_stride, uintptr_t t, uintptr_t t_offset, size_t t_stride, size_t t_size, size_t count)
+{
+    ___copy_strided_raylib64((uint8_t *)t + t_offset, t_stride, (const uint8_t *)p + p_offset, p_stride, t_size, count);
+}
+
+/// @brief Scatters count values from a QB64 array to native memory in one call. Same as p[i].field = t[i].field for i = 0 to count - 1
+/// @param p The native base pointer
+/// @param p_offset Byte offset of the first value in p (e.g. element * p_stride + field offset)
+/// @param p_stride Bytes between consecutive values in p
+/// @param t A pointer to the QB64 array (or UDT variable)
+/// @param t_offset Byte offset of the first value in t
+/// @param t_stride Bytes between consecutive values in t
+/// @param t_size The number of bytes copied per value
+/// @param count The number of values to copy
+inline void PokeTypeStrided(uintptr_t p, uintptr_t p_offset, size_t p_stride, uintptr_t t, uintptr_t t_offset, size_t t_stride, size_t t_size, size_t count)
+{
+    ___copy_strided_raylib64((uint8_t *)p + p_offset, p_stride, (const uint8_t *)t + t_offset, t_stride, t_size, count);
+}
+
 /// @brief Peek a character value in a string. Zero based, faster and unsafe than ASC
 /// @param s A QB64 string
 /// @param o Offset from base (zero based)
@@ -2549,2472 +3023,4157 @@ inline void RGBAToRColor(uint32_t rgba, void *retVal)
     *(uint32_t *)retVal = rgba;
 }
 
-// Initialize window and OpenGL context
-inline void InitWindow(int width, int height, char *title)
+/// @brief Writes the binding call statistics to a file. This only works when RAYLIB64_INSTRUMENT is defined
+/// @param fileName The output file name. A .json extension selects JSON, anything else is CSV
+/// @return True if the file was written
+inline qb_bool DumpBindingStats(uintptr_t fileName)
 {
-    _InitWindow(width, height, title);
+#if defined(RAYLIB64_INSTRUMENT)
+    return TO_QB_BOOL(___dump_stats_raylib64((char *)fileName));
+#else
+    (void)fileName;
+    return QB_FALSE;
+#endif
 }
 
-// Close window and unload OpenGL context
-inline void CloseWindow()
+/// @brief Clears the binding call statistics. This does nothing unless RAYLIB64_INSTRUMENT is defined
+inline void ResetBindingStats()
 {
-    _CloseWindow();
+#if defined(RAYLIB64_INSTRUMENT)
+    for (size_t i = 0; i < ___stats_count_raylib64; i++)
+    {
+        auto binding = &___stats_table_raylib64[i];
+        *binding = {binding->name};
+    }
+#endif
 }
 
-// Check if application should close (KEY_ESCAPE pressed or windows close icon clicked)
-inline qb_bool WindowShouldClose()
-{
-    return TO_QB_BOOL(_WindowShouldClose());
-}
+// Frame profiler: named CPU scopes recorded into a lock-free ring buffer. Frames are delimited by BeginDrawing() / EndDrawing()
+#define RAYLIB64_PROFILER_MAX_SCOPES 256
+#define RAYLIB64_PROFILER_MAX_SCOPE_NAME 32
+#define RAYLIB64_PROFILER_MAX_DEPTH 64
+#define RAYLIB64_PROFILER_SCOPE_FRAME 0   // Reserved scope for whole frames (EndDrawing to EndDrawing)
+#define RAYLIB64_PROFILER_SCOPE_DRAWING 1 // Reserved scope for BeginDrawing to EndDrawing
 
-// Check if window has been initialized successfully
-inline qb_bool IsWindowReady()
+// A completed scope in the ring buffer
+struct ___profiler_event_raylib64
 {
-    return TO_QB_BOOL(_IsWindowReady());
-}
+    std::atomic<uint64_t> sequence; // Write index + 1 once the event is complete; used to detect overwritten slots
+    uint64_t start;                 // Start time in ns since InitFrameProfiler()
+    uint64_t duration;              // Duration in ns
+    uint32_t frame;                 // Frame number the scope ended in
+    uint16_t scope;                 // Scope id
+    uint8_t thread;                 // Small thread number
+    uint8_t depth;                  // Nesting depth
+};
 
-// Check if window is currently fullscreen
-inline qb_bool IsWindowFullscreen()
-{
-    return TO_QB_BOOL(_IsWindowFullscreen());
-}
+static ___profiler_event_raylib64 *___profiler_ring_raylib64 = nullptr;
+static uint64_t ___profiler_mask_raylib64 = 0;
+static std::atomic<uint64_t> ___profiler_head_raylib64(0);
+static std::chrono::steady_clock::time_point ___profiler_epoch_raylib64;
+static char ___profiler_names_raylib64[RAYLIB64_PROFILER_MAX_SCOPES][RAYLIB64_PROFILER_MAX_SCOPE_NAME] = {"Frame", "Drawing"};
+static std::atomic<int> ___profiler_name_count_raylib64(2);
+static std::atomic_flag ___profiler_name_lock_raylib64 = ATOMIC_FLAG_INIT;
+static std::atomic<uint32_t> ___profiler_frame_raylib64(0);
+static uint64_t ___profiler_frame_start_raylib64 = 0;
+static uint64_t ___profiler_drawing_start_raylib64 = 0;
+
+// Per-thread stack of open scopes
+struct ___profiler_stack_raylib64
+{
+    uint8_t thread;
+    int depth;
+    uint16_t scope[RAYLIB64_PROFILER_MAX_DEPTH];
+    uint64_t start[RAYLIB64_PROFILER_MAX_DEPTH];
+};
 
-// Check if window is currently hidden (only PLATFORM_DESKTOP)
-inline qb_bool IsWindowHidden()
+static ___profiler_stack_raylib64 &___profiler_thread_raylib64()
 {
-    return TO_QB_BOOL(_IsWindowHidden());
+    static std::atomic<uint8_t> threads(0);
+    thread_local ___profiler_stack_raylib64 stack = {threads.fetch_add(1, std::memory_order_relaxed), 0, {}, {}};
+    return stack;
 }
 
-// Check if window is currently minimized (only PLATFORM_DESKTOP)
-inline qb_bool IsWindowMinimized()
+static inline uint64_t ___profiler_now_raylib64()
 {
-    return TO_QB_BOOL(_IsWindowMinimized());
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ___profiler_epoch_raylib64).count());
 }
 
-// Check if window is currently maximized (only PLATFORM_DESKTOP)
-inline qb_bool IsWindowMaximized()
+// Appends a completed scope to the ring buffer. Any thread can call this
+static void ___profiler_record_raylib64(uint16_t scope, uint64_t start, uint64_t end, uint8_t thread, int depth)
 {
-    return TO_QB_BOOL(_IsWindowMaximized());
-}
+    auto index = ___profiler_head_raylib64.fetch_add(1, std::memory_order_relaxed);
+    auto event = &___profiler_ring_raylib64[index & ___profiler_mask_raylib64];
 
-// Check if window is currently focused (only PLATFORM_DESKTOP)
-inline qb_bool IsWindowFocused()
-{
-    return TO_QB_BOOL(_IsWindowFocused());
+    event->sequence.store(0, std::memory_order_relaxed); // mark the slot as being written
+    std::atomic_thread_fence(std::memory_order_release);
+    event->start = start;
+    event->duration = end - start;
+    event->frame = ___profiler_frame_raylib64.load(std::memory_order_relaxed);
+    event->scope = scope;
+    event->thread = thread;
+    event->depth = uint8_t(depth);
+    event->sequence.store(index + 1, std::memory_order_release);
 }
 
-// Check if window has been resized last frame
-inline qb_bool IsWindowResized()
+// Called by the BeginDrawing() wrapper
+static inline void ___profiler_begin_drawing_raylib64()
 {
-    return TO_QB_BOOL(_IsWindowResized());
+    if (___profiler_ring_raylib64)
+        ___profiler_drawing_start_raylib64 = ___profiler_now_raylib64();
 }
 
-// Check if one specific window flag is enabled
-inline qb_bool IsWindowState(unsigned int flag)
+// Called by the EndDrawing() wrapper; this closes the current frame
+static inline void ___profiler_end_drawing_raylib64()
 {
-    return TO_QB_BOOL(_IsWindowState(flag));
-}
+    if (!___profiler_ring_raylib64)
+        return;
 
-// Set window configuration state using flags (only PLATFORM_DESKTOP)
-inline void SetWindowState(unsigned int flags)
-{
-    _SetWindowState(flags);
-}
+    auto now = ___profiler_now_raylib64();
+    auto thread = ___profiler_thread_raylib64().thread;
 
-// Clear window configuration state flags
-inline void ClearWindowState(unsigned int flags)
-{
-    _ClearWindowState(flags);
-}
+    ___profiler_record_raylib64(RAYLIB64_PROFILER_SCOPE_DRAWING, ___profiler_drawing_start_raylib64, now, thread, 1);
+    ___profiler_record_raylib64(RAYLIB64_PROFILER_SCOPE_FRAME, ___profiler_frame_start_raylib64, now, thread, 0);
 
-// Toggle window state: fullscreen/windowed (only PLATFORM_DESKTOP)
-inline void ToggleFullscreen()
-{
-    _ToggleFullscreen();
+    ___profiler_frame_start_raylib64 = now;
+    ___profiler_frame_raylib64.fetch_add(1, std::memory_order_relaxed);
 }
 
-// Toggle window state: borderless windowed (only PLATFORM_DESKTOP)
-inline void ToggleBorderlessWindowed()
+/// @brief Starts the frame profiler. Nothing is recorded until this is called
+/// @param capacity The number of scopes kept in the ring buffer (rounded up to a power of 2). Older scopes are overwritten
+inline void InitFrameProfiler(int capacity)
 {
-    _ToggleBorderlessWindowed();
-}
+    if (___profiler_ring_raylib64 || capacity <= 0)
+        return;
 
-// Set window state: maximized, if resizable (only PLATFORM_DESKTOP)
-inline void MaximizeWindow()
-{
-    _MaximizeWindow();
-}
+    uint64_t size = 1;
+    while (size < uint64_t(capacity))
+        size <<= 1;
 
-// Set window state: minimized, if resizable (only PLATFORM_DESKTOP)
-inline void MinimizeWindow()
-{
-    _MinimizeWindow();
+    ___profiler_ring_raylib64 = new ___profiler_event_raylib64[size]();
+    ___profiler_mask_raylib64 = size - 1;
+    ___profiler_head_raylib64 = 0;
+    ___profiler_frame_raylib64 = 0;
+    ___profiler_epoch_raylib64 = std::chrono::steady_clock::now();
+    ___profiler_frame_start_raylib64 = ___profiler_drawing_start_raylib64 = 0;
 }
 
-// Set window state: not minimized/maximized (only PLATFORM_DESKTOP)
-inline void RestoreWindow()
+/// @brief Stops the frame profiler and frees the ring buffer. This must not be called while other threads are recording scopes
+inline void CloseFrameProfiler()
 {
-    _RestoreWindow();
+    delete[] ___profiler_ring_raylib64;
+    ___profiler_ring_raylib64 = nullptr;
 }
 
-// Set icon for window (single image, RGBA 32bit, only PLATFORM_DESKTOP)
-inline void SetWindowIcon(void *image)
+/// @brief Returns the id of a named profiler scope, registering the name on first use
+/// @param name The scope name (e.g. "Update", "Physics")
+/// @return A scope id to pass to BeginProfileScope() or -1 if there are too many scopes
+inline int32_t GetProfileScope(uintptr_t name)
 {
-    _SetWindowIcon(*(Image *)image);
-}
+    while (___profiler_name_lock_raylib64.test_and_set(std::memory_order_acquire))
+        ;
 
-// Set icon for window (multiple images, RGBA 32bit, only PLATFORM_DESKTOP)
-inline void SetWindowIcons(void *images, int count)
-{
-    _SetWindowIcons((Image *)images, count);
-}
+    int32_t id = 0, count = ___profiler_name_count_raylib64.load(std::memory_order_relaxed);
+    while (id < count && strncmp(___profiler_names_raylib64[id], (char *)name, RAYLIB64_PROFILER_MAX_SCOPE_NAME - 1))
+        id++;
 
-// Set title for window (only PLATFORM_DESKTOP and PLATFORM_WEB)
-inline void SetWindowTitle(char *title)
-{
-    _SetWindowTitle(title);
-}
+    if (id == count)
+    {
+        if (count < RAYLIB64_PROFILER_MAX_SCOPES)
+        {
+            strncpy(___profiler_names_raylib64[id], (char *)name, RAYLIB64_PROFILER_MAX_SCOPE_NAME - 1);
+            ___profiler_name_count_raylib64.store(count + 1, std::memory_order_release);
+        }
+        else
+            id = -1;
+    }
 
-// Set window position on screen (only PLATFORM_DESKTOP)
-inline void SetWindowPosition(int x, int y)
-{
-    _SetWindowPosition(x, y);
-}
+    ___profiler_name_lock_raylib64.clear(std::memory_order_release);
 
-// Set monitor for the current window
-inline void SetWindowMonitor(int monitor)
-{
-    _SetWindowMonitor(monitor);
+    return id;
 }
 
-// Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)
-inline void SetWindowMinSize(int width, int height)
+/// @brief Opens a profiler scope on the calling thread. Scopes can be nested
+/// @param scope A scope id from GetProfileScope(). Unregistered ids are ignored
+inline void BeginProfileScope(int32_t scope)
 {
-    _SetWindowMinSize(width, height);
-}
+    auto &stack = ___profiler_thread_raylib64();
 
-// Set window maximum dimensions (for FLAG_WINDOW_RESIZABLE)
-inline void SetWindowMaxSize(int width, int height)
-{
-    _SetWindowMaxSize(width, height);
+    if (___profiler_ring_raylib64 && scope >= 0 && scope < ___profiler_name_count_raylib64.load(std::memory_order_acquire) &&
+        stack.depth < RAYLIB64_PROFILER_MAX_DEPTH)
+    {
+        stack.scope[stack.depth] = uint16_t(scope);
+        stack.start[stack.depth] = ___profiler_now_raylib64();
+        stack.depth++;
+    }
 }
 
-// Set window dimensions
-inline void SetWindowSize(int width, int height)
+/// @brief Closes the innermost profiler scope opened on the calling thread
+inline void EndProfileScope()
 {
-    _SetWindowSize(width, height);
-}
+    auto &stack = ___profiler_thread_raylib64();
 
-// Set window opacity [0.0f..1.0f] (only PLATFORM_DESKTOP)
-inline void SetWindowOpacity(float opacity)
-{
-    _SetWindowOpacity(opacity);
+    if (___profiler_ring_raylib64 && stack.depth > 0)
+    {
+        stack.depth--;
+        ___profiler_record_raylib64(stack.scope[stack.depth], stack.start[stack.depth], ___profiler_now_raylib64(), stack.thread, stack.depth + 1);
+    }
 }
 
-// Set window focused (only PLATFORM_DESKTOP)
-inline void SetWindowFocused()
+// Writes a scope name as a JSON string body or as a CSV field followed by suffix
+static void ___profiler_write_name_raylib64(FILE *file, const char *name, const char *suffix, bool json)
 {
-    _SetWindowFocused();
+    if (json)
+    {
+        for (auto c = name; *c; c++)
+        {
+            if (*c == '"' || *c == '\\')
+                fprintf(file, "\\%c", *c);
+            else if (uint8_t(*c) < 0x20)
+                fprintf(file, "\\u%04x", unsigned(uint8_t(*c)));
+            else
+                fputc(*c, file);
+        }
+        fputs(suffix, file);
+    }
+    else if (strpbrk(name, ",\"\r\n"))
+    {
+        fputc('"', file);
+        for (auto c = name; *c; c++)
+        {
+            if (*c == '"')
+                fputc('"', file);
+            fputc(*c, file);
+        }
+        fprintf(file, "%s\"", suffix);
+    }
+    else
+        fprintf(file, "%s%s", name, suffix);
 }
 
-// Get native window handle
-inline void *GetWindowHandle()
+/// @brief Writes the recorded scopes to a file. A .json extension writes a Chrome trace (chrome://tracing, Perfetto), anything else writes one CSV row per frame
+/// @param fileName The output file name
+/// @return True if the file was written
+inline qb_bool ExportFrameProfile(uintptr_t fileName)
 {
-    return _GetWindowHandle();
-}
+    if (!___profiler_ring_raylib64)
+        return QB_FALSE;
 
-// Get current screen width
-inline int GetScreenWidth()
-{
-    return _GetScreenWidth();
-}
+    // Take a consistent copy of everything still in the ring buffer
+    auto head = ___profiler_head_raylib64.load(std::memory_order_acquire);
+    auto size = ___profiler_mask_raylib64 + 1;
+    auto first = head > size ? head - size : 0;
+    auto events = new ___profiler_event_raylib64[head - first];
+    size_t count = 0;
 
-// Get current screen height
+    for (auto i = first; i < head; i++)
+    {
+        auto slot = &___profiler_ring_raylib64[i & ___profiler_mask_raylib64];
+        if (slot->sequence.load(std::memory_order_acquire) != i + 1)
+            continue;
+
+        auto event = &events[count];
+        event->start = slot->start;
+        event->duration = slot->duration;
+        event->frame = slot->frame;
+        event->scope = slot->scope;
+        event->thread = slot->thread;
+        event->depth = slot->depth;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == i + 1)
+            count++;
+    }
+
+    auto ext = strrchr((char *)fileName, '.');
+    auto json = ext && !strcmp(ext, ".json");
+    auto file = fopen((char *)fileName, "w");
+
+    if (!file)
+    {
+        RAYLIB_DEBUG_PRINT("Error: Failed to create %s", (char *)fileName);
+        delete[] events;
+        return QB_FALSE;
+    }
+
+    auto scopes = ___profiler_name_count_raylib64.load(std::memory_order_acquire);
+
+    if (json)
+    {
+        fputs("{\"traceEvents\": [\n", file);
+        for (size_t i = 0; i < count; i++)
+        {
+            fputs("  {\"name\": \"", file);
+            ___profiler_write_name_raylib64(file, ___profiler_names_raylib64[events[i].scope], "", true);
+            fprintf(file, "\", \"cat\": \"raylib-64\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %u, \"args\": {\"frame\": %u}}%s\n",
+                    events[i].start / 1000.0, events[i].duration / 1000.0, unsigned(events[i].thread), events[i].frame, i + 1 < count ? "," : "");
+        }
+        fputs("], \"displayTimeUnit\": \"ms\"}\n", file);
+    }
+    else
+    {
+        fputs("frame,start_ms", file);
+        for (int32_t s = 0; s < scopes; s++)
+        {
+            fputc(',', file);
+            ___profiler_write_name_raylib64(file, ___profiler_names_raylib64[s], "_ms", false);
+        }
+        fputs("\n", file);
+
+        // Events are in completion order and the frame event is the last one of each frame
+        auto totals = new double[scopes]();
+        for (size_t i = 0; i < count; i++)
+        {
+            totals[events[i].scope] += events[i].duration / 1000000.0;
+
+            if (events[i].scope == RAYLIB64_PROFILER_SCOPE_FRAME)
+            {
+                fprintf(file, "%u,%.3f", events[i].frame, events[i].start / 1000000.0);
+                for (int32_t s = 0; s < scopes; s++)
+                {
+                    fprintf(file, ",%.3f", totals[s]);
+                    totals[s] = 0.0;
+                }
+                fputs("\n", file);
+            }
+        }
+        delete[] totals;
+    }
+
+    fclose(file);
+    delete[] events;
+
+    return QB_TRUE;
+}
+
+// Set while a thread (worker or caller) runs loop chunks. Loops started from inside a chunk then run inline instead of waiting on the busy pool
+static thread_local bool ___worker_nested_raylib64 = false;
+
+// Worker pool: background threads for data-parallel loops. The calling thread always takes part, so a pool of N threads has N - 1 workers
+struct ___worker_pool_raylib64
+{
+    std::vector<std::thread> threads;
+    std::mutex mutex;                // Guards everything below
+    std::mutex busy;                 // Serializes loops started from different threads
+    std::condition_variable wake;    // Workers wait here for a new loop
+    std::condition_variable done;    // The caller waits here for the workers to leave the loop
+    const std::function<void(size_t, size_t)> *job = nullptr;
+    size_t count = 0;                // Loop range is [0, count)
+    size_t grain = 1;                // Indices claimed per chunk
+    std::atomic<size_t> next{0};     // Next unclaimed index
+    uint64_t generation = 0;         // Bumped for every loop so sleeping workers can tell it is new
+    size_t active = 0;               // Workers that have not finished the current loop
+    int32_t size = 0;                // Requested thread count (0 = one per hardware thread)
+    bool quit = false;
+
+    ~___worker_pool_raylib64()
+    {
+        stop();
+    }
+
+    void run()
+    {
+        size_t begin;
+
+        ___worker_nested_raylib64 = true;
+        while ((begin = next.fetch_add(grain, std::memory_order_relaxed)) < count)
+            (*job)(begin, std::min(begin + grain, count));
+        ___worker_nested_raylib64 = false;
+    }
+
+    void work()
+    {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;)
+        {
+            wake.wait(lock, [&] { return quit || generation != seen; });
+            if (quit)
+                return;
+
+            seen = generation;
+            lock.unlock();
+            run();
+            lock.lock();
+
+            if (--active == 0)
+                done.notify_one();
+        }
+    }
+
+    void start()
+    {
+        auto n = size > 0 ? size : int32_t(std::thread::hardware_concurrency());
+        for (auto i = 1; i < n; i++)
+            threads.emplace_back(&___worker_pool_raylib64::work, this);
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for (auto &t : threads)
+            t.join();
+        threads.clear();
+        quit = false;
+    }
+};
+
+inline ___worker_pool_raylib64 &___get_worker_pool_raylib64()
+{
+    static ___worker_pool_raylib64 pool;
+    return pool;
+}
+
+/// @brief Calls fn(begin, end) over [0, count) in chunks of grain indices spread across the worker pool. Returns when every chunk is done.
+/// Loops started from inside fn run on the calling thread
+inline void ___parallel_for_raylib64(size_t count, size_t grain, const std::function<void(size_t, size_t)> &fn)
+{
+    auto &pool = ___get_worker_pool_raylib64();
+
+    grain = std::max<size_t>(grain, 1);
+
+    if (___worker_nested_raylib64 || count <= grain)
+    {
+        fn(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> busy(pool.busy);
+
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (pool.threads.empty())
+            pool.start();
+        if (pool.threads.empty())
+        {
+            fn(0, count);
+            return;
+        }
+
+        pool.job = &fn;
+        pool.count = count;
+        pool.grain = grain;
+        pool.next.store(0, std::memory_order_relaxed);
+        pool.active = pool.threads.size();
+        pool.generation++;
+    }
+    pool.wake.notify_all();
+
+    pool.run();
+
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    pool.done.wait(lock, [&] { return pool.active == 0; });
+    pool.job = nullptr;
+}
+
+/// @brief Sets how many threads the library's parallel loops use (animation skinning and similar). The calling thread counts as one
+/// @param count The number of threads. 1 runs everything on the calling thread and 0 uses one thread per hardware thread (the default)
+inline void SetWorkerThreadCount(int32_t count)
+{
+    auto &pool = ___get_worker_pool_raylib64();
+    std::lock_guard<std::mutex> busy(pool.busy);
+
+    pool.stop();
+    pool.size = std::max(count, 0);
+}
+
+/// @brief Returns how many threads the library's parallel loops use, including the calling thread
+/// @return The thread count
+inline int32_t GetWorkerThreadCount()
+{
+    auto &pool = ___get_worker_pool_raylib64();
+    std::lock_guard<std::mutex> busy(pool.busy);
+
+    return pool.size > 0 ? pool.size : std::max(int32_t(std::thread::hardware_concurrency()), 1);
+}
+
+// Initialize window and OpenGL context
+inline void InitWindow(int width, int height, uintptr_t title)
+{
+    RAYLIB64_CALL(InitWindow)(width, height, (char *)title);
+}
+
+// Close window and unload OpenGL context
+inline void CloseWindow()
+{
+    RAYLIB64_CALL(CloseWindow)();
+}
+
+// Check if application should close (KEY_ESCAPE pressed or windows close icon clicked)
+inline qb_bool WindowShouldClose()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(WindowShouldClose)());
+}
+
+// Check if window has been initialized successfully
+inline qb_bool IsWindowReady()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowReady)());
+}
+
+// Check if window is currently fullscreen
+inline qb_bool IsWindowFullscreen()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowFullscreen)());
+}
+
+// Check if window is currently hidden (only PLATFORM_DESKTOP)
+inline qb_bool IsWindowHidden()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowHidden)());
+}
+
+// Check if window is currently minimized (only PLATFORM_DESKTOP)
+inline qb_bool IsWindowMinimized()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowMinimized)());
+}
+
+// Check if window is currently maximized (only PLATFORM_DESKTOP)
+inline qb_bool IsWindowMaximized()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowMaximized)());
+}
+
+// Check if window is currently focused (only PLATFORM_DESKTOP)
+inline qb_bool IsWindowFocused()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowFocused)());
+}
+
+// Check if window has been resized last frame
+inline qb_bool IsWindowResized()
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowResized)());
+}
+
+// Check if one specific window flag is enabled
+inline qb_bool IsWindowState(unsigned int flag)
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWindowState)(flag));
+}
+
+// Set window configuration state using flags (only PLATFORM_DESKTOP)
+inline void SetWindowState(unsigned int flags)
+{
+    RAYLIB64_CALL(SetWindowState)(flags);
+}
+
+// Clear window configuration state flags
+inline void ClearWindowState(unsigned int flags)
+{
+    RAYLIB64_CALL(ClearWindowState)(flags);
+}
+
+// Toggle window state: fullscreen/windowed (only PLATFORM_DESKTOP)
+inline void ToggleFullscreen()
+{
+    RAYLIB64_CALL(ToggleFullscreen)();
+}
+
+// Toggle window state: borderless windowed (only PLATFORM_DESKTOP)
+inline void ToggleBorderlessWindowed()
+{
+    RAYLIB64_CALL(ToggleBorderlessWindowed)();
+}
+
+// Set window state: maximized, if resizable (only PLATFORM_DESKTOP)
+inline void MaximizeWindow()
+{
+    RAYLIB64_CALL(MaximizeWindow)();
+}
+
+// Set window state: minimized, if resizable (only PLATFORM_DESKTOP)
+inline void MinimizeWindow()
+{
+    RAYLIB64_CALL(MinimizeWindow)();
+}
+
+// Set window state: not minimized/maximized (only PLATFORM_DESKTOP)
+inline void RestoreWindow()
+{
+    RAYLIB64_CALL(RestoreWindow)();
+}
+
+// Set icon for window (single image, RGBA 32bit, only PLATFORM_DESKTOP)
+inline void SetWindowIcon(void *image)
+{
+    RAYLIB64_CALL(SetWindowIcon)(*(Image *)image);
+}
+
+// Set icon for window (multiple images, RGBA 32bit, only PLATFORM_DESKTOP)
+inline void SetWindowIcons(void *images, int count)
+{
+    RAYLIB64_CALL(SetWindowIcons)((Image *)images, count);
+}
+
+// Set title for window (only PLATFORM_DESKTOP and PLATFORM_WEB)
+inline void SetWindowTitle(uintptr_t title)
+{
+    RAYLIB64_CALL(SetWindowTitle)((char *)title);
+}
+
+// Set window position on screen (only PLATFORM_DESKTOP)
+inline void SetWindowPosition(int x, int y)
+{
+    RAYLIB64_CALL(SetWindowPosition)(x, y);
+}
+
+// Set monitor for the current window
+inline void SetWindowMonitor(int monitor)
+{
+    RAYLIB64_CALL(SetWindowMonitor)(monitor);
+}
+
+// Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)
+inline void SetWindowMinSize(int width, int height)
+{
+    RAYLIB64_CALL(SetWindowMinSize)(width, height);
+}
+
+// Set window maximum dimensions (for FLAG_WINDOW_RESIZABLE)
+inline void SetWindowMaxSize(int width, int height)
+{
+    RAYLIB64_CALL(SetWindowMaxSize)(width, height);
+}
+
+// Set window dimensions
+inline void SetWindowSize(int width, int height)
+{
+    RAYLIB64_CALL(SetWindowSize)(width, height);
+}
+
+// Set window opacity [0.0f..1.0f] (only PLATFORM_DESKTOP)
+inline void SetWindowOpacity(float opacity)
+{
+    RAYLIB64_CALL(SetWindowOpacity)(opacity);
+}
+
+// Set window focused (only PLATFORM_DESKTOP)
+inline void SetWindowFocused()
+{
+    RAYLIB64_CALL(SetWindowFocused)();
+}
+
+// Get native window handle
+inline void *GetWindowHandle()
+{
+    return RAYLIB64_CALL(GetWindowHandle)();
+}
+
+// Get current screen width
+inline int GetScreenWidth()
+{
+    return RAYLIB64_CALL(GetScreenWidth)();
+}
+
+// Get current screen height
 inline int GetScreenHeight()
 {
-    return _GetScreenHeight();
+    return RAYLIB64_CALL(GetScreenHeight)();
 }
 
 // Get current render width (it considers HiDPI)
 inline int GetRenderWidth()
 {
-    return _GetRenderWidth();
+    return RAYLIB64_CALL(GetRenderWidth)();
 }
 
 // Get current render height (it considers HiDPI)
 inline int GetRenderHeight()
 {
-    return _GetRenderHeight();
+    return RAYLIB64_CALL(GetRenderHeight)();
 }
 
 // Get number of connected monitors
 inline int GetMonitorCount()
 {
-    return _GetMonitorCount();
+    return RAYLIB64_CALL(GetMonitorCount)();
 }
 
 // Get current connected monitor
 inline int GetCurrentMonitor()
 {
-    return _GetCurrentMonitor();
+    return RAYLIB64_CALL(GetCurrentMonitor)();
 }
 
 // Get specified monitor position
 inline void GetMonitorPosition(int monitor, void *retVal)
 {
-    *(Vector2 *)retVal = _GetMonitorPosition(monitor);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetMonitorPosition)(monitor);
 }
 
 // Get specified monitor width (current video mode used by monitor)
 inline int GetMonitorWidth(int monitor)
 {
-    return _GetMonitorWidth(monitor);
+    return RAYLIB64_CALL(GetMonitorWidth)(monitor);
 }
 
 // Get specified monitor height (current video mode used by monitor)
 inline int GetMonitorHeight(int monitor)
 {
-    return _GetMonitorHeight(monitor);
+    return RAYLIB64_CALL(GetMonitorHeight)(monitor);
 }
 
 // Get specified monitor physical width in millimetres
 inline int GetMonitorPhysicalWidth(int monitor)
 {
-    return _GetMonitorPhysicalWidth(monitor);
+    return RAYLIB64_CALL(GetMonitorPhysicalWidth)(monitor);
 }
 
 // Get specified monitor physical height in millimetres
 inline int GetMonitorPhysicalHeight(int monitor)
 {
-    return _GetMonitorPhysicalHeight(monitor);
+    return RAYLIB64_CALL(GetMonitorPhysicalHeight)(monitor);
 }
 
 // Get specified monitor refresh rate
 inline int GetMonitorRefreshRate(int monitor)
 {
-    return _GetMonitorRefreshRate(monitor);
+    return RAYLIB64_CALL(GetMonitorRefreshRate)(monitor);
 }
 
 // Get window position XY on monitor
 inline void GetWindowPosition(void *retVal)
 {
-    *(Vector2 *)retVal = _GetWindowPosition();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetWindowPosition)();
 }
 
 // Get window scale DPI factor
 inline void GetWindowScaleDPI(void *retVal)
 {
-    *(Vector2 *)retVal = _GetWindowScaleDPI();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetWindowScaleDPI)();
 }
 
 // Get the human-readable, UTF-8 encoded name of the specified monitor
 inline const char *GetMonitorName(int monitor)
 {
-    return _GetMonitorName(monitor);
+    return RAYLIB64_CALL(GetMonitorName)(monitor);
 }
 
 // Set clipboard text content
-inline void SetClipboardText(char *text)
+inline void SetClipboardText(uintptr_t text)
 {
-    _SetClipboardText(text);
+    RAYLIB64_CALL(SetClipboardText)((char *)text);
 }
 
 // Get clipboard text content
 inline const char *GetClipboardText()
 {
-    return _GetClipboardText();
+    return RAYLIB64_CALL(GetClipboardText)();
 }
 
 // Enable waiting for events on EndDrawing(), no automatic event polling
 inline void EnableEventWaiting()
 {
-    _EnableEventWaiting();
+    RAYLIB64_CALL(EnableEventWaiting)();
 }
 
 // Disable waiting for events on EndDrawing(), automatic events polling
 inline void DisableEventWaiting()
 {
-    _DisableEventWaiting();
+    RAYLIB64_CALL(DisableEventWaiting)();
 }
 
 // Shows cursor
 inline void ShowCursor()
 {
-    _ShowCursor();
+    RAYLIB64_CALL(ShowCursor)();
 }
 
 // Hides cursor
 inline void HideCursor()
 {
-    _HideCursor();
+    RAYLIB64_CALL(HideCursor)();
 }
 
 // Check if cursor is not visible
 inline qb_bool IsCursorHidden()
 {
-    return TO_QB_BOOL(_IsCursorHidden());
+    return TO_QB_BOOL(RAYLIB64_CALL(IsCursorHidden)());
 }
 
 // Enables cursor (unlock cursor)
 inline void EnableCursor()
 {
-    _EnableCursor();
+    RAYLIB64_CALL(EnableCursor)();
 }
 
 // Disables cursor (lock cursor)
 inline void DisableCursor()
 {
-    _DisableCursor();
+    RAYLIB64_CALL(DisableCursor)();
 }
 
 // Check if cursor is on the screen
 inline qb_bool IsCursorOnScreen()
 {
-    return TO_QB_BOOL(_IsCursorOnScreen());
+    return TO_QB_BOOL(RAYLIB64_CALL(IsCursorOnScreen)());
 }
 
 // Set background color (framebuffer clear color)
 inline void ClearBackground(uint32_t color)
 {
-    _ClearBackground(color);
+    RAYLIB64_CALL(ClearBackground)(color);
 }
 
 // Setup canvas (framebuffer) to start drawing
 inline void BeginDrawing()
 {
-    _BeginDrawing();
+    ___profiler_begin_drawing_raylib64();
+    RAYLIB64_CALL(BeginDrawing)();
 }
 
 // End canvas drawing and swap buffers (double buffering)
 inline void EndDrawing()
 {
-    _EndDrawing();
+    RAYLIB64_CALL(EndDrawing)();
+    ___profiler_end_drawing_raylib64();
+#if defined(RAYLIB64_INSTRUMENT)
+    ___end_frame_stats_raylib64();
+#endif
 }
 
 // Begin 2D mode with custom camera (2D)
 inline void BeginMode2D(void *camera)
 {
-    _BeginMode2D(*(Camera2D *)camera);
+    RAYLIB64_CALL(BeginMode2D)(*(Camera2D *)camera);
 }
 
 // Ends 2D mode with custom camera
 inline void EndMode2D()
 {
-    _EndMode2D();
+    RAYLIB64_CALL(EndMode2D)();
 }
 
 // Begin 3D mode with custom camera (3D)
 inline void BeginMode3D(void *camera)
 {
-    _BeginMode3D(*(Camera3D *)camera);
+    RAYLIB64_CALL(BeginMode3D)(*(Camera3D *)camera);
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 inline void EndMode3D()
 {
-    _EndMode3D();
+    RAYLIB64_CALL(EndMode3D)();
 }
 
 // Begin drawing to render texture
 inline void BeginTextureMode(void *target)
 {
-    _BeginTextureMode(*(RenderTexture *)target);
+    RAYLIB64_CALL(BeginTextureMode)(*(RenderTexture *)target);
 }
 
 // Ends drawing to render texture
 inline void EndTextureMode()
 {
-    _EndTextureMode();
+    RAYLIB64_CALL(EndTextureMode)();
 }
 
 // Begin custom shader drawing
 inline void BeginShaderMode(void *shader)
 {
-    _BeginShaderMode(*(Shader *)shader);
+    RAYLIB64_CALL(BeginShaderMode)(*(Shader *)shader);
 }
 
 // End custom shader drawing (use default shader)
 inline void EndShaderMode()
 {
-    _EndShaderMode();
+    RAYLIB64_CALL(EndShaderMode)();
 }
 
+// Blend mode set through the wrappers below (raylib has no getter). EndSpriteBatch() puts it back after drawing
+static int ___blend_mode_raylib64 = 0; // BLEND_ALPHA
+
 // Begin blending mode (alpha, additive, multiplied, subtract, custom)
 inline void BeginBlendMode(int mode)
 {
-    _BeginBlendMode(mode);
+    RAYLIB64_CALL(BeginBlendMode)(mode);
+    ___blend_mode_raylib64 = mode;
 }
 
 // End blending mode (reset to default: alpha blending)
 inline void EndBlendMode()
 {
-    _EndBlendMode();
+    RAYLIB64_CALL(EndBlendMode)();
+    ___blend_mode_raylib64 = 0; // BLEND_ALPHA
 }
 
 // Begin scissor mode (define screen area for following drawing)
 inline void BeginScissorMode(int x, int y, int width, int height)
 {
-    _BeginScissorMode(x, y, width, height);
+    RAYLIB64_CALL(BeginScissorMode)(x, y, width, height);
 }
 
 // End scissor mode
 inline void EndScissorMode()
 {
-    _EndScissorMode();
+    RAYLIB64_CALL(EndScissorMode)();
 }
 
 // Begin stereo rendering (requires VR simulator)
 inline void BeginVrStereoMode(void *config)
 {
-    _BeginVrStereoMode(*(VrStereoConfig *)config);
+    RAYLIB64_CALL(BeginVrStereoMode)(*(VrStereoConfig *)config);
 }
 
 // End stereo rendering (requires VR simulator)
 inline void EndVrStereoMode()
 {
-    _EndVrStereoMode();
+    RAYLIB64_CALL(EndVrStereoMode)();
 }
 
 // Load VR stereo config for VR simulator device parameters
 inline void LoadVrStereoConfig(void *device, void *retVal)
 {
-    *(VrStereoConfig *)retVal = _LoadVrStereoConfig(*(VrDeviceInfo *)device);
+    *(VrStereoConfig *)retVal = RAYLIB64_CALL(LoadVrStereoConfig)(*(VrDeviceInfo *)device);
 }
 
 // Unload VR stereo config
 inline void UnloadVrStereoConfig(void *config)
 {
-    _UnloadVrStereoConfig(*(VrStereoConfig *)config);
+    RAYLIB64_CALL(UnloadVrStereoConfig)(*(VrStereoConfig *)config);
 }
 
 // Load shader from files and bind default locations
-inline void LoadShader(char *vsFileName, char *fsFileName, void *retVal)
+inline void LoadShader(uintptr_t vsFileName, uintptr_t fsFileName, void *retVal)
 {
-    *(Shader *)retVal = _LoadShader(vsFileName, fsFileName);
+    *(Shader *)retVal = RAYLIB64_CALL(LoadShader)((char *)vsFileName, (char *)fsFileName);
 }
 
 // Load shader from code strings and bind default locations
-inline void LoadShaderFromMemory(char *vsCode, char *fsCode, void *retVal)
+inline void LoadShaderFromMemory(uintptr_t vsCode, uintptr_t fsCode, void *retVal)
 {
-    *(Shader *)retVal = _LoadShaderFromMemory(vsCode, fsCode);
+    *(Shader *)retVal = RAYLIB64_CALL(LoadShaderFromMemory)((char *)vsCode, (char *)fsCode);
 }
 
 // Check if a shader is ready
 inline qb_bool IsShaderReady(void *shader)
 {
-    return TO_QB_BOOL(_IsShaderReady(*(Shader *)shader));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsShaderReady)(*(Shader *)shader));
 }
 
 // Get shader uniform location
-inline int GetShaderLocation(void *shader, char *uniformName)
+inline int GetShaderLocation(void *shader, uintptr_t uniformName)
 {
-    return _GetShaderLocation(*(Shader *)shader, uniformName);
+    return RAYLIB64_CALL(GetShaderLocation)(*(Shader *)shader, (char *)uniformName);
 }
 
 // Get shader attribute location
-inline int GetShaderLocationAttrib(void *shader, char *attribName)
+inline int GetShaderLocationAttrib(void *shader, uintptr_t attribName)
 {
-    return _GetShaderLocationAttrib(*(Shader *)shader, attribName);
+    return RAYLIB64_CALL(GetShaderLocationAttrib)(*(Shader *)shader, (char *)attribName);
 }
 
 // Set shader uniform value
 inline void SetShaderValue(void *shader, int locIndex, uintptr_t value, int uniformType)
 {
-    _SetShaderValue(*(Shader *)shader, locIndex, (void *)value, uniformType);
+    RAYLIB64_CALL(SetShaderValue)(*(Shader *)shader, locIndex, (void *)value, uniformType);
 }
 
 // Set shader uniform value vector
 inline void SetShaderValueV(void *shader, int locIndex, uintptr_t value, int uniformType, int count)
 {
-    _SetShaderValueV(*(Shader *)shader, locIndex, (void *)value, uniformType, count);
+    RAYLIB64_CALL(SetShaderValueV)(*(Shader *)shader, locIndex, (void *)value, uniformType, count);
 }
 
 // Set shader uniform value (matrix 4x4)
 inline void SetShaderValueMatrix(void *shader, int locIndex, void *mat)
 {
-    _SetShaderValueMatrix(*(Shader *)shader, locIndex, *(Matrix *)mat);
+    RAYLIB64_CALL(SetShaderValueMatrix)(*(Shader *)shader, locIndex, *(Matrix *)mat);
 }
 
 // Set shader uniform value for texture (sampler2d)
 inline void SetShaderValueTexture(void *shader, int locIndex, void *texture)
 {
-    _SetShaderValueTexture(*(Shader *)shader, locIndex, *(Texture *)texture);
+    RAYLIB64_CALL(SetShaderValueTexture)(*(Shader *)shader, locIndex, *(Texture *)texture);
 }
 
 // Unload shader from GPU memory (VRAM)
 inline void UnloadShader(void *shader)
 {
-    _UnloadShader(*(Shader *)shader);
+    RAYLIB64_CALL(UnloadShader)(*(Shader *)shader);
 }
 
 // Get a ray trace from mouse position
 inline void GetMouseRay(void *mousePosition, void *camera, void *retVal)
 {
-    *(Ray *)retVal = _GetMouseRay(*(Vector2 *)mousePosition, *(Camera3D *)camera);
+    *(Ray *)retVal = RAYLIB64_CALL(GetMouseRay)(*(Vector2 *)mousePosition, *(Camera3D *)camera);
 }
 
 // Get camera transform matrix (view matrix)
 inline void GetCameraMatrix(void *camera, void *retVal)
 {
-    *(Matrix *)retVal = _GetCameraMatrix(*(Camera3D *)camera);
+    *(Matrix *)retVal = RAYLIB64_CALL(GetCameraMatrix)(*(Camera3D *)camera);
 }
 
 // Get camera 2d transform matrix
 inline void GetCameraMatrix2D(void *camera, void *retVal)
 {
-    *(Matrix *)retVal = _GetCameraMatrix2D(*(Camera2D *)camera);
+    *(Matrix *)retVal = RAYLIB64_CALL(GetCameraMatrix2D)(*(Camera2D *)camera);
 }
 
 // Get the screen space position for a 3d world space position
 inline void GetWorldToScreen(void *position, void *camera, void *retVal)
 {
-    *(Vector2 *)retVal = _GetWorldToScreen(*(Vector3 *)position, *(Camera3D *)camera);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetWorldToScreen)(*(Vector3 *)position, *(Camera3D *)camera);
 }
 
 // Get the world space position for a 2d camera screen space position
 inline void GetScreenToWorld2D(void *position, void *camera, void *retVal)
 {
-    *(Vector2 *)retVal = _GetScreenToWorld2D(*(Vector2 *)position, *(Camera2D *)camera);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetScreenToWorld2D)(*(Vector2 *)position, *(Camera2D *)camera);
 }
 
 // Get size position for a 3d world space position
 inline void GetWorldToScreenEx(void *position, void *camera, int width, int height, void *retVal)
 {
-    *(Vector2 *)retVal = _GetWorldToScreenEx(*(Vector3 *)position, *(Camera3D *)camera, width, height);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetWorldToScreenEx)(*(Vector3 *)position, *(Camera3D *)camera, width, height);
 }
 
 // Get the screen space position for a 2d camera world space position
 inline void GetWorldToScreen2D(void *position, void *camera, void *retVal)
 {
-    *(Vector2 *)retVal = _GetWorldToScreen2D(*(Vector2 *)position, *(Camera2D *)camera);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetWorldToScreen2D)(*(Vector2 *)position, *(Camera2D *)camera);
 }
 
 // Set target FPS (maximum)
 inline void SetTargetFPS(int fps)
 {
-    _SetTargetFPS(fps);
+    RAYLIB64_CALL(SetTargetFPS)(fps);
 }
 
 // Get time in seconds for last frame drawn (delta time)
 inline float GetFrameTime()
 {
-    return _GetFrameTime();
+    return RAYLIB64_CALL(GetFrameTime)();
 }
 
 // Get elapsed time in seconds since InitWindow()
 inline double GetTime()
 {
-    return _GetTime();
+    return RAYLIB64_CALL(GetTime)();
 }
 
 // Get current FPS
 inline int GetFPS()
 {
-    return _GetFPS();
+    return RAYLIB64_CALL(GetFPS)();
 }
 
 // Swap back buffer with front buffer (screen drawing)
 inline void SwapScreenBuffer()
 {
-    _SwapScreenBuffer();
+    RAYLIB64_CALL(SwapScreenBuffer)();
 }
 
 // Register all input events
 inline void PollInputEvents()
 {
-    _PollInputEvents();
+    RAYLIB64_CALL(PollInputEvents)();
 }
 
 // Wait for some time (halt program execution)
 inline void WaitTime(double seconds)
 {
-    _WaitTime(seconds);
+    RAYLIB64_CALL(WaitTime)(seconds);
 }
 
 // Set the seed for the random number generator
 inline void SetRandomSeed(unsigned int seed)
 {
-    _SetRandomSeed(seed);
+    RAYLIB64_CALL(SetRandomSeed)(seed);
 }
 
 // Get a random value between min and max (both included)
 inline int GetRandomValue(int min, int max)
 {
-    return _GetRandomValue(min, max);
+    return RAYLIB64_CALL(GetRandomValue)(min, max);
 }
 
 // Load random values sequence, no values repeated
 inline void *LoadRandomSequence(unsigned int count, int min, int max)
 {
-    return _LoadRandomSequence(count, min, max);
+    return RAYLIB64_CALL(LoadRandomSequence)(count, min, max);
 }
 
 // Unload random values sequence
 inline void UnloadRandomSequence(uintptr_t sequence)
 {
-    _UnloadRandomSequence((int *)sequence);
+    RAYLIB64_CALL(UnloadRandomSequence)((int *)sequence);
 }
 
 // Takes a screenshot of current screen (filename extension defines format)
-inline void TakeScreenshot(char *fileName)
+inline void TakeScreenshot(uintptr_t fileName)
 {
-    _TakeScreenshot(fileName);
+    RAYLIB64_CALL(TakeScreenshot)((char *)fileName);
 }
 
 // Setup init configuration flags (view FLAGS)
 inline void SetConfigFlags(unsigned int flags)
 {
-    _SetConfigFlags(flags);
+    RAYLIB64_CALL(SetConfigFlags)(flags);
 }
 
 // Open URL with default system browser (if available)
-inline void OpenURL(char *url)
+inline void OpenURL(uintptr_t url)
 {
-    _OpenURL(url);
+    RAYLIB64_CALL(OpenURL)((char *)url);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text)
+inline void TraceLog(int logLevel, uintptr_t text)
 {
-    _TraceLog(logLevel, text);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text, char *s)
+inline void TraceLog(int logLevel, uintptr_t text, uintptr_t s)
 {
-    _TraceLog(logLevel, text, s);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text, (char *)s);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text, int32_t i)
+inline void TraceLog(int logLevel, uintptr_t text, int32_t i)
 {
-    _TraceLog(logLevel, text, i);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text, i);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text, int64_t i)
+inline void TraceLog(int logLevel, uintptr_t text, int64_t i)
 {
-    _TraceLog(logLevel, text, i);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text, i);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text, float f)
+inline void TraceLog(int logLevel, uintptr_t text, float f)
 {
-    _TraceLog(logLevel, text, f);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text, f);
 }
 
 // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-inline void TraceLog(int logLevel, char *text, double d)
+inline void TraceLog(int logLevel, uintptr_t text, double d)
 {
-    _TraceLog(logLevel, text, d);
+    RAYLIB64_CALL(TraceLog)(logLevel, (char *)text, d);
 }
 
 // Set the current threshold (minimum) log level
 inline void SetTraceLogLevel(int logLevel)
 {
-    _SetTraceLogLevel(logLevel);
+    RAYLIB64_CALL(SetTraceLogLevel)(logLevel);
 }
 
 // Internal memory allocator
 inline void *MemAlloc(unsigned int size)
 {
-    return _MemAlloc(size);
+    return RAYLIB64_CALL(MemAlloc)(size);
 }
 
 // Internal memory reallocator
 inline void *MemRealloc(uintptr_t ptr, unsigned int size)
 {
-    return _MemRealloc((void *)ptr, size);
+    return RAYLIB64_CALL(MemRealloc)((void *)ptr, size);
 }
 
 // Internal memory free
 inline void RMemFree(uintptr_t ptr)
 {
-    _MemFree((void *)ptr);
+    RAYLIB64_CALL(MemFree)((void *)ptr);
 }
 
 // Set custom trace log
 inline void SetTraceLogCallback(void *callback)
 {
-    _SetTraceLogCallback((TraceLogCallback)callback);
+    RAYLIB64_CALL(SetTraceLogCallback)((TraceLogCallback)callback);
 }
 
 // Set custom file binary data loader
 inline void SetLoadFileDataCallback(void *callback)
 {
-    _SetLoadFileDataCallback((LoadFileDataCallback)callback);
+    RAYLIB64_CALL(SetLoadFileDataCallback)((LoadFileDataCallback)callback);
 }
 
 // Set custom file binary data saver
 inline void SetSaveFileDataCallback(void *callback)
 {
-    _SetSaveFileDataCallback((SaveFileDataCallback)callback);
+    RAYLIB64_CALL(SetSaveFileDataCallback)((SaveFileDataCallback)callback);
 }
 
 // Set custom file text data loader
 inline void SetLoadFileTextCallback(void *callback)
 {
-    _SetLoadFileTextCallback((LoadFileTextCallback)callback);
+    RAYLIB64_CALL(SetLoadFileTextCallback)((LoadFileTextCallback)callback);
 }
 
 // Set custom file text data saver
 inline void SetSaveFileTextCallback(void *callback)
 {
-    _SetSaveFileTextCallback((SaveFileTextCallback)callback);
+    RAYLIB64_CALL(SetSaveFileTextCallback)((SaveFileTextCallback)callback);
 }
 
 // Load file data as byte array (read)
-inline void *LoadFileData(char *fileName, void *dataSize)
+inline void *LoadFileData(uintptr_t fileName, void *dataSize)
 {
-    return _LoadFileData(fileName, (int *)dataSize);
+    return RAYLIB64_CALL(LoadFileData)((char *)fileName, (int *)dataSize);
 }
 
 // Unload file data allocated by LoadFileData()
 inline void UnloadFileData(uintptr_t data)
 {
-    _UnloadFileData((unsigned char *)data);
+    RAYLIB64_CALL(UnloadFileData)((unsigned char *)data);
 }
 
 // Save data to file from byte array (write), returns true on success
-inline qb_bool SaveFileData(char *fileName, uintptr_t data, int dataSize)
+inline qb_bool SaveFileData(uintptr_t fileName, uintptr_t data, int dataSize)
 {
-    return TO_QB_BOOL(_SaveFileData(fileName, (void *)data, dataSize));
+    return TO_QB_BOOL(RAYLIB64_CALL(SaveFileData)((char *)fileName, (void *)data, dataSize));
 }
 
 // Export data to code (.h), returns true on success
-inline qb_bool ExportDataAsCode(uintptr_t data, int dataSize, char *fileName)
+inline qb_bool ExportDataAsCode(uintptr_t data, int dataSize, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportDataAsCode((unsigned char *)data, dataSize, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportDataAsCode)((unsigned char *)data, dataSize, (char *)fileName));
 }
 
 // Load text data from file (read), returns a '\\0' terminated string
-inline void *LoadFileText(char *fileName)
+inline void *LoadFileText(uintptr_t fileName)
 {
-    return _LoadFileText(fileName);
+    return RAYLIB64_CALL(LoadFileText)((char *)fileName);
 }
 
 // Unload file text data allocated by LoadFileText()
 inline void UnloadFileText(uintptr_t text)
 {
-    _UnloadFileText((char *)text);
+    RAYLIB64_CALL(UnloadFileText)((char *)text);
 }
 
 // Save text data to file (write), string must be '\0' terminated, returns true on success
-inline qb_bool SaveFileText(char *fileName, char *text)
+inline qb_bool SaveFileText(uintptr_t fileName, uintptr_t text)
 {
-    return TO_QB_BOOL(_SaveFileText(fileName, text));
+    return TO_QB_BOOL(RAYLIB64_CALL(SaveFileText)((char *)fileName, (char *)text));
 }
 
 // Check if file exists
-inline qb_bool RFileExists(char *fileName)
+inline qb_bool RFileExists(uintptr_t fileName)
 {
-    return TO_QB_BOOL(_FileExists(fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(FileExists)((char *)fileName));
 }
 
 // Check if a directory path exists
-inline qb_bool DirectoryExists(char *dirPath)
+inline qb_bool DirectoryExists(uintptr_t dirPath)
 {
-    return TO_QB_BOOL(_DirectoryExists(dirPath));
+    return TO_QB_BOOL(RAYLIB64_CALL(DirectoryExists)((char *)dirPath));
 }
 
 // Check file extension (including point: .png, .wav)
-inline qb_bool IsFileExtension(char *fileName, char *ext)
+inline qb_bool IsFileExtension(uintptr_t fileName, uintptr_t ext)
 {
-    return TO_QB_BOOL(_IsFileExtension(fileName, ext));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsFileExtension)((char *)fileName, (char *)ext));
 }
 
 // Get file length in bytes (NOTE: GetFileSize() conflicts with windows.h)
-inline int GetFileLength(char *fileName)
+inline int GetFileLength(uintptr_t fileName)
 {
-    return _GetFileLength(fileName);
+    return RAYLIB64_CALL(GetFileLength)((char *)fileName);
 }
 
 // Get pointer to extension for a filename string (includes dot: '.png')
-inline const char *GetFileExtension(char *fileName)
+inline const char *GetFileExtension(uintptr_t fileName)
 {
-    return _GetFileExtension(fileName);
+    return RAYLIB64_CALL(GetFileExtension)((char *)fileName);
 }
 
 // Get pointer to filename for a path string
-inline const char *GetFileName(char *filePath)
+inline const char *GetFileName(uintptr_t filePath)
 {
-    return _GetFileName(filePath);
+    return RAYLIB64_CALL(GetFileName)((char *)filePath);
 }
 
 // Get filename string without extension (uses static string)
-inline const char *GetFileNameWithoutExt(char *filePath)
+inline const char *GetFileNameWithoutExt(uintptr_t filePath)
 {
-    return _GetFileNameWithoutExt(filePath);
+    return RAYLIB64_CALL(GetFileNameWithoutExt)((char *)filePath);
 }
 
 // Get full path for a given fileName with path (uses static string)
-inline const char *GetDirectoryPath(char *filePath)
+inline const char *GetDirectoryPath(uintptr_t filePath)
 {
-    return _GetDirectoryPath(filePath);
+    return RAYLIB64_CALL(GetDirectoryPath)((char *)filePath);
 }
 
 // Get previous directory path for a given path (uses static string)
-inline const char *GetPrevDirectoryPath(char *dirPath)
+inline const char *GetPrevDirectoryPath(uintptr_t dirPath)
 {
-    return _GetPrevDirectoryPath(dirPath);
+    return RAYLIB64_CALL(GetPrevDirectoryPath)((char *)dirPath);
 }
 
 // Get current working directory (uses static string)
 inline const char *GetWorkingDirectory()
 {
-    return _GetWorkingDirectory();
+    return RAYLIB64_CALL(GetWorkingDirectory)();
 }
 
 // Get the directory of the running application (uses static string)
 inline const char *GetApplicationDirectory()
 {
-    return _GetApplicationDirectory();
+    return RAYLIB64_CALL(GetApplicationDirectory)();
 }
 
 // Change working directory, return true on success
-inline qb_bool ChangeDirectory(char *dir)
+inline qb_bool ChangeDirectory(uintptr_t dir)
 {
-    return TO_QB_BOOL(_ChangeDirectory(dir));
+    return TO_QB_BOOL(RAYLIB64_CALL(ChangeDirectory)((char *)dir));
 }
 
 // Check if a given path is a file or a directory
-inline qb_bool IsPathFile(char *path)
+inline qb_bool IsPathFile(uintptr_t path)
 {
-    return TO_QB_BOOL(_IsPathFile(path));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsPathFile)((char *)path));
 }
 
 // Load directory filepaths
-inline void LoadDirectoryFiles(char *dirPath, void *retVal)
+inline void LoadDirectoryFiles(uintptr_t dirPath, void *retVal)
 {
-    *(FilePathList *)retVal = _LoadDirectoryFiles(dirPath);
+    *(FilePathList *)retVal = RAYLIB64_CALL(LoadDirectoryFiles)((char *)dirPath);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-inline void LoadDirectoryFilesEx(char *basePath, char *filter, bool scanSubdirs, void *retVal)
+inline void LoadDirectoryFilesEx(uintptr_t basePath, uintptr_t filter, bool scanSubdirs, void *retVal)
 {
-    *(FilePathList *)retVal = _LoadDirectoryFilesEx(basePath, filter, scanSubdirs);
+    *(FilePathList *)retVal = RAYLIB64_CALL(LoadDirectoryFilesEx)((char *)basePath, (char *)filter, scanSubdirs);
 }
 
 // Unload filepaths
 inline void UnloadDirectoryFiles(void *files)
 {
-    _UnloadDirectoryFiles(*(FilePathList *)files);
+    RAYLIB64_CALL(UnloadDirectoryFiles)(*(FilePathList *)files);
 }
 
 // Check if a file has been dropped into window
 inline qb_bool IsFileDropped()
 {
-    return TO_QB_BOOL(_IsFileDropped());
+    return TO_QB_BOOL(RAYLIB64_CALL(IsFileDropped)());
 }
 
 // Load dropped filepaths
 inline void LoadDroppedFiles(void *retVal)
 {
-    *(FilePathList *)retVal = _LoadDroppedFiles();
+    *(FilePathList *)retVal = RAYLIB64_CALL(LoadDroppedFiles)();
 }
 
 // Unload dropped filepaths
 inline void UnloadDroppedFiles(void *files)
 {
-    _UnloadDroppedFiles(*(FilePathList *)files);
+    RAYLIB64_CALL(UnloadDroppedFiles)(*(FilePathList *)files);
 }
 
 // Get file modification time (last write time)
-inline long GetFileModTime(char *fileName)
+inline long GetFileModTime(uintptr_t fileName)
 {
-    return _GetFileModTime(fileName);
+    return RAYLIB64_CALL(GetFileModTime)((char *)fileName);
 }
 
 // Compress data (DEFLATE algorithm), memory must be MemFree()
 inline void *CompressData(char *data, int dataSize, int *compDataSize)
 {
-    return _CompressData((unsigned char *)data, dataSize, compDataSize);
+    return RAYLIB64_CALL(CompressData)((unsigned char *)data, dataSize, compDataSize);
 }
 
 // Decompress data (DEFLATE algorithm), memory must be MemFree()
 inline void *DecompressData(char *compData, int compDataSize, int *dataSize)
 {
-    return _DecompressData((unsigned char *)compData, compDataSize, dataSize);
+    return RAYLIB64_CALL(DecompressData)((unsigned char *)compData, compDataSize, dataSize);
 }
 
 // Encode data to Base64 string, memory must be MemFree()
 inline void *EncodeDataBase64(char *data, int dataSize, int *outputSize)
 {
-    return _EncodeDataBase64((unsigned char *)data, dataSize, outputSize);
+    return RAYLIB64_CALL(EncodeDataBase64)((unsigned char *)data, dataSize, outputSize);
 }
 
 // Decode Base64 string data, memory must be MemFree()
-inline void *DecodeDataBase64(char *data, int *outputSize)
+inline void *DecodeDataBase64(uintptr_t data, int *outputSize)
 {
-    return _DecodeDataBase64((unsigned char *)data, outputSize);
+    return RAYLIB64_CALL(DecodeDataBase64)((unsigned char *)(char *)data, outputSize);
 }
 
 // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
-inline void LoadAutomationEventList(char *fileName, void *retVal)
+inline void LoadAutomationEventList(uintptr_t fileName, void *retVal)
 {
-    *(AutomationEventList *)retVal = _LoadAutomationEventList(fileName);
+    *(AutomationEventList *)retVal = RAYLIB64_CALL(LoadAutomationEventList)((char *)fileName);
 }
 
 // Unload automation events list from file
 inline void UnloadAutomationEventList(void *list)
 {
-    _UnloadAutomationEventList((AutomationEventList *)list);
+    RAYLIB64_CALL(UnloadAutomationEventList)((AutomationEventList *)list);
 }
 
 // Export automation events list as text file
-inline qb_bool ExportAutomationEventList(void *list, char *fileName)
+inline qb_bool ExportAutomationEventList(void *list, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportAutomationEventList(*(AutomationEventList *)list, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportAutomationEventList)(*(AutomationEventList *)list, (char *)fileName));
 }
 
 // Set automation event list to record to
 inline void SetAutomationEventList(void *list)
 {
-    _SetAutomationEventList((AutomationEventList *)list);
+    RAYLIB64_CALL(SetAutomationEventList)((AutomationEventList *)list);
 }
 
 // Set automation event internal base frame to start recording
 inline void SetAutomationEventBaseFrame(int frame)
 {
-    _SetAutomationEventBaseFrame(frame);
+    RAYLIB64_CALL(SetAutomationEventBaseFrame)(frame);
 }
 
 // Start recording automation events (AutomationEventList must be set)
 inline void StartAutomationEventRecording()
 {
-    _StartAutomationEventRecording();
+    RAYLIB64_CALL(StartAutomationEventRecording)();
 }
 
 // Stop recording automation events
 inline void StopAutomationEventRecording()
 {
-    _StopAutomationEventRecording();
+    RAYLIB64_CALL(StopAutomationEventRecording)();
 }
 
 // Play a recorded automation event
 inline void PlayAutomationEvent(void *event)
 {
-    _PlayAutomationEvent(*(AutomationEvent *)event);
+    RAYLIB64_CALL(PlayAutomationEvent)(*(AutomationEvent *)event);
 }
 
 // Check if a key has been pressed once
 inline qb_bool IsKeyPressed(int key)
 {
-    return TO_QB_BOOL(_IsKeyPressed(key));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsKeyPressed)(key));
 }
 
 // Check if a key has been pressed again (Only PLATFORM_DESKTOP)
 inline qb_bool IsKeyPressedRepeat(int key)
 {
-    return TO_QB_BOOL(_IsKeyPressedRepeat(key));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsKeyPressedRepeat)(key));
 }
 
 // Check if a key is being pressed
 inline qb_bool IsKeyDown(int key)
 {
-    return TO_QB_BOOL(_IsKeyDown(key));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsKeyDown)(key));
 }
 
 // Check if a key has been released once
 inline qb_bool IsKeyReleased(int key)
 {
-    return TO_QB_BOOL(_IsKeyReleased(key));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsKeyReleased)(key));
 }
 
 // Check if a key is NOT being pressed
 inline qb_bool IsKeyUp(int key)
 {
-    return TO_QB_BOOL(_IsKeyUp(key));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsKeyUp)(key));
 }
 
 // Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty
 inline int GetKeyPressed()
 {
-    return _GetKeyPressed();
+    return RAYLIB64_CALL(GetKeyPressed)();
 }
 
 // Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty
 inline int GetCharPressed()
 {
-    return _GetCharPressed();
+    return RAYLIB64_CALL(GetCharPressed)();
 }
 
 // Set a custom key to exit program (default is ESC)
 inline void SetExitKey(int key)
 {
-    _SetExitKey(key);
+    RAYLIB64_CALL(SetExitKey)(key);
 }
 
 // Check if a gamepad is available
 inline qb_bool IsGamepadAvailable(int gamepad)
 {
-    return TO_QB_BOOL(_IsGamepadAvailable(gamepad));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGamepadAvailable)(gamepad));
 }
 
 // Get gamepad internal name id
 inline const char *GetGamepadName(int gamepad)
 {
-    return _GetGamepadName(gamepad);
+    return RAYLIB64_CALL(GetGamepadName)(gamepad);
 }
 
 // Check if a gamepad button has been pressed once
 inline qb_bool IsGamepadButtonPressed(int gamepad, int button)
 {
-    return TO_QB_BOOL(_IsGamepadButtonPressed(gamepad, button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGamepadButtonPressed)(gamepad, button));
 }
 
 // Check if a gamepad button is being pressed
 inline qb_bool IsGamepadButtonDown(int gamepad, int button)
 {
-    return TO_QB_BOOL(_IsGamepadButtonDown(gamepad, button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGamepadButtonDown)(gamepad, button));
 }
 
 // Check if a gamepad button has been released once
 inline qb_bool IsGamepadButtonReleased(int gamepad, int button)
 {
-    return TO_QB_BOOL(_IsGamepadButtonReleased(gamepad, button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGamepadButtonReleased)(gamepad, button));
 }
 
 // Check if a gamepad button is NOT being pressed
 inline qb_bool IsGamepadButtonUp(int gamepad, int button)
 {
-    return TO_QB_BOOL(_IsGamepadButtonUp(gamepad, button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGamepadButtonUp)(gamepad, button));
 }
 
 // Get the last gamepad button pressed
 inline int GetGamepadButtonPressed()
 {
-    return _GetGamepadButtonPressed();
+    return RAYLIB64_CALL(GetGamepadButtonPressed)();
 }
 
 // Get gamepad axis count for a gamepad
 inline int GetGamepadAxisCount(int gamepad)
 {
-    return _GetGamepadAxisCount(gamepad);
+    return RAYLIB64_CALL(GetGamepadAxisCount)(gamepad);
 }
 
 // Get axis movement value for a gamepad axis
 inline float GetGamepadAxisMovement(int gamepad, int axis)
 {
-    return _GetGamepadAxisMovement(gamepad, axis);
+    return RAYLIB64_CALL(GetGamepadAxisMovement)(gamepad, axis);
 }
 
 // Set internal gamepad mappings (SDL_GameControllerDB)
-inline int SetGamepadMappings(char *mappings)
+inline int SetGamepadMappings(uintptr_t mappings)
 {
-    return _SetGamepadMappings(mappings);
+    return RAYLIB64_CALL(SetGamepadMappings)((char *)mappings);
 }
 
 // Check if a mouse button has been pressed once
 inline qb_bool IsMouseButtonPressed(int button)
 {
-    return TO_QB_BOOL(_IsMouseButtonPressed(button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMouseButtonPressed)(button));
 }
 
 // Check if a mouse button is being pressed
 inline qb_bool IsMouseButtonDown(int button)
 {
-    return TO_QB_BOOL(_IsMouseButtonDown(button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMouseButtonDown)(button));
 }
 
 // Check if a mouse button has been released once
 inline qb_bool IsMouseButtonReleased(int button)
 {
-    return TO_QB_BOOL(_IsMouseButtonReleased(button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMouseButtonReleased)(button));
 }
 
 // Check if a mouse button is NOT being pressed
 inline qb_bool IsMouseButtonUp(int button)
 {
-    return TO_QB_BOOL(_IsMouseButtonUp(button));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMouseButtonUp)(button));
 }
 
 // Get mouse position X
 inline int GetMouseX()
 {
-    return _GetMouseX();
+    return RAYLIB64_CALL(GetMouseX)();
 }
 
 // Get mouse position Y
 inline int GetMouseY()
 {
-    return _GetMouseY();
+    return RAYLIB64_CALL(GetMouseY)();
 }
 
 // Get mouse position XY
 inline void GetMousePosition(void *retVal)
 {
-    *(Vector2 *)retVal = _GetMousePosition();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetMousePosition)();
 }
 
 // Get mouse delta between frames
 inline void GetMouseDelta(void *retVal)
 {
-    *(Vector2 *)retVal = _GetMouseDelta();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetMouseDelta)();
 }
 
 // Set mouse position XY
 inline void SetMousePosition(int x, int y)
 {
-    _SetMousePosition(x, y);
+    RAYLIB64_CALL(SetMousePosition)(x, y);
 }
 
 // Set mouse offset
 inline void SetMouseOffset(int offsetX, int offsetY)
 {
-    _SetMouseOffset(offsetX, offsetY);
+    RAYLIB64_CALL(SetMouseOffset)(offsetX, offsetY);
 }
 
 // Set mouse scaling
 inline void SetMouseScale(float scaleX, float scaleY)
 {
-    _SetMouseScale(scaleX, scaleY);
+    RAYLIB64_CALL(SetMouseScale)(scaleX, scaleY);
 }
 
 // Get mouse wheel movement for X or Y, whichever is larger
 inline float GetMouseWheelMove()
 {
-    return _GetMouseWheelMove();
+    return RAYLIB64_CALL(GetMouseWheelMove)();
 }
 
 // Get mouse wheel movement for both X and Y
 inline void GetMouseWheelMoveV(void *retVal)
 {
-    *(Vector2 *)retVal = _GetMouseWheelMoveV();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetMouseWheelMoveV)();
 }
 
 // Set mouse cursor
 inline void SetMouseCursor(int cursor)
 {
-    _SetMouseCursor(cursor);
+    RAYLIB64_CALL(SetMouseCursor)(cursor);
 }
 
 // Get touch position X for touch point 0 (relative to screen size)
 inline int GetTouchX()
 {
-    return _GetTouchX();
+    return RAYLIB64_CALL(GetTouchX)();
 }
 
 // Get touch position Y for touch point 0 (relative to screen size)
 inline int GetTouchY()
 {
-    return _GetTouchY();
+    return RAYLIB64_CALL(GetTouchY)();
 }
 
 // Get touch position XY for a touch point index (relative to screen size)
 inline void GetTouchPosition(int index, void *retVal)
 {
-    *(Vector2 *)retVal = _GetTouchPosition(index);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetTouchPosition)(index);
 }
 
 // Get touch point identifier for given index
 inline int GetTouchPointId(int index)
 {
-    return _GetTouchPointId(index);
+    return RAYLIB64_CALL(GetTouchPointId)(index);
 }
 
 // Get number of touch points
 inline int GetTouchPointCount()
 {
-    return _GetTouchPointCount();
+    return RAYLIB64_CALL(GetTouchPointCount)();
 }
 
 // Enable a set of gestures using flags
 inline void SetGesturesEnabled(unsigned int flags)
 {
-    _SetGesturesEnabled(flags);
+    RAYLIB64_CALL(SetGesturesEnabled)(flags);
 }
 
 // Check if a gesture have been detected
 inline qb_bool IsGestureDetected(unsigned int gesture)
 {
-    return TO_QB_BOOL(_IsGestureDetected(gesture));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsGestureDetected)(gesture));
 }
 
 // Get latest detected gesture
 inline int GetGestureDetected()
 {
-    return _GetGestureDetected();
+    return RAYLIB64_CALL(GetGestureDetected)();
 }
 
 // Get gesture hold time in milliseconds
 inline float GetGestureHoldDuration()
 {
-    return _GetGestureHoldDuration();
+    return RAYLIB64_CALL(GetGestureHoldDuration)();
 }
 
 // Get gesture drag vector
 inline void GetGestureDragVector(void *retVal)
 {
-    *(Vector2 *)retVal = _GetGestureDragVector();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetGestureDragVector)();
 }
 
 // Get gesture drag angle
 inline float GetGestureDragAngle()
 {
-    return _GetGestureDragAngle();
+    return RAYLIB64_CALL(GetGestureDragAngle)();
 }
 
 // Get gesture pinch delta
 inline void GetGesturePinchVector(void *retVal)
 {
-    *(Vector2 *)retVal = _GetGesturePinchVector();
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetGesturePinchVector)();
 }
 
 // Get gesture pinch angle
 inline float GetGesturePinchAngle()
 {
-    return _GetGesturePinchAngle();
+    return RAYLIB64_CALL(GetGesturePinchAngle)();
 }
 
 // Update camera position for selected mode
 inline void UpdateCamera(void *camera, int mode)
 {
-    _UpdateCamera((Camera3D *)camera, mode);
+    RAYLIB64_CALL(UpdateCamera)((Camera3D *)camera, mode);
 }
 
 // Update camera movement/rotation
 inline void UpdateCameraPro(void *camera, void *movement, void *rotation, float zoom)
 {
-    _UpdateCameraPro((Camera3D *)camera, *(Vector3 *)movement, *(Vector3 *)rotation, zoom);
+    RAYLIB64_CALL(UpdateCameraPro)((Camera3D *)camera, *(Vector3 *)movement, *(Vector3 *)rotation, zoom);
 }
 
 // Set texture and rectangle to be used on shapes drawing
 inline void SetShapesTexture(void *texture, void *source)
 {
-    _SetShapesTexture(*(Texture *)texture, *(RRectangle *)source);
+    RAYLIB64_CALL(SetShapesTexture)(*(Texture *)texture, *(RRectangle *)source);
 }
 
 // Draw a pixel
 inline void DrawPixel(int posX, int posY, uint32_t color)
 {
-    _DrawPixel(posX, posY, color);
+    RAYLIB64_CALL(DrawPixel)(posX, posY, color);
 }
 
 // Draw a pixel (Vector version)
 inline void DrawPixelV(void *position, uint32_t color)
 {
-    _DrawPixelV(*(Vector2 *)position, color);
+    RAYLIB64_CALL(DrawPixelV)(*(Vector2 *)position, color);
 }
 
 // Draw a line
 inline void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color)
 {
-    _DrawLine(startPosX, startPosY, endPosX, endPosY, color);
+    RAYLIB64_CALL(DrawLine)(startPosX, startPosY, endPosX, endPosY, color);
 }
 
 // Draw a line (using gl lines)
 inline void DrawLineV(void *startPos, void *endPos, uint32_t color)
 {
-    _DrawLineV(*(Vector2 *)startPos, *(Vector2 *)endPos, color);
+    RAYLIB64_CALL(DrawLineV)(*(Vector2 *)startPos, *(Vector2 *)endPos, color);
 }
 
 // Draw a line (using triangles/quads)
 inline void DrawLineEx(void *startPos, void *endPos, float thick, uint32_t color)
 {
-    _DrawLineEx(*(Vector2 *)startPos, *(Vector2 *)endPos, thick, color);
+    RAYLIB64_CALL(DrawLineEx)(*(Vector2 *)startPos, *(Vector2 *)endPos, thick, color);
 }
 
 // Draw lines sequence (using gl lines)
 inline void DrawLineStrip(void *points, int pointCount, uint32_t color)
 {
-    _DrawLineStrip((Vector2 *)points, pointCount, color);
+    RAYLIB64_CALL(DrawLineStrip)((Vector2 *)points, pointCount, color);
 }
 
 // Draw line segment cubic-bezier in-out interpolation
 inline void DrawLineBezier(void *startPos, void *endPos, float thick, uint32_t color)
 {
-    _DrawLineBezier(*(Vector2 *)startPos, *(Vector2 *)endPos, thick, color);
+    RAYLIB64_CALL(DrawLineBezier)(*(Vector2 *)startPos, *(Vector2 *)endPos, thick, color);
 }
 
 // Draw a color-filled circle
 inline void DrawCircle(int centerX, int centerY, float radius, uint32_t color)
 {
-    _DrawCircle(centerX, centerY, radius, color);
+    RAYLIB64_CALL(DrawCircle)(centerX, centerY, radius, color);
 }
 
 // Draw a piece of a circle
 inline void DrawCircleSector(void *center, float radius, float startAngle, float endAngle, int segments, uint32_t color)
 {
-    _DrawCircleSector(*(Vector2 *)center, radius, startAngle, endAngle, segments, color);
+    RAYLIB64_CALL(DrawCircleSector)(*(Vector2 *)center, radius, startAngle, endAngle, segments, color);
 }
 
 // Draw circle sector outline
 inline void DrawCircleSectorLines(void *center, float radius, float startAngle, float endAngle, int segments, uint32_t color)
 {
-    _DrawCircleSectorLines(*(Vector2 *)center, radius, startAngle, endAngle, segments, color);
+    RAYLIB64_CALL(DrawCircleSectorLines)(*(Vector2 *)center, radius, startAngle, endAngle, segments, color);
 }
 
 // Draw a gradient-filled circle
 inline void DrawCircleGradient(int centerX, int centerY, float radius, uint32_t color1, uint32_t color2)
 {
-    _DrawCircleGradient(centerX, centerY, radius, color1, color2);
+    RAYLIB64_CALL(DrawCircleGradient)(centerX, centerY, radius, color1, color2);
 }
 
 // Draw a color-filled circle (Vector version)
 inline void DrawCircleV(void *center, float radius, uint32_t color)
 {
-    _DrawCircleV(*(Vector2 *)center, radius, color);
+    RAYLIB64_CALL(DrawCircleV)(*(Vector2 *)center, radius, color);
 }
 
 // Draw circle outline
 inline void DrawCircleLines(int centerX, int centerY, float radius, uint32_t color)
 {
-    _DrawCircleLines(centerX, centerY, radius, color);
+    RAYLIB64_CALL(DrawCircleLines)(centerX, centerY, radius, color);
 }
 
 // Draw circle outline (Vector version)
 inline void DrawCircleLinesV(void *center, float radius, uint32_t color)
 {
-    _DrawCircleLinesV(*(Vector2 *)center, radius, color);
+    RAYLIB64_CALL(DrawCircleLinesV)(*(Vector2 *)center, radius, color);
 }
 
 // Draw ellipse
 inline void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, uint32_t color)
 {
-    _DrawEllipse(centerX, centerY, radiusH, radiusV, color);
+    RAYLIB64_CALL(DrawEllipse)(centerX, centerY, radiusH, radiusV, color);
 }
 
 // Draw ellipse outline
 inline void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, uint32_t color)
 {
-    _DrawEllipseLines(centerX, centerY, radiusH, radiusV, color);
+    RAYLIB64_CALL(DrawEllipseLines)(centerX, centerY, radiusH, radiusV, color);
 }
 
 // Draw ring
 inline void DrawRing(void *center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color)
 {
-    _DrawRing(*(Vector2 *)center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    RAYLIB64_CALL(DrawRing)(*(Vector2 *)center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
 }
 
 // Draw ring outline
 inline void DrawRingLines(void *center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, uint32_t color)
 {
-    _DrawRingLines(*(Vector2 *)center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    RAYLIB64_CALL(DrawRingLines)(*(Vector2 *)center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
 }
 
 // Draw a color-filled rectangle
 inline void DrawRectangle(int posX, int posY, int width, int height, uint32_t color)
 {
-    _DrawRectangle(posX, posY, width, height, color);
+    RAYLIB64_CALL(DrawRectangle)(posX, posY, width, height, color);
 }
 
 // Draw a color-filled rectangle (Vector version)
 inline void DrawRectangleV(void *position, void *size, uint32_t color)
 {
-    _DrawRectangleV(*(Vector2 *)position, *(Vector2 *)size, color);
+    RAYLIB64_CALL(DrawRectangleV)(*(Vector2 *)position, *(Vector2 *)size, color);
 }
 
 // Draw a color-filled rectangle
 inline void DrawRectangleRec(void *rec, uint32_t color)
 {
-    _DrawRectangleRec(*(RRectangle *)rec, color);
+    RAYLIB64_CALL(DrawRectangleRec)(*(RRectangle *)rec, color);
 }
 
 // Draw a color-filled rectangle with pro parameters
 inline void DrawRectanglePro(void *rec, void *origin, float rotation, uint32_t color)
 {
-    _DrawRectanglePro(*(RRectangle *)rec, *(Vector2 *)origin, rotation, color);
+    RAYLIB64_CALL(DrawRectanglePro)(*(RRectangle *)rec, *(Vector2 *)origin, rotation, color);
 }
 
 // Draw a vertical-gradient-filled rectangle
 inline void DrawRectangleGradientV(int posX, int posY, int width, int height, uint32_t color1, uint32_t color2)
 {
-    _DrawRectangleGradientV(posX, posY, width, height, color1, color2);
+    RAYLIB64_CALL(DrawRectangleGradientV)(posX, posY, width, height, color1, color2);
 }
 
 // Draw a horizontal-gradient-filled rectangle
 inline void DrawRectangleGradientH(int posX, int posY, int width, int height, uint32_t color1, uint32_t color2)
 {
-    _DrawRectangleGradientH(posX, posY, width, height, color1, color2);
+    RAYLIB64_CALL(DrawRectangleGradientH)(posX, posY, width, height, color1, color2);
 }
 
 // Draw a gradient-filled rectangle with custom vertex colors
 inline void DrawRectangleGradientEx(void *rec, uint32_t col1, uint32_t col2, uint32_t col3, uint32_t col4)
 {
-    _DrawRectangleGradientEx(*(RRectangle *)rec, col1, col2, col3, col4);
+    RAYLIB64_CALL(DrawRectangleGradientEx)(*(RRectangle *)rec, col1, col2, col3, col4);
 }
 
 // Draw rectangle outline
 inline void DrawRectangleLines(int posX, int posY, int width, int height, uint32_t color)
 {
-    _DrawRectangleLines(posX, posY, width, height, color);
+    RAYLIB64_CALL(DrawRectangleLines)(posX, posY, width, height, color);
 }
 
 // Draw rectangle outline with extended parameters
 inline void DrawRectangleLinesEx(void *rec, float lineThick, uint32_t color)
 {
-    _DrawRectangleLinesEx(*(RRectangle *)rec, lineThick, color);
+    RAYLIB64_CALL(DrawRectangleLinesEx)(*(RRectangle *)rec, lineThick, color);
 }
 
 // Draw rectangle with rounded edges
 inline void DrawRectangleRounded(void *rec, float roundness, int segments, uint32_t color)
 {
-    _DrawRectangleRounded(*(RRectangle *)rec, roundness, segments, color);
+    RAYLIB64_CALL(DrawRectangleRounded)(*(RRectangle *)rec, roundness, segments, color);
 }
 
 // Draw rectangle with rounded edges outline
 inline void DrawRectangleRoundedLines(void *rec, float roundness, int segments, float lineThick, uint32_t color)
 {
-    _DrawRectangleRoundedLines(*(RRectangle *)rec, roundness, segments, lineThick, color);
+    RAYLIB64_CALL(DrawRectangleRoundedLines)(*(RRectangle *)rec, roundness, segments, lineThick, color);
 }
 
 // Draw a color-filled triangle (vertex in counter-clockwise order!)
 inline void DrawTriangle(void *v1, void *v2, void *v3, uint32_t color)
 {
-    _DrawTriangle(*(Vector2 *)v1, *(Vector2 *)v2, *(Vector2 *)v3, color);
+    RAYLIB64_CALL(DrawTriangle)(*(Vector2 *)v1, *(Vector2 *)v2, *(Vector2 *)v3, color);
 }
 
 // Draw triangle outline (vertex in counter-clockwise order!)
 inline void DrawTriangleLines(void *v1, void *v2, void *v3, uint32_t color)
 {
-    _DrawTriangleLines(*(Vector2 *)v1, *(Vector2 *)v2, *(Vector2 *)v3, color);
+    RAYLIB64_CALL(DrawTriangleLines)(*(Vector2 *)v1, *(Vector2 *)v2, *(Vector2 *)v3, color);
 }
 
 // Draw a triangle fan defined by points (first vertex is the center)
 inline void DrawTriangleFan(void *points, int pointCount, uint32_t color)
 {
-    _DrawTriangleFan((Vector2 *)points, pointCount, color);
+    RAYLIB64_CALL(DrawTriangleFan)((Vector2 *)points, pointCount, color);
 }
 
 // Draw a triangle strip defined by points
 inline void DrawTriangleStrip(void *points, int pointCount, uint32_t color)
 {
-    _DrawTriangleStrip((Vector2 *)points, pointCount, color);
+    RAYLIB64_CALL(DrawTriangleStrip)((Vector2 *)points, pointCount, color);
 }
 
 // Draw a regular polygon (Vector version)
 inline void DrawPoly(void *center, int sides, float radius, float rotation, uint32_t color)
 {
-    _DrawPoly(*(Vector2 *)center, sides, radius, rotation, color);
+    RAYLIB64_CALL(DrawPoly)(*(Vector2 *)center, sides, radius, rotation, color);
 }
 
 // Draw a polygon outline of n sides
 inline void DrawPolyLines(void *center, int sides, float radius, float rotation, uint32_t color)
 {
-    _DrawPolyLines(*(Vector2 *)center, sides, radius, rotation, color);
+    RAYLIB64_CALL(DrawPolyLines)(*(Vector2 *)center, sides, radius, rotation, color);
 }
 
 // Draw a polygon outline of n sides with extended parameters
 inline void DrawPolyLinesEx(void *center, int sides, float radius, float rotation, float lineThick, uint32_t color)
 {
-    _DrawPolyLinesEx(*(Vector2 *)center, sides, radius, rotation, lineThick, color);
+    RAYLIB64_CALL(DrawPolyLinesEx)(*(Vector2 *)center, sides, radius, rotation, lineThick, color);
 }
 
 // Draw spline: Linear, minimum 2 points
 inline void DrawSplineLinear(void *points, int pointCount, float thick, uint32_t color)
 {
-    _DrawSplineLinear((Vector2 *)points, pointCount, thick, color);
+    RAYLIB64_CALL(DrawSplineLinear)((Vector2 *)points, pointCount, thick, color);
 }
 
 // Draw spline: B-Spline, minimum 4 points
 inline void DrawSplineBasis(void *points, int pointCount, float thick, uint32_t color)
 {
-    _DrawSplineBasis((Vector2 *)points, pointCount, thick, color);
+    RAYLIB64_CALL(DrawSplineBasis)((Vector2 *)points, pointCount, thick, color);
 }
 
 // Draw spline: Catmull-Rom, minimum 4 points
 inline void DrawSplineCatmullRom(void *points, int pointCount, float thick, uint32_t color)
 {
-    _DrawSplineCatmullRom((Vector2 *)points, pointCount, thick, color);
+    RAYLIB64_CALL(DrawSplineCatmullRom)((Vector2 *)points, pointCount, thick, color);
 }
 
 // Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
 inline void DrawSplineBezierQuadratic(void *points, int pointCount, float thick, uint32_t color)
 {
-    _DrawSplineBezierQuadratic((Vector2 *)points, pointCount, thick, color);
+    RAYLIB64_CALL(DrawSplineBezierQuadratic)((Vector2 *)points, pointCount, thick, color);
 }
 
 // Draw spline: Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...]
 inline void DrawSplineBezierCubic(void *points, int pointCount, float thick, uint32_t color)
 {
-    _DrawSplineBezierCubic((Vector2 *)points, pointCount, thick, color);
+    RAYLIB64_CALL(DrawSplineBezierCubic)((Vector2 *)points, pointCount, thick, color);
 }
 
 // Draw spline segment: Linear, 2 points
 inline void DrawSplineSegmentLinear(void *p1, void *p2, float thick, uint32_t color)
 {
-    _DrawSplineSegmentLinear(*(Vector2 *)p1, *(Vector2 *)p2, thick, color);
+    RAYLIB64_CALL(DrawSplineSegmentLinear)(*(Vector2 *)p1, *(Vector2 *)p2, thick, color);
 }
 
 // Draw spline segment: B-Spline, 4 points
 inline void DrawSplineSegmentBasis(void *p1, void *p2, void *p3, void *p4, float thick, uint32_t color)
 {
-    _DrawSplineSegmentBasis(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, thick, color);
+    RAYLIB64_CALL(DrawSplineSegmentBasis)(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, thick, color);
 }
 
 // Draw spline segment: Catmull-Rom, 4 points
 inline void DrawSplineSegmentCatmullRom(void *p1, void *p2, void *p3, void *p4, float thick, uint32_t color)
 {
-    _DrawSplineSegmentCatmullRom(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, thick, color);
+    RAYLIB64_CALL(DrawSplineSegmentCatmullRom)(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, thick, color);
 }
 
 // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 inline void DrawSplineSegmentBezierQuadratic(void *p1, void *c2, void *p3, float thick, uint32_t color)
 {
-    _DrawSplineSegmentBezierQuadratic(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)p3, thick, color);
+    RAYLIB64_CALL(DrawSplineSegmentBezierQuadratic)(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)p3, thick, color);
 }
 
 // Draw spline segment: Cubic Bezier, 2 points, 2 control points
 inline void DrawSplineSegmentBezierCubic(void *p1, void *c2, void *c3, void *p4, float thick, uint32_t color)
 {
-    _DrawSplineSegmentBezierCubic(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)c3, *(Vector2 *)p4, thick, color);
+    RAYLIB64_CALL(DrawSplineSegmentBezierCubic)(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)c3, *(Vector2 *)p4, thick, color);
 }
 
 // Get (evaluate) spline point: Linear
 inline void GetSplinePointLinear(void *startPos, void *endPos, float t, void *retVal)
 {
-    *(Vector2 *)retVal = _GetSplinePointLinear(*(Vector2 *)startPos, *(Vector2 *)endPos, t);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetSplinePointLinear)(*(Vector2 *)startPos, *(Vector2 *)endPos, t);
 }
 
 // Get (evaluate) spline point: B-Spline
 inline void GetSplinePointBasis(void *p1, void *p2, void *p3, void *p4, float t, void *retVal)
 {
-    *(Vector2 *)retVal = _GetSplinePointBasis(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, t);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetSplinePointBasis)(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, t);
 }
 
 // Get (evaluate) spline point: Catmull-Rom
 inline void GetSplinePointCatmullRom(void *p1, void *p2, void *p3, void *p4, float t, void *retVal)
 {
-    *(Vector2 *)retVal = _GetSplinePointCatmullRom(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, t);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetSplinePointCatmullRom)(*(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3, *(Vector2 *)p4, t);
 }
 
 // Get (evaluate) spline point: Quadratic Bezier
 inline void GetSplinePointBezierQuad(void *p1, void *c2, void *p3, float t, void *retVal)
 {
-    *(Vector2 *)retVal = _GetSplinePointBezierQuad(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)p3, t);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetSplinePointBezierQuad)(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)p3, t);
 }
 
 // Get (evaluate) spline point: Cubic Bezier
 inline void GetSplinePointBezierCubic(void *p1, void *c2, void *c3, void *p4, float t, void *retVal)
 {
-    *(Vector2 *)retVal = _GetSplinePointBezierCubic(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)c3, *(Vector2 *)p4, t);
+    *(Vector2 *)retVal = RAYLIB64_CALL(GetSplinePointBezierCubic)(*(Vector2 *)p1, *(Vector2 *)c2, *(Vector2 *)c3, *(Vector2 *)p4, t);
 }
 
 // Check collision between two rectangles
 inline qb_bool CheckCollisionRecs(void *rec1, void *rec2)
 {
-    return TO_QB_BOOL(_CheckCollisionRecs(*(RRectangle *)rec1, *(RRectangle *)rec2));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionRecs)(*(RRectangle *)rec1, *(RRectangle *)rec2));
 }
 
 // Check collision between two circles
 inline qb_bool CheckCollisionCircles(void *center1, float radius1, void *center2, float radius2)
 {
-    return TO_QB_BOOL(_CheckCollisionCircles(*(Vector2 *)center1, radius1, *(Vector2 *)center2, radius2));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionCircles)(*(Vector2 *)center1, radius1, *(Vector2 *)center2, radius2));
 }
 
 // Check collision between circle and rectangle
 inline qb_bool CheckCollisionCircleRec(void *center, float radius, void *rec)
 {
-    return TO_QB_BOOL(_CheckCollisionCircleRec(*(Vector2 *)center, radius, *(RRectangle *)rec));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionCircleRec)(*(Vector2 *)center, radius, *(RRectangle *)rec));
 }
 
 // Check if point is inside rectangle
 inline qb_bool CheckCollisionPointRec(void *point, void *rec)
 {
-    return TO_QB_BOOL(_CheckCollisionPointRec(*(Vector2 *)point, *(RRectangle *)rec));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionPointRec)(*(Vector2 *)point, *(RRectangle *)rec));
 }
 
 // Check if point is inside circle
 inline qb_bool CheckCollisionPointCircle(void *point, void *center, float radius)
 {
-    return TO_QB_BOOL(_CheckCollisionPointCircle(*(Vector2 *)point, *(Vector2 *)center, radius));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionPointCircle)(*(Vector2 *)point, *(Vector2 *)center, radius));
 }
 
 // Check if point is inside a triangle
 inline qb_bool CheckCollisionPointTriangle(void *point, void *p1, void *p2, void *p3)
 {
-    return TO_QB_BOOL(_CheckCollisionPointTriangle(*(Vector2 *)point, *(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionPointTriangle)(*(Vector2 *)point, *(Vector2 *)p1, *(Vector2 *)p2, *(Vector2 *)p3));
 }
 
 // Check if point is within a polygon described by array of vertices
 inline qb_bool CheckCollisionPointPoly(void *point, void *points, int pointCount)
 {
-    return TO_QB_BOOL(_CheckCollisionPointPoly(*(Vector2 *)point, (Vector2 *)points, pointCount));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionPointPoly)(*(Vector2 *)point, (Vector2 *)points, pointCount));
 }
 
 // Check the collision between two lines defined by two points each, returns collision point by reference
 inline qb_bool CheckCollisionLines(void *startPos1, void *endPos1, void *startPos2, void *endPos2, void *collisionPoint)
 {
-    return TO_QB_BOOL(_CheckCollisionLines(*(Vector2 *)startPos1, *(Vector2 *)endPos1, *(Vector2 *)startPos2, *(Vector2 *)endPos2, (Vector2 *)collisionPoint));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionLines)(*(Vector2 *)startPos1, *(Vector2 *)endPos1, *(Vector2 *)startPos2, *(Vector2 *)endPos2, (Vector2 *)collisionPoint));
 }
 
 // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 inline qb_bool CheckCollisionPointLine(void *point, void *p1, void *p2, int threshold)
 {
-    return TO_QB_BOOL(_CheckCollisionPointLine(*(Vector2 *)point, *(Vector2 *)p1, *(Vector2 *)p2, threshold));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionPointLine)(*(Vector2 *)point, *(Vector2 *)p1, *(Vector2 *)p2, threshold));
 }
 
 // Get collision rectangle for two rectangles collision
 inline void GetCollisionRec(void *rec1, void *rec2, void *retVal)
 {
-    *(RRectangle *)retVal = _GetCollisionRec(*(RRectangle *)rec1, *(RRectangle *)rec2);
+    *(RRectangle *)retVal = RAYLIB64_CALL(GetCollisionRec)(*(RRectangle *)rec1, *(RRectangle *)rec2);
 }
 
-// Load image from file into CPU memory (RAM)
-inline void RLoadImage(char *fileName, void *retVal)
+/// @brief A packed bitgrid of solid cells used by the collision grid functions below
+struct ___collision_grid_raylib64
 {
-    *(Image *)retVal = _LoadImage(fileName);
-}
+    int32_t width;     // Grid width in cells
+    int32_t height;    // Grid height in cells
+    float originX;     // World x of the grid's top-left corner
+    float originY;     // World y of the grid's top-left corner
+    float cellSize;    // Cell width and height in world units
+    size_t rowWords;   // 64-bit words per row
+    uint64_t *bits;    // Solid cell bits (row-major)
+};
 
-// Load image from RAW file data
-inline void LoadImageRaw(char *fileName, int width, int height, int format, int headerSize, void *retVal)
+static inline bool ___collision_grid_solid_raylib64(const ___collision_grid_raylib64 *grid, int32_t x, int32_t y)
 {
-    *(Image *)retVal = _LoadImageRaw(fileName, width, height, format, headerSize);
+    return (grid->bits[size_t(y) * grid->rowWords + (size_t(x) >> 6)] >> (x & 63)) & 1;
 }
 
-// Load image from SVG file data or string with specified size
-inline void LoadImageSvg(char *fileNameOrString, int width, int height, void *retVal)
+/// @brief Returns true if any cell in the row between x1 and x2 (inclusive) is solid. Whole words are tested at once
+static inline bool ___collision_grid_row_any_raylib64(const ___collision_grid_raylib64 *grid, int32_t y, int32_t x1, int32_t x2)
 {
-    *(Image *)retVal = _LoadImageSvg(fileNameOrString, width, height);
+    auto row = &grid->bits[size_t(y) * grid->rowWords];
+
+    for (auto w = x1 >> 6; w <= x2 >> 6; w++)
+    {
+        auto mask = ~uint64_t(0);
+        if (w == x1 >> 6)
+            mask &= ~uint64_t(0) << (x1 & 63);
+        if (w == x2 >> 6)
+            mask &= ~uint64_t(0) >> (63 - (x2 & 63));
+
+        if (row[w] & mask)
+            return true;
+    }
+
+    return false;
 }
 
-// Load image sequence from file (frames appended to image.data)
-inline void LoadImageAnim(char *fileName, void *frames, void *retVal)
+/// @brief Builds a collision grid from an image. Each pixel becomes one cell that is solid when the selected channel is >= threshold
+/// @param image The source image (any pixel format)
+/// @param channel 0 = red, 1 = green, 2 = blue, 3 = alpha
+/// @param threshold The minimum channel value (0 - 255) of a solid cell
+/// @param origin World position (Vector2) of the top-left corner of the grid
+/// @param cellSize Width and height of a cell in world units
+/// @return A grid handle or 0 on failure. Free it with UnloadCollisionGrid()
+inline uintptr_t LoadCollisionGrid(void *image, int32_t channel, int32_t threshold, void *origin, float cellSize)
 {
-    *(Image *)retVal = _LoadImageAnim(fileName, (int *)frames);
+    auto img = (Image *)image;
+
+    if (img->width <= 0 || img->height <= 0 || channel < 0 || channel > 3 || cellSize <= 0.0f)
+        return 0;
+
+    auto colors = (const uint8_t *)RAYLIB64_CALL(LoadImageColors)(*img);
+    if (!colors)
+        return 0;
+
+    auto rowWords = (size_t(img->width) + 63) >> 6;
+    auto grid = (___collision_grid_raylib64 *)calloc(1, sizeof(___collision_grid_raylib64) + rowWords * img->height * sizeof(uint64_t));
+    if (grid)
+    {
+        grid->width = img->width;
+        grid->height = img->height;
+        grid->originX = ((Vector2 *)origin)->x;
+        grid->originY = ((Vector2 *)origin)->y;
+        grid->cellSize = cellSize;
+        grid->rowWords = rowWords;
+        grid->bits = (uint64_t *)(grid + 1);
+
+        for (int32_t y = 0; y < grid->height; y++)
+        {
+            for (int32_t x = 0; x < grid->width; x++)
+            {
+                if (colors[(size_t(y) * grid->width + x) * 4 + channel] >= threshold)
+                    grid->bits[size_t(y) * rowWords + (x >> 6)] |= uint64_t(1) << (x & 63);
+            }
+        }
+    }
+
+    RAYLIB64_CALL(UnloadImageColors)((uint32_t *)colors);
+
+    return (uintptr_t)grid;
 }
 
-// Load image from memory buffer, fileType refers to extension: i.e. '.png'
-inline void LoadImageFromMemory(char *fileType, uintptr_t fileData, int dataSize, void *retVal)
+/// @brief Frees a collision grid created by LoadCollisionGrid()
+/// @param grid The grid handle
+inline void UnloadCollisionGrid(uintptr_t grid)
 {
-    *(Image *)retVal = _LoadImageFromMemory(fileType, (unsigned char *)fileData, dataSize);
+    free((void *)grid);
 }
 
-// Load image from GPU texture data
-inline void LoadImageFromTexture(void *texture, void *retVal)
+/// @brief Checks if a grid cell is solid
+/// @param grid The grid handle
+/// @param x The cell column
+/// @param y The cell row
+/// @return True if the cell is solid. Cells outside the grid are never solid
+inline qb_bool IsCollisionGridCellSolid(uintptr_t grid, int32_t x, int32_t y)
 {
-    *(Image *)retVal = _LoadImageFromTexture(*(Texture *)texture);
+    auto g = (const ___collision_grid_raylib64 *)grid;
+
+    return TO_QB_BOOL(x >= 0 && y >= 0 && x < g->width && y < g->height && ___collision_grid_solid_raylib64(g, x, y));
 }
 
-// Load image from screen buffer and (screenshot)
-inline void LoadImageFromScreen(void *retVal)
+/// @brief Checks collision between a rectangle and the solid cells of a grid. Only the cells under the rectangle are tested
+/// @param grid The grid handle
+/// @param rec The rectangle in world units
+/// @return True if the rectangle overlaps a solid cell
+inline qb_bool CheckCollisionGridRec(uintptr_t grid, void *rec)
 {
-    *(Image *)retVal = _LoadImageFromScreen();
-}
+    auto g = (const ___collision_grid_raylib64 *)grid;
+    auto r = (const RRectangle *)rec;
+
+    // Touching edges do not collide (same as CheckCollisionRecs())
+    auto x1 = std::max(int32_t(floorf((r->x - g->originX) / g->cellSize)), 0);
+    auto y1 = std::max(int32_t(floorf((r->y - g->originY) / g->cellSize)), 0);
+    auto x2 = std::min(int32_t(ceilf((r->x + r->width - g->originX) / g->cellSize)) - 1, g->width - 1);
+    auto y2 = std::min(int32_t(ceilf((r->y + r->height - g->originY) / g->cellSize)) - 1, g->height - 1);
+
+    for (auto y = y1; y <= y2 && x1 <= x2; y++)
+    {
+        if (___collision_grid_row_any_raylib64(g, y, x1, x2))
+            return QB_TRUE;
+    }
+
+    return QB_FALSE;
+}
+
+/// @brief Checks collision between a circle and the solid cells of a grid. Only the cells under the circle's bounds are tested
+/// @param grid The grid handle
+/// @param center The circle center (Vector2) in world units
+/// @param radius The circle radius in world units
+/// @return True if the circle overlaps a solid cell
+inline qb_bool CheckCollisionGridCircle(uintptr_t grid, void *center, float radius)
+{
+    auto g = (const ___collision_grid_raylib64 *)grid;
+    auto cx = (((Vector2 *)center)->x - g->originX) / g->cellSize;
+    auto cy = (((Vector2 *)center)->y - g->originY) / g->cellSize;
+    auto r = radius / g->cellSize;
+
+    auto x1 = std::max(int32_t(floorf(cx - r)), 0);
+    auto y1 = std::max(int32_t(floorf(cy - r)), 0);
+    auto x2 = std::min(int32_t(floorf(cx + r)), g->width - 1);
+    auto y2 = std::min(int32_t(floorf(cy + r)), g->height - 1);
+
+    for (auto y = y1; y <= y2 && x1 <= x2; y++)
+    {
+        if (!___collision_grid_row_any_raylib64(g, y, x1, x2))
+            continue;
+
+        for (auto x = x1; x <= x2; x++)
+        {
+            if (!___collision_grid_solid_raylib64(g, x, y))
+                continue;
+
+            // Distance from the circle center to the closest point of the cell
+            auto dx = cx - std::min(std::max(cx, float(x)), float(x + 1));
+            auto dy = cy - std::min(std::max(cy, float(y)), float(y + 1));
+
+            if (dx * dx + dy * dy <= r * r)
+                return QB_TRUE;
+        }
+    }
+
+    return QB_FALSE;
+}
+
+/// @brief Casts a 2D ray through a grid and finds the first solid cell it enters (DDA, one step per crossed cell)
+/// @param grid The grid handle
+/// @param origin The ray origin (Vector2) in world units
+/// @param direction The ray direction (Vector2). It does not need to be normalized
+/// @param maxDistance The maximum distance to travel in world units
+/// @param point Receives the hit position (Vector2) in world units
+/// @return True if a solid cell was hit within maxDistance
+inline qb_bool GetRayCollisionGrid(uintptr_t grid, void *origin, void *direction, float maxDistance, void *point)
+{
+    auto g = (const ___collision_grid_raylib64 *)grid;
+    auto o = (const Vector2 *)origin;
+    auto d = (const Vector2 *)direction;
+
+    auto length = sqrtf(d->x * d->x + d->y * d->y);
+    if (length == 0.0f)
+        return QB_FALSE;
+
+    // Work in cell units
+    auto px = (o->x - g->originX) / g->cellSize, py = (o->y - g->originY) / g->cellSize;
+    auto dx = d->x / length, dy = d->y / length;
+    auto tMax = maxDistance / g->cellSize;
+
+    // Clip the ray to the grid bounds (slab test)
+    auto tEnter = 0.0f, tExit = tMax;
+    for (auto axis = 0; axis < 2; axis++)
+    {
+        auto p = axis ? py : px, v = axis ? dy : dx, size = float(axis ? g->height : g->width);
+
+        if (v == 0.0f)
+        {
+            if (p < 0.0f || p > size)
+                return QB_FALSE;
+        }
+        else
+        {
+            auto t1 = (0.0f - p) / v, t2 = (size - p) / v;
+            tEnter = std::max(tEnter, std::min(t1, t2));
+            tExit = std::min(tExit, std::max(t1, t2));
+        }
+    }
+
+    if (tEnter > tExit)
+        return QB_FALSE;
+
+    auto x = std::min(std::max(int32_t(floorf(px + dx * tEnter)), 0), g->width - 1);
+    auto y = std::min(std::max(int32_t(floorf(py + dy * tEnter)), 0), g->height - 1);
+    auto stepX = dx > 0.0f ? 1 : -1, stepY = dy > 0.0f ? 1 : -1;
+    auto deltaX = dx != 0.0f ? fabsf(1.0f / dx) : INFINITY, deltaY = dy != 0.0f ? fabsf(1.0f / dy) : INFINITY;
+    auto nextX = dx != 0.0f ? (float(x + (stepX > 0)) - px) / dx : INFINITY;
+    auto nextY = dy != 0.0f ? (float(y + (stepY > 0)) - py) / dy : INFINITY;
+    auto t = tEnter;
+
+    for (;;)
+    {
+        if (___collision_grid_solid_raylib64(g, x, y))
+        {
+            ((Vector2 *)point)->x = o->x + dx * t * g->cellSize;
+            ((Vector2 *)point)->y = o->y + dy * t * g->cellSize;
+            return QB_TRUE;
+        }
+
+        if (nextX < nextY)
+        {
+            t = nextX;
+            nextX += deltaX;
+            x += stepX;
+        }
+        else
+        {
+            t = nextY;
+            nextY += deltaY;
+            y += stepY;
+        }
+
+        if (t > tExit || x < 0 || y < 0 || x >= g->width || y >= g->height)
+            return QB_FALSE;
+    }
+}
+
+/// @brief A uniform grid broadphase for rectangles and circles. Cells are hashed, so the world does not need bounds
+struct ___spatial_hash_raylib64
+{
+    struct Object
+    {
+        RRectangle bounds; // Bounding rectangle
+        Vector2 center;    // Circle center
+        float radius;      // Circle radius or a negative value for rectangles
+    };
+
+    struct Entry
+    {
+        int32_t cellX, cellY;
+        int32_t object;
+    };
+
+    float cellSize;
+    bool dirty;
+    std::vector<Object> objects;
+    std::vector<Entry> entries;      // One entry per (cell, object), grouped by bucket
+    std::vector<uint32_t> buckets;   // Start of each bucket in entries (bucket count + 1 values)
+    std::vector<Entry> scratch;
+    std::vector<uint32_t> marks;     // Per-object query stamps to report each object once
+    uint32_t stamp;
+};
+
+static inline uint32_t ___spatial_hash_bucket_raylib64(int32_t x, int32_t y, uint32_t mask)
+{
+    return ((uint32_t(x) * 73856093u) ^ (uint32_t(y) * 19349663u)) & mask;
+}
+
+static inline void ___spatial_hash_cells_raylib64(const ___spatial_hash_raylib64 *h, const RRectangle &r, int32_t &x1, int32_t &y1, int32_t &x2, int32_t &y2)
+{
+    x1 = int32_t(floorf(r.x / h->cellSize));
+    y1 = int32_t(floorf(r.y / h->cellSize));
+    x2 = int32_t(floorf((r.x + r.width) / h->cellSize));
+    y2 = int32_t(floorf((r.y + r.height) / h->cellSize));
+}
+
+/// @brief Exact overlap test. Rectangles and circles follow CheckCollisionRecs() and CheckCollisionCircles(). Circle vs rectangle uses the closest point on the rectangle (CheckCollisionCircleRec() rounds the rectangle center to integers)
+static inline bool ___spatial_hash_overlap_raylib64(const ___spatial_hash_raylib64::Object &a, const ___spatial_hash_raylib64::Object &b)
+{
+    if (a.radius < 0.0f && b.radius < 0.0f)
+        return a.bounds.x < b.bounds.x + b.bounds.width && a.bounds.x + a.bounds.width > b.bounds.x && a.bounds.y < b.bounds.y + b.bounds.height && a.bounds.y + a.bounds.height > b.bounds.y;
+
+    if (a.radius >= 0.0f && b.radius >= 0.0f)
+    {
+        auto dx = b.center.x - a.center.x, dy = b.center.y - a.center.y;
+        return dx * dx + dy * dy <= (a.radius + b.radius) * (a.radius + b.radius);
+    }
+
+    auto &c = a.radius >= 0.0f ? a : b;
+    auto &r = a.radius >= 0.0f ? b : a;
+    auto dx = c.center.x - std::min(std::max(c.center.x, r.bounds.x), r.bounds.x + r.bounds.width);
+    auto dy = c.center.y - std::min(std::max(c.center.y, r.bounds.y), r.bounds.y + r.bounds.height);
+
+    return dx * dx + dy * dy <= c.radius * c.radius;
+}
+
+/// @brief Rebuilds the cell buckets after objects were added (counting sort of the cell entries by bucket)
+static void ___spatial_hash_build_raylib64(___spatial_hash_raylib64 *h)
+{
+    if (!h->dirty)
+        return;
+
+    h->dirty = false;
+    h->scratch.clear();
+
+    for (int32_t i = 0; i < int32_t(h->objects.size()); i++)
+    {
+        int32_t x1, y1, x2, y2;
+        ___spatial_hash_cells_raylib64(h, h->objects[i].bounds, x1, y1, x2, y2);
+
+        for (auto y = y1; y <= y2; y++)
+            for (auto x = x1; x <= x2; x++)
+                h->scratch.push_back({x, y, i});
+    }
+
+    uint32_t bucketCount = 16;
+    while (bucketCount < h->scratch.size() * 2)
+        bucketCount <<= 1;
+
+    h->buckets.assign(bucketCount + 1, 0);
+    for (auto &e : h->scratch)
+        h->buckets[___spatial_hash_bucket_raylib64(e.cellX, e.cellY, bucketCount - 1) + 1]++;
+
+    for (uint32_t b = 0; b < bucketCount; b++)
+        h->buckets[b + 1] += h->buckets[b];
+
+    h->entries.resize(h->scratch.size());
+    std::vector<uint32_t> next(h->buckets.begin(), h->buckets.end() - 1);
+    for (auto &e : h->scratch)
+        h->entries[next[___spatial_hash_bucket_raylib64(e.cellX, e.cellY, bucketCount - 1)]++] = e;
+
+    h->marks.assign(h->objects.size(), 0);
+    h->stamp = 0;
+}
+
+/// @brief Creates an empty spatial hash
+/// @param cellSize The cell width and height in world units. About the size of a typical object works best
+/// @return A spatial hash handle. Free it with DestroySpatialHash()
+inline uintptr_t CreateSpatialHash(float cellSize)
+{
+    auto h = new ___spatial_hash_raylib64();
+    h->cellSize = cellSize > 0.0f ? cellSize : 1.0f;
+    h->dirty = true; // Queries on an empty hash still need the (empty) buckets
+
+    return (uintptr_t)h;
+}
+
+/// @brief Frees a spatial hash created by CreateSpatialHash()
+/// @param hash The spatial hash handle
+inline void DestroySpatialHash(uintptr_t hash)
+{
+    delete (___spatial_hash_raylib64 *)hash;
+}
+
+/// @brief Removes all objects. Object ids restart at 0
+/// @param hash The spatial hash handle
+inline void ClearSpatialHash(uintptr_t hash)
+{
+    auto h = (___spatial_hash_raylib64 *)hash;
+
+    h->objects.clear();
+    h->dirty = true;
+}
+
+/// @brief Adds count rectangles from a UDT array in one call. Object ids are assigned in the order objects are added
+/// @param hash The spatial hash handle
+/// @param recs Pointer to the first RRectangle
+/// @param stride Bytes between consecutive rectangles (LEN of the UDT)
+/// @param count The number of rectangles
+inline void AddSpatialHashRecs(uintptr_t hash, uintptr_t recs, size_t stride, int32_t count)
+{
+    auto h = (___spatial_hash_raylib64 *)hash;
+
+    for (int32_t i = 0; i < count; i++, recs += stride)
+        h->objects.push_back({*(const RRectangle *)recs, {0.0f, 0.0f}, -1.0f});
+
+    h->dirty = true;
+}
+
+/// @brief Adds count circles from a UDT array in one call. Object ids are assigned in the order objects are added
+/// @param hash The spatial hash handle
+/// @param centers Pointer to the first Vector2 center
+/// @param radii Pointer to the first SINGLE radius
+/// @param stride Bytes between consecutive circles (LEN of the UDT)
+/// @param count The number of circles
+inline void AddSpatialHashCircles(uintptr_t hash, uintptr_t centers, uintptr_t radii, size_t stride, int32_t count)
+{
+    auto h = (___spatial_hash_raylib64 *)hash;
+
+    for (int32_t i = 0; i < count; i++, centers += stride, radii += stride)
+    {
+        auto c = *(const Vector2 *)centers;
+        auto r = fabsf(*(const float *)radii);
+        h->objects.push_back({{c.x - r, c.y - r, r * 2.0f, r * 2.0f}, c, r});
+    }
+
+    h->dirty = true;
+}
+
+/// @brief Finds all pairs of overlapping objects
+/// @param hash The spatial hash handle
+/// @param pairs Receives two LONG object ids per pair (the lower id first)
+/// @param maxPairs The capacity of pairs in pairs (not in LONGs)
+/// @return The total number of overlapping pairs. Only the first maxPairs are written
+inline int32_t GetSpatialHashPairs(uintptr_t hash, void *pairs, int32_t maxPairs)
+{
+    auto h = (___spatial_hash_raylib64 *)hash;
+    auto out = (int32_t *)pairs;
+    int32_t found = 0;
+
+    ___spatial_hash_build_raylib64(h);
+
+    for (size_t b = 0; b + 1 < h->buckets.size(); b++)
+    {
+        for (auto i = h->buckets[b]; i < h->buckets[b + 1]; i++)
+        {
+            auto &ei = h->entries[i];
+            auto &a = h->objects[ei.object];
+
+            for (auto j = i + 1; j < h->buckets[b + 1]; j++)
+            {
+                auto &ej = h->entries[j];
+                if (ej.cellX != ei.cellX || ej.cellY != ei.cellY)
+                    continue; // different cell in the same bucket
+
+                auto &o = h->objects[ej.object];
+
+                // Objects that share several cells are only reported in the cell that holds the top-left corner of their bounds overlap
+                if (int32_t(floorf(std::max(a.bounds.x, o.bounds.x) / h->cellSize)) != ei.cellX || int32_t(floorf(std::max(a.bounds.y, o.bounds.y) / h->cellSize)) != ei.cellY)
+                    continue;
+
+                if (!___spatial_hash_overlap_raylib64(a, o))
+                    continue;
+
+                if (found < maxPairs)
+                {
+                    out[found * 2] = std::min(ei.object, ej.object);
+                    out[found * 2 + 1] = std::max(ei.object, ej.object);
+                }
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+/// @brief Finds all objects that overlap a rectangle
+/// @param hash The spatial hash handle
+/// @param rec The query rectangle
+/// @param results Receives a LONG object id per overlapping object
+/// @param maxResults The capacity of results
+/// @return The total number of overlapping objects. Only the first maxResults are written
+inline int32_t QuerySpatialHashRec(uintptr_t hash, void *rec, void *results, int32_t maxResults)
+{
+    auto h = (___spatial_hash_raylib64 *)hash;
+    auto out = (int32_t *)results;
+    auto query = ___spatial_hash_raylib64::Object{*(const RRectangle *)rec, {0.0f, 0.0f}, -1.0f};
+    int32_t found = 0;
+
+    ___spatial_hash_build_raylib64(h);
+
+    if (++h->stamp == 0)
+    {
+        std::fill(h->marks.begin(), h->marks.end(), 0);
+        h->stamp = 1;
+    }
+
+    auto mask = uint32_t(h->buckets.size() - 2);
+
+    int32_t x1, y1, x2, y2;
+    ___spatial_hash_cells_raylib64(h, query.bounds, x1, y1, x2, y2);
+
+    for (auto y = y1; y <= y2; y++)
+    {
+        for (auto x = x1; x <= x2; x++)
+        {
+            auto b = ___spatial_hash_bucket_raylib64(x, y, mask);
+
+            for (auto i = h->buckets[b]; i < h->buckets[b + 1]; i++)
+            {
+                auto &e = h->entries[i];
+                if (e.cellX != x || e.cellY != y || h->marks[e.object] == h->stamp)
+                    continue;
+
+                h->marks[e.object] = h->stamp;
+
+                if (___spatial_hash_overlap_raylib64(query, h->objects[e.object]))
+                {
+                    if (found < maxResults)
+                        out[found] = e.object;
+                    found++;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+// Load image from file into CPU memory (RAM)
+inline void RLoadImage(uintptr_t fileName, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImage)((char *)fileName);
+}
+
+// Load image from RAW file data
+inline void LoadImageRaw(uintptr_t fileName, int width, int height, int format, int headerSize, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageRaw)((char *)fileName, width, height, format, headerSize);
+}
+
+// Load image from SVG file data or string with specified size
+inline void LoadImageSvg(uintptr_t fileNameOrString, int width, int height, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageSvg)((char *)fileNameOrString, width, height);
+}
+
+// Load image sequence from file (frames appended to image.data)
+inline void LoadImageAnim(uintptr_t fileName, void *frames, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageAnim)((char *)fileName, (int *)frames);
+}
+
+// Load image from memory buffer, fileType refers to extension: i.e. '.png'
+inline void LoadImageFromMemory(uintptr_t fileType, uintptr_t fileData, int dataSize, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageFromMemory)((char *)fileType, (unsigned char *)fileData, dataSize);
+}
+
+// Load image from GPU texture data
+inline void LoadImageFromTexture(void *texture, void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageFromTexture)(*(Texture *)texture);
+}
+
+// Load image from screen buffer and (screenshot)
+inline void LoadImageFromScreen(void *retVal)
+{
+    *(Image *)retVal = RAYLIB64_CALL(LoadImageFromScreen)();
+}
 
 // Check if an image is ready
 inline qb_bool IsImageReady(void *image)
 {
-    return TO_QB_BOOL(_IsImageReady(*(Image *)image));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsImageReady)(*(Image *)image));
 }
 
 // Unload image from CPU memory (RAM)
 inline void UnloadImage(void *image)
 {
-    _UnloadImage(*(Image *)image);
+    RAYLIB64_CALL(UnloadImage)(*(Image *)image);
 }
 
 // Export image data to file, returns true on success
-inline qb_bool ExportImage(void *image, char *fileName)
+inline qb_bool ExportImage(void *image, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportImage(*(Image *)image, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportImage)(*(Image *)image, (char *)fileName));
 }
 
 // Export image to memory buffer
-inline void *ExportImageToMemory(void *image, char *fileType, void *fileSize)
+inline void *ExportImageToMemory(void *image, uintptr_t fileType, void *fileSize)
 {
-    return _ExportImageToMemory(*(Image *)image, fileType, (int *)fileSize);
+    return RAYLIB64_CALL(ExportImageToMemory)(*(Image *)image, (char *)fileType, (int *)fileSize);
 }
 
 // Export image as code file defining an array of bytes, returns true on success
-inline qb_bool ExportImageAsCode(void *image, char *fileName)
+inline qb_bool ExportImageAsCode(void *image, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportImageAsCode(*(Image *)image, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportImageAsCode)(*(Image *)image, (char *)fileName));
 }
 
 // Generate image: plain color
 inline void GenImageColor(int width, int height, uint32_t color, void *retVal)
 {
-    *(Image *)retVal = _GenImageColor(width, height, color);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageColor)(width, height, color);
 }
 
 // Generate image: linear gradient, direction in degrees [0..360], 0=Vertical gradient
 inline void GenImageGradientLinear(int width, int height, int direction, uint32_t start, uint32_t end, void *retVal)
 {
-    *(Image *)retVal = _GenImageGradientLinear(width, height, direction, start, end);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageGradientLinear)(width, height, direction, start, end);
 }
 
 // Generate image: radial gradient
 inline void GenImageGradientRadial(int width, int height, float density, uint32_t inner, uint32_t outer, void *retVal)
 {
-    *(Image *)retVal = _GenImageGradientRadial(width, height, density, inner, outer);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageGradientRadial)(width, height, density, inner, outer);
 }
 
 // Generate image: square gradient
 inline void GenImageGradientSquare(int width, int height, float density, uint32_t inner, uint32_t outer, void *retVal)
 {
-    *(Image *)retVal = _GenImageGradientSquare(width, height, density, inner, outer);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageGradientSquare)(width, height, density, inner, outer);
 }
 
 // Generate image: checked
 inline void GenImageChecked(int width, int height, int checksX, int checksY, uint32_t col1, uint32_t col2, void *retVal)
 {
-    *(Image *)retVal = _GenImageChecked(width, height, checksX, checksY, col1, col2);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageChecked)(width, height, checksX, checksY, col1, col2);
 }
 
 // Generate image: white noise
 inline void GenImageWhiteNoise(int width, int height, float factor, void *retVal)
 {
-    *(Image *)retVal = _GenImageWhiteNoise(width, height, factor);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageWhiteNoise)(width, height, factor);
 }
 
 // Generate image: perlin noise
 inline void GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale, void *retVal)
 {
-    *(Image *)retVal = _GenImagePerlinNoise(width, height, offsetX, offsetY, scale);
+    *(Image *)retVal = RAYLIB64_CALL(GenImagePerlinNoise)(width, height, offsetX, offsetY, scale);
 }
 
 // Generate image: cellular algorithm, bigger tileSize means bigger cells
 inline void GenImageCellular(int width, int height, int tileSize, void *retVal)
 {
-    *(Image *)retVal = _GenImageCellular(width, height, tileSize);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageCellular)(width, height, tileSize);
 }
 
 // Generate image: grayscale image from text data
-inline void GenImageText(int width, int height, char *text, void *retVal)
+inline void GenImageText(int width, int height, uintptr_t text, void *retVal)
 {
-    *(Image *)retVal = _GenImageText(width, height, text);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageText)(width, height, (char *)text);
 }
 
 // Create an image duplicate (useful for transformations)
 inline void ImageCopy(void *image, void *retVal)
 {
-    *(Image *)retVal = _ImageCopy(*(Image *)image);
+    *(Image *)retVal = RAYLIB64_CALL(ImageCopy)(*(Image *)image);
 }
 
 // Create an image from another image piece
 inline void ImageFromImage(void *image, void *rec, void *retVal)
 {
-    *(Image *)retVal = _ImageFromImage(*(Image *)image, *(RRectangle *)rec);
+    *(Image *)retVal = RAYLIB64_CALL(ImageFromImage)(*(Image *)image, *(RRectangle *)rec);
 }
 
 // Create an image from text (default font)
-inline void ImageText(char *text, int fontSize, uint32_t color, void *retVal)
+inline void ImageText(uintptr_t text, int fontSize, uint32_t color, void *retVal)
 {
-    *(Image *)retVal = _ImageText(text, fontSize, color);
+    *(Image *)retVal = RAYLIB64_CALL(ImageText)((char *)text, fontSize, color);
 }
 
 // Create an image from text (custom sprite font)
-inline void ImageTextEx(void *font, char *text, float fontSize, float spacing, uint32_t tint, void *retVal)
+inline void ImageTextEx(void *font, uintptr_t text, float fontSize, float spacing, uint32_t tint, void *retVal)
 {
-    *(Image *)retVal = _ImageTextEx(*(RFont *)font, text, fontSize, spacing, tint);
+    *(Image *)retVal = RAYLIB64_CALL(ImageTextEx)(*(RFont *)font, (char *)text, fontSize, spacing, tint);
 }
 
 // Convert image data to desired format
 inline void ImageFormat(void *image, int newFormat)
 {
-    _ImageFormat((Image *)image, newFormat);
+    RAYLIB64_CALL(ImageFormat)((Image *)image, newFormat);
 }
 
 // Convert image to POT (power-of-two)
 inline void ImageToPOT(void *image, uint32_t fill)
 {
-    _ImageToPOT((Image *)image, fill);
+    RAYLIB64_CALL(ImageToPOT)((Image *)image, fill);
 }
 
 // Crop an image to a defined rectangle
 inline void ImageCrop(void *image, void *crop)
 {
-    _ImageCrop((Image *)image, *(RRectangle *)crop);
+    RAYLIB64_CALL(ImageCrop)((Image *)image, *(RRectangle *)crop);
 }
 
 // Crop image depending on alpha value
 inline void ImageAlphaCrop(void *image, float threshold)
 {
-    _ImageAlphaCrop((Image *)image, threshold);
+    RAYLIB64_CALL(ImageAlphaCrop)((Image *)image, threshold);
 }
 
 // Clear alpha channel to desired color
 inline void ImageAlphaClear(void *image, uint32_t color, float threshold)
 {
-    _ImageAlphaClear((Image *)image, color, threshold);
+    RAYLIB64_CALL(ImageAlphaClear)((Image *)image, color, threshold);
 }
 
 // Apply alpha mask to image
 inline void ImageAlphaMask(void *image, void *alphaMask)
 {
-    _ImageAlphaMask((Image *)image, *(Image *)alphaMask);
+    RAYLIB64_CALL(ImageAlphaMask)((Image *)image, *(Image *)alphaMask);
 }
 
 // Premultiply alpha channel
 inline void ImageAlphaPremultiply(void *image)
 {
-    _ImageAlphaPremultiply((Image *)image);
+    RAYLIB64_CALL(ImageAlphaPremultiply)((Image *)image);
 }
 
 // Apply Gaussian blur using a box blur approximation
 inline void ImageBlurGaussian(void *image, int blurSize)
 {
-    _ImageBlurGaussian((Image *)image, blurSize);
+    RAYLIB64_CALL(ImageBlurGaussian)((Image *)image, blurSize);
 }
 
 // Resize image (Bicubic scaling algorithm)
 inline void ImageResize(void *image, int newWidth, int newHeight)
 {
-    _ImageResize((Image *)image, newWidth, newHeight);
+    RAYLIB64_CALL(ImageResize)((Image *)image, newWidth, newHeight);
 }
 
 // Resize image (Nearest-Neighbor scaling algorithm)
 inline void ImageResizeNN(void *image, int newWidth, int newHeight)
 {
-    _ImageResizeNN((Image *)image, newWidth, newHeight);
+    RAYLIB64_CALL(ImageResizeNN)((Image *)image, newWidth, newHeight);
 }
 
 // Resize canvas and fill with color
 inline void ImageResizeCanvas(void *image, int newWidth, int newHeight, int offsetX, int offsetY, uint32_t fill)
 {
-    _ImageResizeCanvas((Image *)image, newWidth, newHeight, offsetX, offsetY, fill);
+    RAYLIB64_CALL(ImageResizeCanvas)((Image *)image, newWidth, newHeight, offsetX, offsetY, fill);
 }
 
 // Compute all mipmap levels for a provided image
 inline void ImageMipmaps(void *image)
 {
-    _ImageMipmaps((Image *)image);
+    RAYLIB64_CALL(ImageMipmaps)((Image *)image);
 }
 
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 inline void ImageDither(void *image, int rBpp, int gBpp, int bBpp, int aBpp)
 {
-    _ImageDither((Image *)image, rBpp, gBpp, bBpp, aBpp);
+    RAYLIB64_CALL(ImageDither)((Image *)image, rBpp, gBpp, bBpp, aBpp);
 }
 
 // Flip image vertically
 inline void ImageFlipVertical(void *image)
 {
-    _ImageFlipVertical((Image *)image);
+    RAYLIB64_CALL(ImageFlipVertical)((Image *)image);
 }
 
 // Flip image horizontally
 inline void ImageFlipHorizontal(void *image)
 {
-    _ImageFlipHorizontal((Image *)image);
+    RAYLIB64_CALL(ImageFlipHorizontal)((Image *)image);
 }
 
 // Rotate image by input angle in degrees (-359 to 359)
 inline void ImageRotate(void *image, int degrees)
 {
-    _ImageRotate((Image *)image, degrees);
+    RAYLIB64_CALL(ImageRotate)((Image *)image, degrees);
 }
 
 // Rotate image clockwise 90deg
 inline void ImageRotateCW(void *image)
 {
-    _ImageRotateCW((Image *)image);
+    RAYLIB64_CALL(ImageRotateCW)((Image *)image);
 }
 
 // Rotate image counter-clockwise 90deg
 inline void ImageRotateCCW(void *image)
 {
-    _ImageRotateCCW((Image *)image);
+    RAYLIB64_CALL(ImageRotateCCW)((Image *)image);
 }
 
 // Modify image color: tint
 inline void ImageColorTint(void *image, uint32_t color)
 {
-    _ImageColorTint((Image *)image, color);
+    RAYLIB64_CALL(ImageColorTint)((Image *)image, color);
 }
 
 // Modify image color: invert
 inline void ImageColorInvert(void *image)
 {
-    _ImageColorInvert((Image *)image);
+    RAYLIB64_CALL(ImageColorInvert)((Image *)image);
 }
 
 // Modify image color: grayscale
 inline void ImageColorGrayscale(void *image)
 {
-    _ImageColorGrayscale((Image *)image);
+    RAYLIB64_CALL(ImageColorGrayscale)((Image *)image);
 }
 
 // Modify image color: contrast (-100 to 100)
 inline void ImageColorContrast(void *image, float contrast)
 {
-    _ImageColorContrast((Image *)image, contrast);
+    RAYLIB64_CALL(ImageColorContrast)((Image *)image, contrast);
 }
 
 // Modify image color: brightness (-255 to 255)
 inline void ImageColorBrightness(void *image, int brightness)
 {
-    _ImageColorBrightness((Image *)image, brightness);
+    RAYLIB64_CALL(ImageColorBrightness)((Image *)image, brightness);
 }
 
 // Modify image color: replace color
 inline void ImageColorReplace(void *image, uint32_t color, uint32_t replace)
 {
-    _ImageColorReplace((Image *)image, color, replace);
+    RAYLIB64_CALL(ImageColorReplace)((Image *)image, color, replace);
 }
 
 // Load color data from image as a Color array (RGBA - 32bit)
 inline void *LoadImageColors(void *image)
 {
-    return _LoadImageColors(*(Image *)image);
+    return RAYLIB64_CALL(LoadImageColors)(*(Image *)image);
 }
 
 // Load colors palette from image as a Color array (RGBA - 32bit)
 inline void *LoadImagePalette(void *image, int maxPaletteSize, void *colorCount)
 {
-    return _LoadImagePalette(*(Image *)image, maxPaletteSize, (int *)colorCount);
+    return RAYLIB64_CALL(LoadImagePalette)(*(Image *)image, maxPaletteSize, (int *)colorCount);
 }
 
 // Unload color data loaded with LoadImageColors()
 inline void UnloadImageColors(uintptr_t colors)
 {
-    _UnloadImageColors((uint32_t *)colors);
+    RAYLIB64_CALL(UnloadImageColors)((uint32_t *)colors);
 }
 
 // Unload colors palette loaded with LoadImagePalette()
 inline void UnloadImagePalette(uintptr_t colors)
 {
-    _UnloadImagePalette((uint32_t *)colors);
+    RAYLIB64_CALL(UnloadImagePalette)((uint32_t *)colors);
 }
 
 // Get image alpha border rectangle
 inline void GetImageAlphaBorder(void *image, float threshold, void *retVal)
 {
-    *(RRectangle *)retVal = _GetImageAlphaBorder(*(Image *)image, threshold);
+    *(RRectangle *)retVal = RAYLIB64_CALL(GetImageAlphaBorder)(*(Image *)image, threshold);
 }
 
 // Get image pixel color at (x, y) position
 inline uint32_t GetImageColor(void *image, int x, int y)
 {
-    return _GetImageColor(*(Image *)image, x, y);
+    return RAYLIB64_CALL(GetImageColor)(*(Image *)image, x, y);
 }
 
 // Clear image background with given color
 inline void ImageClearBackground(void *dst, uint32_t color)
 {
-    _ImageClearBackground((Image *)dst, color);
+    RAYLIB64_CALL(ImageClearBackground)((Image *)dst, color);
 }
 
 // Draw pixel within an image
 inline void ImageDrawPixel(void *dst, int posX, int posY, uint32_t color)
 {
-    _ImageDrawPixel((Image *)dst, posX, posY, color);
+    RAYLIB64_CALL(ImageDrawPixel)((Image *)dst, posX, posY, color);
 }
 
 // Draw pixel within an image (Vector version)
 inline void ImageDrawPixelV(void *dst, void *position, uint32_t color)
 {
-    _ImageDrawPixelV((Image *)dst, *(Vector2 *)position, color);
+    RAYLIB64_CALL(ImageDrawPixelV)((Image *)dst, *(Vector2 *)position, color);
 }
 
 // Draw line within an image
 inline void ImageDrawLine(void *dst, int startPosX, int startPosY, int endPosX, int endPosY, uint32_t color)
 {
-    _ImageDrawLine((Image *)dst, startPosX, startPosY, endPosX, endPosY, color);
+    RAYLIB64_CALL(ImageDrawLine)((Image *)dst, startPosX, startPosY, endPosX, endPosY, color);
 }
 
 // Draw line within an image (Vector version)
 inline void ImageDrawLineV(void *dst, void *start, void *end, uint32_t color)
 {
-    _ImageDrawLineV((Image *)dst, *(Vector2 *)start, *(Vector2 *)end, color);
+    RAYLIB64_CALL(ImageDrawLineV)((Image *)dst, *(Vector2 *)start, *(Vector2 *)end, color);
 }
 
 // Draw a filled circle within an image
 inline void ImageDrawCircle(void *dst, int centerX, int centerY, int radius, uint32_t color)
 {
-    _ImageDrawCircle((Image *)dst, centerX, centerY, radius, color);
+    RAYLIB64_CALL(ImageDrawCircle)((Image *)dst, centerX, centerY, radius, color);
 }
 
 // Draw a filled circle within an image (Vector version)
 inline void ImageDrawCircleV(void *dst, void *center, int radius, uint32_t color)
 {
-    _ImageDrawCircleV((Image *)dst, *(Vector2 *)center, radius, color);
+    RAYLIB64_CALL(ImageDrawCircleV)((Image *)dst, *(Vector2 *)center, radius, color);
 }
 
 // Draw circle outline within an image
 inline void ImageDrawCircleLines(void *dst, int centerX, int centerY, int radius, uint32_t color)
 {
-    _ImageDrawCircleLines((Image *)dst, centerX, centerY, radius, color);
+    RAYLIB64_CALL(ImageDrawCircleLines)((Image *)dst, centerX, centerY, radius, color);
 }
 
 // Draw circle outline within an image (Vector version)
 inline void ImageDrawCircleLinesV(void *dst, void *center, int radius, uint32_t color)
 {
-    _ImageDrawCircleLinesV((Image *)dst, *(Vector2 *)center, radius, color);
+    RAYLIB64_CALL(ImageDrawCircleLinesV)((Image *)dst, *(Vector2 *)center, radius, color);
 }
 
 // Draw rectangle within an image
 inline void ImageDrawRectangle(void *dst, int posX, int posY, int width, int height, uint32_t color)
 {
-    _ImageDrawRectangle((Image *)dst, posX, posY, width, height, color);
+    RAYLIB64_CALL(ImageDrawRectangle)((Image *)dst, posX, posY, width, height, color);
 }
 
 // Draw rectangle within an image (Vector version)
 inline void ImageDrawRectangleV(void *dst, void *position, void *size, uint32_t color)
 {
-    _ImageDrawRectangleV((Image *)dst, *(Vector2 *)position, *(Vector2 *)size, color);
+    RAYLIB64_CALL(ImageDrawRectangleV)((Image *)dst, *(Vector2 *)position, *(Vector2 *)size, color);
 }
 
 // Draw rectangle within an image
 inline void ImageDrawRectangleRec(void *dst, void *rec, uint32_t color)
 {
-    _ImageDrawRectangleRec((Image *)dst, *(RRectangle *)rec, color);
+    RAYLIB64_CALL(ImageDrawRectangleRec)((Image *)dst, *(RRectangle *)rec, color);
 }
 
 // Draw rectangle lines within an image
 inline void ImageDrawRectangleLines(void *dst, void *rec, int thick, uint32_t color)
 {
-    _ImageDrawRectangleLines((Image *)dst, *(RRectangle *)rec, thick, color);
+    RAYLIB64_CALL(ImageDrawRectangleLines)((Image *)dst, *(RRectangle *)rec, thick, color);
 }
 
 // Draw a source image within a destination image (tint applied to source)
 inline void ImageDraw(void *dst, void *src, void *srcRec, void *dstRec, uint32_t tint)
 {
-    _ImageDraw((Image *)dst, *(Image *)src, *(RRectangle *)srcRec, *(RRectangle *)dstRec, tint);
+    RAYLIB64_CALL(ImageDraw)((Image *)dst, *(Image *)src, *(RRectangle *)srcRec, *(RRectangle *)dstRec, tint);
 }
 
 // Draw text (using default font) within an image (destination)
-inline void ImageDrawText(void *dst, char *text, int posX, int posY, int fontSize, uint32_t color)
+inline void ImageDrawText(void *dst, uintptr_t text, int posX, int posY, int fontSize, uint32_t color)
 {
-    _ImageDrawText((Image *)dst, text, posX, posY, fontSize, color);
+    RAYLIB64_CALL(ImageDrawText)((Image *)dst, (char *)text, posX, posY, fontSize, color);
 }
 
 // Draw text (custom sprite font) within an image (destination)
-inline void ImageDrawTextEx(void *dst, void *font, char *text, void *position, float fontSize, float spacing, uint32_t tint)
+inline void ImageDrawTextEx(void *dst, void *font, uintptr_t text, void *position, float fontSize, float spacing, uint32_t tint)
 {
-    _ImageDrawTextEx((Image *)dst, *(RFont *)font, text, *(Vector2 *)position, fontSize, spacing, tint);
+    RAYLIB64_CALL(ImageDrawTextEx)((Image *)dst, *(RFont *)font, (char *)text, *(Vector2 *)position, fontSize, spacing, tint);
 }
 
 // Load texture from file into GPU memory (VRAM)
-inline void LoadTexture(char *fileName, void *retVal)
+inline void LoadTexture(uintptr_t fileName, void *retVal)
 {
-    *(Texture *)retVal = _LoadTexture(fileName);
+    *(Texture *)retVal = RAYLIB64_CALL(LoadTexture)((char *)fileName);
 }
 
 // Load texture from image data
 inline void LoadTextureFromImage(void *image, void *retVal)
 {
-    *(Texture *)retVal = _LoadTextureFromImage(*(Image *)image);
+    *(Texture *)retVal = RAYLIB64_CALL(LoadTextureFromImage)(*(Image *)image);
 }
 
 // Load cubemap from image, multiple image cubemap layouts supported
 inline void LoadTextureCubemap(void *image, int layout, void *retVal)
 {
-    *(Texture *)retVal = _LoadTextureCubemap(*(Image *)image, layout);
+    *(Texture *)retVal = RAYLIB64_CALL(LoadTextureCubemap)(*(Image *)image, layout);
 }
 
 // Load texture for rendering (framebuffer)
 inline void LoadRenderTexture(int width, int height, void *retVal)
 {
-    *(RenderTexture *)retVal = _LoadRenderTexture(width, height);
+    *(RenderTexture *)retVal = RAYLIB64_CALL(LoadRenderTexture)(width, height);
 }
 
 // Check if a texture is ready
 inline qb_bool IsTextureReady(void *texture)
 {
-    return TO_QB_BOOL(_IsTextureReady(*(Texture *)texture));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsTextureReady)(*(Texture *)texture));
 }
 
 // Unload texture from GPU memory (VRAM)
 inline void UnloadTexture(void *texture)
 {
-    _UnloadTexture(*(Texture *)texture);
+    RAYLIB64_CALL(UnloadTexture)(*(Texture *)texture);
 }
 
 // Check if a render texture is ready
 inline qb_bool IsRenderTextureReady(void *target)
 {
-    return TO_QB_BOOL(_IsRenderTextureReady(*(RenderTexture *)target));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsRenderTextureReady)(*(RenderTexture *)target));
 }
 
 // Unload render texture from GPU memory (VRAM)
 inline void UnloadRenderTexture(void *target)
 {
-    _UnloadRenderTexture(*(RenderTexture *)target);
+    RAYLIB64_CALL(UnloadRenderTexture)(*(RenderTexture *)target);
 }
 
 // Update GPU texture with new data
 inline void UpdateTexture(void *texture, uintptr_t pixels)
 {
-    _UpdateTexture(*(Texture *)texture, (void *)pixels);
+    RAYLIB64_CALL(UpdateTexture)(*(Texture *)texture, (void *)pixels);
 }
 
 // Update GPU texture rectangle with new data
 inline void UpdateTextureRec(void *texture, void *rec, uintptr_t pixels)
 {
-    _UpdateTextureRec(*(Texture *)texture, *(RRectangle *)rec, (void *)pixels);
+    RAYLIB64_CALL(UpdateTextureRec)(*(Texture *)texture, *(RRectangle *)rec, (void *)pixels);
 }
 
 // Generate GPU mipmaps for a texture
 inline void GenTextureMipmaps(void *texture)
 {
-    _GenTextureMipmaps((Texture *)texture);
+    RAYLIB64_CALL(GenTextureMipmaps)((Texture *)texture);
 }
 
 // Set texture scaling filter mode
 inline void SetTextureFilter(void *texture, int filter)
 {
-    _SetTextureFilter(*(Texture *)texture, filter);
+    RAYLIB64_CALL(SetTextureFilter)(*(Texture *)texture, filter);
 }
 
 // Set texture wrapping mode
 inline void SetTextureWrap(void *texture, int wrap)
 {
-    _SetTextureWrap(*(Texture *)texture, wrap);
+    RAYLIB64_CALL(SetTextureWrap)(*(Texture *)texture, wrap);
 }
 
-// Draw a Texture2D
-inline void DrawTexture(void *texture, int posX, int posY, uint32_t tint)
+// Deferred sprite layer: texture draws between BeginSpriteBatch() and EndSpriteBatch() are recorded, sorted by (layer, blend mode, texture) and replayed
+struct ___sprite_raylib64
 {
-    _DrawTexture(*(Texture *)texture, posX, posY, tint);
-}
+    uint64_t key; // layer (16 bits) | blend mode (8 bits) | unused (8 bits) | texture id (32 bits)
+    Texture texture;
+    RRectangle source;
+    RRectangle dest;
+    Vector2 origin;
+    float rotation;
+    uint32_t tint;
+};
 
-// Draw a Texture2D with position defined as Vector2
-inline void DrawTextureV(void *texture, void *position, uint32_t tint)
+struct ___sprite_batch_state_raylib64
 {
-    _DrawTextureV(*(Texture *)texture, *(Vector2 *)position, tint);
-}
+    bool active;
+    int32_t layer;
+    int32_t blendMode;
+    int32_t flushesSaved;
+    std::vector<___sprite_raylib64> sprites;
+    std::vector<uint32_t> order, scratch;
+};
 
-// Draw a Texture2D with extended parameters
-inline void DrawTextureEx(void *texture, void *position, float rotation, float scale, uint32_t tint)
-{
-    _DrawTextureEx(*(Texture *)texture, *(Vector2 *)position, rotation, scale, tint);
-}
+static ___sprite_batch_state_raylib64 ___sprite_batch_raylib64 = {};
 
-// Draw a part of a texture defined by a rectangle
-inline void DrawTextureRec(void *texture, void *source, void *position, uint32_t tint)
+/// @brief Records a sprite in the active batch. All texture draws end up here as DrawTexturePro() parameters
+static inline void ___record_sprite_raylib64(const Texture &texture, const RRectangle &source, const RRectangle &dest, const Vector2 &origin, float rotation, uint32_t tint)
 {
-    _DrawTextureRec(*(Texture *)texture, *(RRectangle *)source, *(Vector2 *)position, tint);
+    auto &batch = ___sprite_batch_raylib64;
+    auto key = (uint64_t(uint16_t(batch.layer + 32768)) << 48) | (uint64_t(uint8_t(batch.blendMode)) << 40) | texture.id;
+
+    batch.sprites.push_back({key, texture, source, dest, origin, rotation, tint});
 }
 
-// Draw a part of a texture defined by a rectangle with 'pro' parameters
-inline void DrawTexturePro(void *texture, void *source, void *dest, void *origin, float rotation, uint32_t tint)
+/// @brief Starts recording texture draws (DrawTexture, DrawTextureV, DrawTextureEx, DrawTextureRec, DrawTexturePro and DrawTextureBatch) instead of drawing them
+inline void BeginSpriteBatch()
 {
-    _DrawTexturePro(*(Texture *)texture, *(RRectangle *)source, *(RRectangle *)dest, *(Vector2 *)origin, rotation, tint);
+    auto &batch = ___sprite_batch_raylib64;
+
+    if (!batch.active)
+    {
+        batch.active = true;
+        batch.layer = 0;
+        batch.blendMode = ___blend_mode_raylib64; // Sprites default to the blend mode active when the batch starts
+        batch.sprites.clear();
+    }
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely
-inline void DrawTextureNPatch(void *texture, void *nPatchInfo, void *dest, void *origin, float rotation, uint32_t tint)
+/// @brief Sets the layer of the sprites recorded after this call. Lower layers are drawn first
+/// @param layer The layer (-32768 to 32767)
+inline void SetSpriteLayer(int32_t layer)
 {
-    _DrawTextureNPatch(*(Texture *)texture, *(NPatchInfo *)nPatchInfo, *(RRectangle *)dest, *(Vector2 *)origin, rotation, tint);
+    ___sprite_batch_raylib64.layer = std::min(std::max(layer, -32768), 32767);
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-inline uint32_t Fade(uint32_t color, float alpha)
+/// @brief Sets the blend mode of the sprites recorded after this call
+/// @param mode A BLEND_* value
+inline void SetSpriteBlendMode(int32_t mode)
 {
-    return _Fade(color, alpha);
+    ___sprite_batch_raylib64.blendMode = mode;
 }
 
-// Get hexadecimal value for a Color
-inline int ColorToInt(uint32_t color)
+/// @brief Sorts the recorded sprites by (layer, blend mode, texture) and draws them. Sprites with equal keys keep their submission order
+inline void EndSpriteBatch()
 {
-    return _ColorToInt(color);
+    auto &batch = ___sprite_batch_raylib64;
+
+    if (!batch.active)
+        return;
+
+    batch.active = false;
+
+    auto count = batch.sprites.size();
+    batch.order.resize(count);
+    batch.scratch.resize(count);
+
+    // Stable LSD radix sort of the sprite indices, one byte per pass. Passes where every key has the same byte are skipped
+    size_t histogram[8][256] = {};
+    for (size_t i = 0; i < count; i++)
+    {
+        batch.order[i] = uint32_t(i);
+        for (auto b = 0; b < 8; b++)
+            histogram[b][(batch.sprites[i].key >> (b * 8)) & 0xFF]++;
+    }
+
+    for (auto b = 0; b < 8; b++)
+    {
+        if (count == 0 || histogram[b][(batch.sprites[0].key >> (b * 8)) & 0xFF] == count)
+            continue;
+
+        size_t offset[256], sum = 0;
+        for (auto v = 0; v < 256; v++)
+        {
+            offset[v] = sum;
+            sum += histogram[b][v];
+        }
+
+        for (auto i : batch.order)
+            batch.scratch[offset[(batch.sprites[i].key >> (b * 8)) & 0xFF]++] = i;
+
+        batch.order.swap(batch.scratch);
+    }
+
+    // A texture or blend mode change is what makes rlgl flush its batch
+    auto flushes = [&](bool sorted)
+    {
+        int32_t changes = 0;
+        for (size_t i = 1; i < count; i++)
+        {
+            auto a = batch.sprites[sorted ? batch.order[i - 1] : i - 1].key, b = batch.sprites[sorted ? batch.order[i] : i].key;
+            changes += (a & 0x0000FF00FFFFFFFFull) != (b & 0x0000FF00FFFFFFFFull); // Blend mode and texture id, not the layer
+        }
+        return changes;
+    };
+    batch.flushesSaved = flushes(false) - flushes(true);
+
+    // Sprites switch blend modes as needed, starting from and returning to the caller's mode
+    auto callerBlendMode = ___blend_mode_raylib64;
+    auto blendMode = callerBlendMode;
+    for (auto i : batch.order)
+    {
+        auto &sprite = batch.sprites[i];
+        auto mode = int32_t(uint8_t(sprite.key >> 40));
+
+        if (mode != blendMode)
+        {
+            RAYLIB64_CALL(BeginBlendMode)(mode);
+            blendMode = mode;
+        }
+
+        RAYLIB64_CALL(DrawTexturePro)(sprite.texture, sprite.source, sprite.dest, sprite.origin, sprite.rotation, sprite.tint);
+    }
+
+    if (blendMode != callerBlendMode)
+        RAYLIB64_CALL(BeginBlendMode)(callerBlendMode);
+
+    batch.sprites.clear();
 }
 
-// Get Color normalized as float [0..1]
-inline void ColorNormalize(uint32_t color, void *retVal)
+/// @brief Returns how many rlgl batch flushes the last EndSpriteBatch() avoided by sorting
+/// @return Flushes in submission order minus flushes in sorted order
+inline int32_t GetSpriteBatchFlushesSaved()
 {
-    *(Vector4 *)retVal = _ColorNormalize(color);
+    return ___sprite_batch_raylib64.flushesSaved;
 }
 
-// Get Color from normalized values [0..1]
-inline uint32_t ColorFromNormalized(void *normalized)
+// Draw a Texture2D
+inline void DrawTexture(void *texture, int posX, int posY, uint32_t tint)
 {
-    return _ColorFromNormalized(*(Vector4 *)normalized);
+    if (___sprite_batch_raylib64.active)
+    {
+        auto tex = *(Texture *)texture;
+        ___record_sprite_raylib64(tex, {0.0f, 0.0f, float(tex.width), float(tex.height)}, {float(posX), float(posY), float(tex.width), float(tex.height)}, {0.0f, 0.0f}, 0.0f, tint);
+        return;
+    }
+
+    RAYLIB64_CALL(DrawTexture)(*(Texture *)texture, posX, posY, tint);
 }
 
-// Get HSV values for a Color, hue [0..360], saturation/value [0..1]
-inline void ColorToHSV(uint32_t color, void *retVal)
+// Draw a Texture2D with position defined as Vector2
+inline void DrawTextureV(void *texture, void *position, uint32_t tint)
 {
-    *(Vector3 *)retVal = _ColorToHSV(color);
+    if (___sprite_batch_raylib64.active)
+    {
+        auto tex = *(Texture *)texture;
+        auto pos = *(Vector2 *)position;
+        ___record_sprite_raylib64(tex, {0.0f, 0.0f, float(tex.width), float(tex.height)}, {pos.x, pos.y, float(tex.width), float(tex.height)}, {0.0f, 0.0f}, 0.0f, tint);
+        return;
+    }
+
+    RAYLIB64_CALL(DrawTextureV)(*(Texture *)texture, *(Vector2 *)position, tint);
 }
 
-// Get a Color from HSV values, hue [0..360], saturation/value [0..1]
-inline uint32_t ColorFromHSV(float hue, float saturation, float value)
+// Draw a Texture2D with extended parameters
+inline void DrawTextureEx(void *texture, void *position, float rotation, float scale, uint32_t tint)
 {
-    return _ColorFromHSV(hue, saturation, value);
+    if (___sprite_batch_raylib64.active)
+    {
+        auto tex = *(Texture *)texture;
+        auto pos = *(Vector2 *)position;
+        ___record_sprite_raylib64(tex, {0.0f, 0.0f, float(tex.width), float(tex.height)}, {pos.x, pos.y, tex.width * scale, tex.height * scale}, {0.0f, 0.0f}, rotation, tint);
+        return;
+    }
+
+    RAYLIB64_CALL(DrawTextureEx)(*(Texture *)texture, *(Vector2 *)position, rotation, scale, tint);
 }
 
-// Get color multiplied with another color
-inline uint32_t ColorTint(uint32_t color, uint32_t tint)
+// Draw a part of a texture defined by a rectangle
+inline void DrawTextureRec(void *texture, void *source, void *position, uint32_t tint)
 {
-    return _ColorTint(color, tint);
+    if (___sprite_batch_raylib64.active)
+    {
+        auto src = *(RRectangle *)source;
+        auto pos = *(Vector2 *)position;
+        ___record_sprite_raylib64(*(Texture *)texture, src, {pos.x, pos.y, fabsf(src.width), fabsf(src.height)}, {0.0f, 0.0f}, 0.0f, tint);
+        return;
+    }
+
+    RAYLIB64_CALL(DrawTextureRec)(*(Texture *)texture, *(RRectangle *)source, *(Vector2 *)position, tint);
 }
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-inline uint32_t ColorBrightness(uint32_t color, float factor)
+// Draw a part of a texture defined by a rectangle with 'pro' parameters
+inline void DrawTexturePro(void *texture, void *source, void *dest, void *origin, float rotation, uint32_t tint)
 {
-    return _ColorBrightness(color, factor);
+    if (___sprite_batch_raylib64.active)
+    {
+        ___record_sprite_raylib64(*(Texture *)texture, *(RRectangle *)source, *(RRectangle *)dest, *(Vector2 *)origin, rotation, tint);
+        return;
+    }
+
+    RAYLIB64_CALL(DrawTexturePro)(*(Texture *)texture, *(RRectangle *)source, *(RRectangle *)dest, *(Vector2 *)origin, rotation, tint);
 }
 
-// Get color with contrast correction, contrast values between -1.0f and 1.0f
-inline uint32_t ColorContrast(uint32_t color, float contrast)
+// Draws a texture (or part of it) that stretches or shrinks nicely
+inline void DrawTextureNPatch(void *texture, void *nPatchInfo, void *dest, void *origin, float rotation, uint32_t tint)
 {
-    return _ColorContrast(color, contrast);
+    RAYLIB64_CALL(DrawTextureNPatch)(*(Texture *)texture, *(NPatchInfo *)nPatchInfo, *(RRectangle *)dest, *(Vector2 *)origin, rotation, tint);
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-inline uint32_t ColorAlpha(uint32_t color, float alpha)
+/// @brief Draws count sprites of the same texture in a single call. The three pointers point into the same UDT array and advance by stride bytes per element
+/// @param texture The texture to draw
+/// @param positions Pointer to the first Vector2 position
+/// @param sources Pointer to the first RRectangle source rectangle or NULL to draw the whole texture
+/// @param tints Pointer to the first 32-bit RGBA tint or NULL for WHITE
+/// @param stride The size of each array element in bytes
+/// @param count The number of sprites to draw
+inline void DrawTextureBatch(void *texture, uintptr_t positions, uintptr_t sources, uintptr_t tints, size_t stride, int count)
 {
-    return _ColorAlpha(color, alpha);
-}
+    if (count <= 0)
+        return;
 
-// Get src alpha-blended into dst color with tint
+    auto tex = *(Texture *)texture;
+    auto fullSource = RRectangle{0.0f, 0.0f, float(tex.width), float(tex.height)};
+    auto origin = Vector2{0.0f, 0.0f};
+
+    for (size_t i = 0, o = 0; i < size_t(count); i++, o += stride)
+    {
+        auto source = sources ? *(const RRectangle *)(sources + o) : fullSource;
+        auto position = *(const Vector2 *)(positions + o);
+        auto dest = RRectangle{position.x, position.y, fabsf(source.width), fabsf(source.height)};
+
+        auto tint = tints ? *(const uint32_t *)(tints + o) : 0xFFFFFFFFu;
+
+        // Go straight to DrawTexturePro(); this is where DrawTexture() and DrawTextureRec() end up anyway
+        if (___sprite_batch_raylib64.active)
+            ___record_sprite_raylib64(tex, source, dest, origin, 0.0f, tint);
+        else
+            RAYLIB64_CALL(DrawTexturePro)(tex, source, dest, origin, 0.0f, tint);
+    }
+}
+
+/// @brief A set of atlas page textures created by LoadTextureAtlas()
+struct ___texture_atlas_raylib64
+{
+    int32_t pageCount;
+    float efficiency; // Image pixels / page pixels
+    Texture *pages;
+};
+
+/// @brief Packs count rectangles into as few maxSize x maxSize pages as possible (MaxRects, best short side fit). Larger rectangles go first
+/// @param width Rectangle widths
+/// @param height Rectangle heights
+/// @param count The number of rectangles
+/// @param maxSize The maximum page width and height
+/// @param padding Empty pixels kept around each rectangle
+/// @param out Receives the packed position of each rectangle
+/// @param page Receives the page index of each rectangle
+/// @param pageSize Receives the width and height actually used by each page
+/// @return False if a rectangle does not fit in an empty page
+static bool ___pack_atlas_raylib64(const int32_t *width, const int32_t *height, int32_t count, int32_t maxSize, int32_t padding, RRectangle *out, int32_t *page,
+                                   std::vector<std::pair<int32_t, int32_t>> &pageSize)
+{
+    struct Rect
+    {
+        int32_t x, y, w, h;
+    };
+
+    std::vector<int32_t> order(count);
+    for (int32_t i = 0; i < count; i++)
+        order[i] = i;
+
+    std::stable_sort(order.begin(), order.end(), [&](int32_t a, int32_t b)
+                     { return std::max(width[a], height[a]) != std::max(width[b], height[b]) ? std::max(width[a], height[a]) > std::max(width[b], height[b])
+                                                                                            : width[a] * height[a] > width[b] * height[b]; });
+
+    // Free rectangles of every page. The usable area starts at padding so that every image has padding on all sides
+    std::vector<std::vector<Rect>> free;
+    auto binSize = maxSize - padding;
+
+    pageSize.clear();
+
+    for (auto i : order)
+    {
+        auto w = width[i] + padding, h = height[i] + padding;
+        if (width[i] <= 0 || height[i] <= 0 || w > binSize || h > binSize)
+            return false;
+
+        // Try every open page before starting a new one
+        int32_t bestPage = -1;
+        size_t bestRect = 0;
+        for (size_t p = 0; p <= free.size() && bestPage < 0; p++)
+        {
+            if (p == free.size())
+                free.push_back({{0, 0, binSize, binSize}});
+
+            auto bestShort = INT32_MAX, bestLong = INT32_MAX;
+            for (size_t r = 0; r < free[p].size(); r++)
+            {
+                auto &f = free[p][r];
+                if (f.w < w || f.h < h)
+                    continue;
+
+                auto shortSide = std::min(f.w - w, f.h - h), longSide = std::max(f.w - w, f.h - h);
+                if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+                {
+                    bestShort = shortSide;
+                    bestLong = longSide;
+                    bestPage = int32_t(p);
+                    bestRect = r;
+                }
+            }
+        }
+
+        auto &rects = free[bestPage];
+        Rect placed = {rects[bestRect].x, rects[bestRect].y, w, h};
+
+        // Split every free rectangle that overlaps the placed one into up to four maximal rectangles
+        std::vector<Rect> split;
+        for (size_t r = 0; r < rects.size();)
+        {
+            auto f = rects[r];
+            if (placed.x >= f.x + f.w || placed.x + placed.w <= f.x || placed.y >= f.y + f.h || placed.y + placed.h <= f.y)
+            {
+                r++;
+                continue;
+            }
+
+            if (placed.x > f.x)
+                split.push_back({f.x, f.y, placed.x - f.x, f.h});
+            if (placed.x + placed.w < f.x + f.w)
+                split.push_back({placed.x + placed.w, f.y, f.x + f.w - placed.x - placed.w, f.h});
+            if (placed.y > f.y)
+                split.push_back({f.x, f.y, f.w, placed.y - f.y});
+            if (placed.y + placed.h < f.y + f.h)
+                split.push_back({f.x, placed.y + placed.h, f.w, f.y + f.h - placed.y - placed.h});
+
+            rects[r] = rects.back();
+            rects.pop_back();
+        }
+
+        // Drop new free rectangles that are contained in another one. Untouched rectangles never contain each other, so only the new ones need checking
+        auto contains = [](const Rect &a, const Rect &b)
+        { return b.x >= a.x && b.y >= a.y && b.x + b.w <= a.x + a.w && b.y + b.h <= a.y + a.h; };
+
+        auto untouched = rects.size();
+        for (size_t a = 0; a < split.size(); a++)
+        {
+            auto contained = false;
+            for (size_t b = 0; b < rects.size() && !contained; b++)
+                contained = contains(rects[b], split[a]);
+            for (size_t b = a + 1; b < split.size() && !contained; b++)
+                contained = contains(split[b], split[a]);
+
+            if (contained)
+                continue;
+
+            // A new rectangle can also swallow older ones
+            for (size_t b = 0; b < untouched;)
+            {
+                if (contains(split[a], rects[b]))
+                {
+                    rects[b] = rects[untouched - 1];
+                    rects[untouched - 1] = rects.back();
+                    rects.pop_back();
+                    untouched--;
+                }
+                else
+                    b++;
+            }
+
+            rects.push_back(split[a]);
+        }
+
+        out[i] = {float(placed.x + padding), float(placed.y + padding), float(width[i]), float(height[i])};
+        page[i] = bestPage;
+
+        if (pageSize.size() <= size_t(bestPage))
+            pageSize.resize(bestPage + 1, {0, 0});
+
+        pageSize[bestPage].first = std::max(pageSize[bestPage].first, placed.x + w + padding);
+        pageSize[bestPage].second = std::max(pageSize[bestPage].second, placed.y + h + padding);
+    }
+
+    for (auto &size : pageSize)
+    {
+        size.first = std::min(size.first, maxSize);
+        size.second = std::min(size.second, maxSize);
+    }
+
+    return true;
+}
+
+/// @brief Packs many images into one or more atlas textures. Sprites that share a page can be drawn without flushing raylib's batch
+/// @param images Pointer to the first Image of an array of count images
+/// @param count The number of images
+/// @param maxSize The maximum width and height of a page texture (e.g. 2048)
+/// @param padding Empty pixels kept around each image to avoid filtering bleed
+/// @param mipmaps Generate mipmaps for the page textures
+/// @param sources Receives an RRectangle per image: the image's source rectangle on its page (for DrawTextureRec() / DrawTexturePro())
+/// @param pages Receives a LONG per image: the page index to pass to GetTextureAtlasPage()
+/// @return An atlas handle or 0 on failure. Free it with UnloadTextureAtlas()
+inline uintptr_t LoadTextureAtlas(void *images, int32_t count, int32_t maxSize, int32_t padding, qb_bool mipmaps, void *sources, void *pages)
+{
+    auto imgs = (const Image *)images;
+    auto rects = (RRectangle *)sources;
+    auto page = (int32_t *)pages;
+
+    if (count <= 0 || maxSize <= 0 || padding < 0)
+        return 0;
+
+    std::vector<int32_t> width(count), height(count);
+    for (int32_t i = 0; i < count; i++)
+    {
+        width[i] = imgs[i].width;
+        height[i] = imgs[i].height;
+    }
+
+    // Use the smallest power of two page that holds everything when that is below maxSize, as packing into a huge page spreads the images out
+    double paddedArea = 0.0;
+    for (int32_t i = 0; i < count; i++)
+        paddedArea += double(width[i] + padding) * (height[i] + padding);
+
+    auto size = 64;
+    while (size < maxSize && double(size) * size < paddedArea)
+        size <<= 1;
+
+    std::vector<std::pair<int32_t, int32_t>> pageSize;
+    for (; size < maxSize; size <<= 1)
+    {
+        if (___pack_atlas_raylib64(width.data(), height.data(), count, size, padding, rects, page, pageSize) && pageSize.size() == 1)
+            break;
+    }
+
+    if (size >= maxSize && !___pack_atlas_raylib64(width.data(), height.data(), count, maxSize, padding, rects, page, pageSize))
+    {
+        RAYLIB_DEBUG_PRINT("Error: Images do not fit in a %i x %i atlas page", maxSize, maxSize);
+        return 0;
+    }
+
+    auto atlas = (___texture_atlas_raylib64 *)malloc(sizeof(___texture_atlas_raylib64) + pageSize.size() * sizeof(Texture));
+    if (!atlas)
+        return 0;
+
+    atlas->pageCount = int32_t(pageSize.size());
+    atlas->pages = (Texture *)(atlas + 1);
+
+    double imageArea = 0.0, pageArea = 0.0;
+
+    for (int32_t p = 0; p < atlas->pageCount; p++)
+    {
+        auto canvas = RAYLIB64_CALL(GenImageColor)(pageSize[p].first, pageSize[p].second, 0); // BLANK
+
+        for (int32_t i = 0; i < count; i++)
+        {
+            if (page[i] == p)
+            {
+                RAYLIB64_CALL(ImageDraw)(&canvas, imgs[i], {0.0f, 0.0f, float(imgs[i].width), float(imgs[i].height)}, rects[i], 0xFFFFFFFFu); // WHITE
+                imageArea += double(imgs[i].width) * imgs[i].height;
+            }
+        }
+
+        atlas->pages[p] = RAYLIB64_CALL(LoadTextureFromImage)(canvas);
+        RAYLIB64_CALL(UnloadImage)(canvas);
+
+        if (mipmaps)
+            RAYLIB64_CALL(GenTextureMipmaps)(&atlas->pages[p]);
+
+        pageArea += double(pageSize[p].first) * pageSize[p].second;
+    }
+
+    atlas->efficiency = float(imageArea / pageArea);
+
+    return (uintptr_t)atlas;
+}
+
+/// @brief Loads images from files and packs them into one or more atlas textures. See LoadTextureAtlas()
+/// @param fileNames The image file names separated by line feeds (CHR$(10))
+/// @param maxSize The maximum width and height of a page texture (e.g. 2048)
+/// @param padding Empty pixels kept around each image to avoid filtering bleed
+/// @param mipmaps Generate mipmaps for the page textures
+/// @param sources Receives an RRectangle per file
+/// @param pages Receives a LONG page index per file
+/// @return An atlas handle or 0 on failure. Free it with UnloadTextureAtlas()
+inline uintptr_t LoadTextureAtlasFromFiles(uintptr_t fileNames, int32_t maxSize, int32_t padding, qb_bool mipmaps, void *sources, void *pages)
+{
+    std::vector<Image> images;
+    auto ok = true;
+
+    for (auto name = (char *)fileNames; *name;)
+    {
+        auto end = strchr(name, '\n');
+        auto length = end ? size_t(end - name) : strlen(name);
+
+        if (length)
+        {
+            auto fileName = (char *)ToCStringScratch(name, length);
+            images.push_back(RAYLIB64_CALL(LoadImage)(fileName));
+
+            if (!images.back().data)
+            {
+                RAYLIB_DEBUG_PRINT("Error: Failed to load %s", fileName);
+                ok = false;
+                break;
+            }
+        }
+
+        name += length + (end ? 1 : 0);
+    }
+
+    auto atlas = ok && !images.empty() ? LoadTextureAtlas(images.data(), int32_t(images.size()), maxSize, padding, mipmaps, sources, pages) : 0;
+
+    for (auto &image : images)
+        RAYLIB64_CALL(UnloadImage)(image);
+
+    return atlas;
+}
+
+/// @brief Frees an atlas and its page textures
+/// @param atlas The atlas handle
+inline void UnloadTextureAtlas(uintptr_t atlas)
+{
+    auto a = (___texture_atlas_raylib64 *)atlas;
+
+    if (a)
+    {
+        for (int32_t p = 0; p < a->pageCount; p++)
+            RAYLIB64_CALL(UnloadTexture)(a->pages[p]);
+
+        free(a);
+    }
+}
+
+/// @brief Returns the number of page textures in an atlas
+/// @param atlas The atlas handle
+/// @return The number of pages
+inline int32_t GetTextureAtlasPageCount(uintptr_t atlas)
+{
+    return ((const ___texture_atlas_raylib64 *)atlas)->pageCount;
+}
+
+/// @brief Gets a page texture of an atlas. The texture is owned by the atlas
+/// @param atlas The atlas handle
+/// @param page The page index (from the pages array filled by LoadTextureAtlas())
+/// @param retVal Receives the Texture (zeroed if page is out of range)
+inline void GetTextureAtlasPage(uintptr_t atlas, int32_t page, void *retVal)
+{
+    auto a = (const ___texture_atlas_raylib64 *)atlas;
+
+    *(Texture *)retVal = (page >= 0 && page < a->pageCount) ? a->pages[page] : Texture{};
+}
+
+/// @brief Returns how well the images were packed
+/// @param atlas The atlas handle
+/// @return Image pixels divided by page pixels (0.0 - 1.0)
+inline float GetTextureAtlasEfficiency(uintptr_t atlas)
+{
+    return ((const ___texture_atlas_raylib64 *)atlas)->efficiency;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+inline uint32_t Fade(uint32_t color, float alpha)
+{
+    return RAYLIB64_CALL(Fade)(color, alpha);
+}
+
+// Get hexadecimal value for a Color
+inline int ColorToInt(uint32_t color)
+{
+    return RAYLIB64_CALL(ColorToInt)(color);
+}
+
+// Get Color normalized as float [0..1]
+inline void ColorNormalize(uint32_t color, void *retVal)
+{
+    *(Vector4 *)retVal = RAYLIB64_CALL(ColorNormalize)(color);
+}
+
+// Get Color from normalized values [0..1]
+inline uint32_t ColorFromNormalized(void *normalized)
+{
+    return RAYLIB64_CALL(ColorFromNormalized)(*(Vector4 *)normalized);
+}
+
+// Get HSV values for a Color, hue [0..360], saturation/value [0..1]
+inline void ColorToHSV(uint32_t color, void *retVal)
+{
+    *(Vector3 *)retVal = RAYLIB64_CALL(ColorToHSV)(color);
+}
+
+// Get a Color from HSV values, hue [0..360], saturation/value [0..1]
+inline uint32_t ColorFromHSV(float hue, float saturation, float value)
+{
+    return RAYLIB64_CALL(ColorFromHSV)(hue, saturation, value);
+}
+
+// Get color multiplied with another color
+inline uint32_t ColorTint(uint32_t color, uint32_t tint)
+{
+    return RAYLIB64_CALL(ColorTint)(color, tint);
+}
+
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+inline uint32_t ColorBrightness(uint32_t color, float factor)
+{
+    return RAYLIB64_CALL(ColorBrightness)(color, factor);
+}
+
+// Get color with contrast correction, contrast values between -1.0f and 1.0f
+inline uint32_t ColorContrast(uint32_t color, float contrast)
+{
+    return RAYLIB64_CALL(ColorContrast)(color, contrast);
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+inline uint32_t ColorAlpha(uint32_t color, float alpha)
+{
+    return RAYLIB64_CALL(ColorAlpha)(color, alpha);
+}
+
+// Get src alpha-blended into dst color with tint
 inline uint32_t ColorAlphaBlend(uint32_t dst, uint32_t src, uint32_t tint)
 {
-    return _ColorAlphaBlend(dst, src, tint);
+    return RAYLIB64_CALL(ColorAlphaBlend)(dst, src, tint);
 }
 
 // Get Color structure from hexadecimal value
 inline uint32_t GetColor(unsigned int hexValue)
 {
-    return _GetColor(hexValue);
+    return RAYLIB64_CALL(GetColor)(hexValue);
 }
 
 // Get Color from a source pixel pointer of certain format
 inline uint32_t GetPixelColor(uintptr_t srcPtr, int format)
 {
-    return _GetPixelColor((void *)srcPtr, format);
+    return RAYLIB64_CALL(GetPixelColor)((void *)srcPtr, format);
 }
 
 // Set color formatted into destination pixel pointer
 inline void SetPixelColor(uintptr_t dstPtr, uint32_t color, int format)
 {
-    _SetPixelColor((void *)dstPtr, color, format);
+    RAYLIB64_CALL(SetPixelColor)((void *)dstPtr, color, format);
 }
 
 // Get pixel data size in bytes for certain format
 inline int GetPixelDataSize(int width, int height, int format)
 {
-    return _GetPixelDataSize(width, height, format);
+    return RAYLIB64_CALL(GetPixelDataSize)(width, height, format);
 }
 
 // Get the default Font
 inline void GetFontDefault(void *retVal)
 {
-    *(RFont *)retVal = _GetFontDefault();
+    *(RFont *)retVal = RAYLIB64_CALL(GetFontDefault)();
 }
 
 // Load font from file into GPU memory (VRAM)
-inline void RLoadFont(char *fileName, void *retVal)
+inline void RLoadFont(uintptr_t fileName, void *retVal)
 {
-    *(RFont *)retVal = _LoadFont(fileName);
+    *(RFont *)retVal = RAYLIB64_CALL(LoadFont)((char *)fileName);
 }
 
 // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character setFont
-inline void LoadFontEx(char *fileName, int fontSize, uintptr_t codepoints, int codepointCount, void *retVal)
+inline void LoadFontEx(uintptr_t fileName, int fontSize, uintptr_t codepoints, int codepointCount, void *retVal)
 {
-    *(RFont *)retVal = _LoadFontEx(fileName, fontSize, (int *)codepoints, codepointCount);
+    *(RFont *)retVal = RAYLIB64_CALL(LoadFontEx)((char *)fileName, fontSize, (int *)codepoints, codepointCount);
 }
 
 // Load font from Image (XNA style)
 inline void LoadFontFromImage(void *image, uint32_t key, int firstChar, void *retVal)
 {
-    *(RFont *)retVal = _LoadFontFromImage(*(Image *)image, key, firstChar);
+    *(RFont *)retVal = RAYLIB64_CALL(LoadFontFromImage)(*(Image *)image, key, firstChar);
 }
 
 // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
-inline void LoadFontFromMemory(char *fileType, uintptr_t fileData, int dataSize, int fontSize, uintptr_t codepoints, int codepointCount, void *retVal)
+inline void LoadFontFromMemory(uintptr_t fileType, uintptr_t fileData, int dataSize, int fontSize, uintptr_t codepoints, int codepointCount, void *retVal)
 {
-    *(RFont *)retVal = _LoadFontFromMemory(fileType, (unsigned char *)fileData, dataSize, fontSize, (int *)codepoints, codepointCount);
+    *(RFont *)retVal = RAYLIB64_CALL(LoadFontFromMemory)((char *)fileType, (unsigned char *)fileData, dataSize, fontSize, (int *)codepoints, codepointCount);
 }
 
 // Check if a font is ready
 inline qb_bool IsFontReady(void *font)
 {
-    return TO_QB_BOOL(_IsFontReady(*(RFont *)font));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsFontReady)(*(RFont *)font));
 }
 
 // Load font data for further use
 inline void *LoadFontData(uintptr_t fileData, int dataSize, int fontSize, uintptr_t codepoints, int codepointCount, int type)
 {
-    return _LoadFontData((unsigned char *)fileData, dataSize, fontSize, (int *)codepoints, codepointCount, type);
+    return RAYLIB64_CALL(LoadFontData)((unsigned char *)fileData, dataSize, fontSize, (int *)codepoints, codepointCount, type);
 }
 
 // Generate image font atlas using chars info
 inline void GenImageFontAtlas(uintptr_t glyphs, uintptr_t *glyphRecs, int glyphCount, int fontSize, int padding, int packMethod, void *retVal)
 {
-    *(Image *)retVal = _GenImageFontAtlas((GlyphInfo *)glyphs, (RRectangle **)glyphRecs, glyphCount, fontSize, padding, packMethod);
+    *(Image *)retVal = RAYLIB64_CALL(GenImageFontAtlas)((GlyphInfo *)glyphs, (RRectangle **)glyphRecs, glyphCount, fontSize, padding, packMethod);
 }
 
 // Unload font chars info data (RAM)
 inline void UnloadFontData(uintptr_t glyphs, int glyphCount)
 {
-    _UnloadFontData((GlyphInfo *)glyphs, glyphCount);
+    RAYLIB64_CALL(UnloadFontData)((GlyphInfo *)glyphs, glyphCount);
 }
 
 // Unload font from GPU memory (VRAM)
 inline void UnloadFont(void *font)
 {
-    _UnloadFont(*(RFont *)font);
+    RAYLIB64_CALL(UnloadFont)(*(RFont *)font);
 }
 
 // Export font as code file, returns true on success
-inline qb_bool ExportFontAsCode(void *font, char *fileName)
+inline qb_bool ExportFontAsCode(void *font, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportFontAsCode(*(RFont *)font, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportFontAsCode)(*(RFont *)font, (char *)fileName));
 }
 
 // Draw current FPS
 inline void DrawFPS(int posX, int posY)
 {
-    _DrawFPS(posX, posY);
+    RAYLIB64_CALL(DrawFPS)(posX, posY);
 }
 
 // Draw text (using default font)
-inline void DrawText(char *text, int posX, int posY, int fontSize, uint32_t color)
+inline void DrawText(uintptr_t text, int posX, int posY, int fontSize, uint32_t color)
 {
-    _DrawText(text, posX, posY, fontSize, color);
+    RAYLIB64_CALL(DrawText)((char *)text, posX, posY, fontSize, color);
 }
 
 // Draw text using font and additional parameters
-inline void DrawTextEx(void *font, char *text, void *position, float fontSize, float spacing, uint32_t tint)
+inline void DrawTextEx(void *font, uintptr_t text, void *position, float fontSize, float spacing, uint32_t tint)
 {
-    _DrawTextEx(*(RFont *)font, text, *(Vector2 *)position, fontSize, spacing, tint);
+    RAYLIB64_CALL(DrawTextEx)(*(RFont *)font, (char *)text, *(Vector2 *)position, fontSize, spacing, tint);
 }
 
 // Draw text using Font and pro parameters (rotation)
-inline void DrawTextPro(void *font, char *text, void *position, void *origin, float rotation, float fontSize, float spacing, uint32_t tint)
+inline void DrawTextPro(void *font, uintptr_t text, void *position, void *origin, float rotation, float fontSize, float spacing, uint32_t tint)
 {
-    _DrawTextPro(*(RFont *)font, text, *(Vector2 *)position, *(Vector2 *)origin, rotation, fontSize, spacing, tint);
+    RAYLIB64_CALL(DrawTextPro)(*(RFont *)font, (char *)text, *(Vector2 *)position, *(Vector2 *)origin, rotation, fontSize, spacing, tint);
 }
 
 // Draw one character (codepoint)
 inline void DrawTextCodepoint(void *font, int codepoint, void *position, float fontSize, uint32_t tint)
 {
-    _DrawTextCodepoint(*(RFont *)font, codepoint, *(Vector2 *)position, fontSize, tint);
+    RAYLIB64_CALL(DrawTextCodepoint)(*(RFont *)font, codepoint, *(Vector2 *)position, fontSize, tint);
 }
 
 // Draw multiple character (codepoint)
 inline void DrawTextCodepoints(void *font, void *codepoints, int codepointCount, void *position, float fontSize, float spacing, uint32_t tint)
 {
-    _DrawTextCodepoints(*(RFont *)font, (int *)codepoints, codepointCount, *(Vector2 *)position, fontSize, spacing, tint);
+    RAYLIB64_CALL(DrawTextCodepoints)(*(RFont *)font, (int *)codepoints, codepointCount, *(Vector2 *)position, fontSize, spacing, tint);
 }
 
 // Set vertical line spacing when drawing with line-breaks
 inline void SetTextLineSpacing(int spacing)
 {
-    _SetTextLineSpacing(spacing);
+    RAYLIB64_CALL(SetTextLineSpacing)(spacing);
 }
 
 // Measure string width for default font
-inline int MeasureText(char *text, int fontSize)
+inline int MeasureText(uintptr_t text, int fontSize)
 {
-    return _MeasureText(text, fontSize);
+    return RAYLIB64_CALL(MeasureText)((char *)text, fontSize);
 }
 
 // Measure string size for Font
-inline void MeasureTextEx(void *font, char *text, float fontSize, float spacing, void *retVal)
+inline void MeasureTextEx(void *font, uintptr_t text, float fontSize, float spacing, void *retVal)
 {
-    *(Vector2 *)retVal = _MeasureTextEx(*(RFont *)font, text, fontSize, spacing);
+    *(Vector2 *)retVal = RAYLIB64_CALL(MeasureTextEx)(*(RFont *)font, (char *)text, fontSize, spacing);
 }
 
 // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 inline int GetGlyphIndex(void *font, int codepoint)
 {
-    return _GetGlyphIndex(*(RFont *)font, codepoint);
+    return RAYLIB64_CALL(GetGlyphIndex)(*(RFont *)font, codepoint);
 }
 
 // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 inline void GetGlyphInfo(void *font, int codepoint, void *retVal)
 {
-    *(GlyphInfo *)retVal = _GetGlyphInfo(*(RFont *)font, codepoint);
+    *(GlyphInfo *)retVal = RAYLIB64_CALL(GetGlyphInfo)(*(RFont *)font, codepoint);
 }
 
 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
 inline void GetGlyphAtlasRec(void *font, int codepoint, void *retVal)
 {
-    *(RRectangle *)retVal = _GetGlyphAtlasRec(*(RFont *)font, codepoint);
+    *(RRectangle *)retVal = RAYLIB64_CALL(GetGlyphAtlasRec)(*(RFont *)font, codepoint);
 }
 
 // Load UTF-8 text encoded from codepoints array
 inline char *LoadUTF8(void *codepoints, int length)
 {
-    return _LoadUTF8((int *)codepoints, length);
+    return RAYLIB64_CALL(LoadUTF8)((int *)codepoints, length);
 }
 
 // Unload UTF-8 text encoded from codepoints array
-inline void UnloadUTF8(char *text)
+inline void UnloadUTF8(uintptr_t text)
 {
-    _UnloadUTF8(text);
+    RAYLIB64_CALL(UnloadUTF8)((char *)text);
 }
 
 // Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-inline void *LoadCodepoints(char *text, void *count)
+inline void *LoadCodepoints(uintptr_t text, void *count)
 {
-    return _LoadCodepoints(text, (int *)count);
+    return RAYLIB64_CALL(LoadCodepoints)((char *)text, (int *)count);
 }
 
 // Unload codepoints data from memory
 inline void UnloadCodepoints(void *codepoints)
 {
-    _UnloadCodepoints((int *)codepoints);
+    RAYLIB64_CALL(UnloadCodepoints)((int *)codepoints);
 }
 
 // Get total number of codepoints in a UTF-8 encoded string
-inline int GetCodepointCount(char *text)
+inline int GetCodepointCount(uintptr_t text)
 {
-    return _GetCodepointCount(text);
+    return RAYLIB64_CALL(GetCodepointCount)((char *)text);
 }
 
 // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-inline int GetCodepoint(char *text, void *codepointSize)
+inline int GetCodepoint(uintptr_t text, void *codepointSize)
 {
-    return _GetCodepoint(text, (int *)codepointSize);
+    return RAYLIB64_CALL(GetCodepoint)((char *)text, (int *)codepointSize);
 }
 
 // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-inline int GetCodepointNext(char *text, void *codepointSize)
+inline int GetCodepointNext(uintptr_t text, void *codepointSize)
 {
-    return _GetCodepointNext(text, (int *)codepointSize);
+    return RAYLIB64_CALL(GetCodepointNext)((char *)text, (int *)codepointSize);
 }
 
 // Get previous codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-inline int GetCodepointPrevious(char *text, void *codepointSize)
+inline int GetCodepointPrevious(uintptr_t text, void *codepointSize)
 {
-    return _GetCodepointPrevious(text, (int *)codepointSize);
+    return RAYLIB64_CALL(GetCodepointPrevious)((char *)text, (int *)codepointSize);
 }
 
 // Encode one codepoint into UTF-8 byte array (array length returned as parameter)
 inline const char *CodepointToUTF8(int codepoint, void *utf8Size)
 {
-    return _CodepointToUTF8(codepoint, (int *)utf8Size);
+    return RAYLIB64_CALL(CodepointToUTF8)(codepoint, (int *)utf8Size);
 }
 
 // TextCopy() ignored
 
 // Check if two text string are equal
-inline qb_bool TextIsEqual(char *text1, char *text2)
+inline qb_bool TextIsEqual(uintptr_t text1, uintptr_t text2)
 {
-    return TO_QB_BOOL(_TextIsEqual(text1, text2));
+    return TO_QB_BOOL(RAYLIB64_CALL(TextIsEqual)((char *)text1, (char *)text2));
 }
 
 // Get text length, checks for '\0' ending
-inline unsigned int TextLength(char *text)
+inline unsigned int TextLength(uintptr_t text)
 {
-    return _TextLength(text);
+    return RAYLIB64_CALL(TextLength)((char *)text);
 }
 
 // Text formatting with variables (sprintf() style)
-inline char *TextFormat(char *text, char *s)
+inline char *TextFormat(uintptr_t text, uintptr_t s)
 {
-    return _TextFormat(text, s);
+    return RAYLIB64_CALL(TextFormat)((char *)text, (char *)s);
 }
 
 // Text formatting with variables (sprintf() style)
-inline char *TextFormat(char *text, int32_t i)
+inline char *TextFormat(uintptr_t text, int32_t i)
 {
-    return _TextFormat(text, i);
+    return RAYLIB64_CALL(TextFormat)((char *)text, i);
 }
 
 // Text formatting with variables (sprintf() style)
-inline char *TextFormat(char *text, int64_t i)
+inline char *TextFormat(uintptr_t text, int64_t i)
 {
-    return _TextFormat(text, i);
+    return RAYLIB64_CALL(TextFormat)((char *)text, i);
 }
 
 // Text formatting with variables (sprintf() style)
-inline char *TextFormat(char *text, float f)
+inline char *TextFormat(uintptr_t text, float f)
 {
-    return _TextFormat(text, f);
+    return RAYLIB64_CALL(TextFormat)((char *)text, f);
 }
 
 // Text formatting with variables (sprintf() style)
-inline char *TextFormat(char *text, double d)
+inline char *TextFormat(uintptr_t text, double d)
+{
+    return RAYLIB64_CALL(TextFormat)((char *)text, d);
+}
+
+/// @brief Formats several values (printf() style) into a caller-owned buffer. Unlike TextFormat() this does not use raylib's static buffer
+/// @param buffer The output buffer. The result is always NUL-terminated and truncated if needed
+/// @param bufferSize The size of the output buffer in bytes
+/// @param text The format string. Length modifiers (h, l, ll etc.) are optional and ignored
+/// @param args A packed array of 8-byte slots, one per conversion (and per '*' width or precision). Integers and characters are _INTEGER64, floating point values are DOUBLE and strings are C string pointers (_OFFSET)
+/// @param argCount The number of slots in args
+/// @return The length of the fully formatted text (which may be larger than what fit in buffer) or -1 if the format string is invalid
+inline int32_t TextFormatBuffer(char *buffer, int32_t bufferSize, uintptr_t text, uintptr_t args, int32_t argCount)
 {
-    return _TextFormat(text, d);
+    auto format = (const char *)text;
+    auto slot = reinterpret_cast<const int64_t *>(args);
+    auto written = size_t(0), size = bufferSize > 0 ? size_t(bufferSize) : size_t(0);
+
+    // Appends up to n bytes to the buffer while keeping track of the full length
+    auto append = [&](const char *s, size_t n)
+    {
+        if (written + 1 < size)
+            memcpy(buffer + written, s, std::min(n, size - written - 1));
+
+        written += n;
+    };
+
+    // Formats one conversion straight into the rest of the buffer. snprintf() still returns the full length when it does not fit
+    auto print = [&](const char *spec, auto value)
+    {
+        auto room = written < size ? size - written : size_t(0);
+        auto n = snprintf(room ? buffer + written : nullptr, room, spec, value);
+
+        if (n > 0)
+            written += size_t(n);
+
+        return n;
+    };
+
+    auto nextSlot = [&](int64_t &value)
+    {
+        if (argCount <= 0)
+            return false;
+
+        value = *slot++;
+        argCount--;
+
+        return true;
+    };
+
+    while (*format)
+    {
+        auto percent = strchr(format, '%');
+        if (!percent)
+        {
+            append(format, strlen(format));
+            break;
+        }
+
+        append(format, percent - format);
+        format = percent + 1;
+
+        if (*format == '%')
+        {
+            append("%", 1);
+            format++;
+            continue;
+        }
+
+        // Rebuild the conversion specification: flags, width and precision are kept, '*' is replaced by the value from the next slot
+        char spec[64] = "%";
+        auto length = size_t(1);
+        int64_t value;
+
+        while (*format && strchr("-+ #0123456789.*", *format) && length < sizeof(spec) - 24)
+        {
+            if (*format == '*')
+            {
+                if (!nextSlot(value))
+                    return -1;
+
+                length += snprintf(spec + length, sizeof(spec) - length, "%d", int32_t(value));
+            }
+            else
+                spec[length++] = *format;
+
+            format++;
+        }
+
+        while (*format && strchr("hljztLq", *format))
+            format++;
+
+        auto conversion = *format++;
+        if (!conversion || !nextSlot(value))
+            return -1;
+
+        auto n = 0;
+
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            spec[length++] = 'l';
+            spec[length++] = 'l';
+            spec[length++] = conversion;
+            spec[length] = '\0';
+            n = print(spec, (long long)value);
+            break;
+
+        case 'c':
+            spec[length++] = 'c';
+            spec[length] = '\0';
+            n = print(spec, int(value));
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double d;
+            memcpy(&d, &value, sizeof(d));
+            spec[length++] = conversion;
+            spec[length] = '\0';
+            n = print(spec, d);
+            break;
+        }
+
+        case 's':
+        {
+            auto s = value ? reinterpret_cast<const char *>(value) : "(null)";
+            spec[length++] = 's';
+            spec[length] = '\0';
+
+            // Plain %s is copied directly
+            if (length == 2)
+            {
+                append(s, strlen(s));
+                continue;
+            }
+
+            n = print(spec, s);
+            break;
+        }
+
+        case 'p':
+            spec[length++] = 'p';
+            spec[length] = '\0';
+            n = print(spec, reinterpret_cast<void *>(value));
+            break;
+
+        default: // %n and unknown conversions
+            return -1;
+        }
+
+        if (n < 0)
+            return -1;
+    }
+
+    if (size)
+        buffer[std::min(written, size - 1)] = '\0';
+
+    return int32_t(written);
 }
 
 // TextSubtext() ignored
@@ -5030,859 +7189,2215 @@ inline char *TextFormat(char *text, double d)
 // TextAppend() ignored
 
 // Find first text occurrence within a string
-inline int TextFindIndex(char *text, char *find)
+inline int TextFindIndex(uintptr_t text, uintptr_t find)
 {
-    return _TextFindIndex(text, find);
+    return RAYLIB64_CALL(TextFindIndex)((char *)text, (char *)find);
 }
 
 // Get upper case version of provided string
-inline const char *TextToUpper(char *text)
+inline const char *TextToUpper(uintptr_t text)
 {
-    return _TextToUpper(text);
+    return RAYLIB64_CALL(TextToUpper)((char *)text);
 }
 
 // Get lower case version of provided string
-inline const char *TextToLower(char *text)
+inline const char *TextToLower(uintptr_t text)
 {
-    return _TextToLower(text);
+    return RAYLIB64_CALL(TextToLower)((char *)text);
 }
 
 // Get Pascal case notation version of provided string
-inline const char *TextToPascal(char *text)
+inline const char *TextToPascal(uintptr_t text)
 {
-    return _TextToPascal(text);
+    return RAYLIB64_CALL(TextToPascal)((char *)text);
 }
 
 // Get integer value from text (negative values not supported)
-inline int TextToInteger(char *text)
+inline int TextToInteger(uintptr_t text)
 {
-    return _TextToInteger(text);
+    return RAYLIB64_CALL(TextToInteger)((char *)text);
 }
 
 // Draw a line in 3D world space
 inline void DrawLine3D(void *startPos, void *endPos, uint32_t color)
 {
-    _DrawLine3D(*(Vector3 *)startPos, *(Vector3 *)endPos, color);
+    RAYLIB64_CALL(DrawLine3D)(*(Vector3 *)startPos, *(Vector3 *)endPos, color);
 }
 
 // Draw a point in 3D space, actually a small line
 inline void DrawPoint3D(void *position, uint32_t color)
 {
-    _DrawPoint3D(*(Vector3 *)position, color);
+    RAYLIB64_CALL(DrawPoint3D)(*(Vector3 *)position, color);
 }
 
 // Draw a circle in 3D world space
 inline void DrawCircle3D(void *center, float radius, void *rotationAxis, float rotationAngle, uint32_t color)
 {
-    _DrawCircle3D(*(Vector3 *)center, radius, *(Vector3 *)rotationAxis, rotationAngle, color);
+    RAYLIB64_CALL(DrawCircle3D)(*(Vector3 *)center, radius, *(Vector3 *)rotationAxis, rotationAngle, color);
 }
 
 // Draw a color-filled triangle (vertex in counter-clockwise order!)
 inline void DrawTriangle3D(void *v1, void *v2, void *v3, uint32_t color)
 {
-    _DrawTriangle3D(*(Vector3 *)v1, *(Vector3 *)v2, *(Vector3 *)v3, color);
+    RAYLIB64_CALL(DrawTriangle3D)(*(Vector3 *)v1, *(Vector3 *)v2, *(Vector3 *)v3, color);
 }
 
 // Draw a triangle strip defined by points
 inline void DrawTriangleStrip3D(void *points, int pointCount, uint32_t color)
 {
-    _DrawTriangleStrip3D((Vector3 *)points, pointCount, color);
+    RAYLIB64_CALL(DrawTriangleStrip3D)((Vector3 *)points, pointCount, color);
 }
 
 // Draw cube
 inline void DrawCube(void *position, float width, float height, float length, uint32_t color)
 {
-    _DrawCube(*(Vector3 *)position, width, height, length, color);
+    RAYLIB64_CALL(DrawCube)(*(Vector3 *)position, width, height, length, color);
 }
 
 // Draw cube (Vector version)
 inline void DrawCubeV(void *position, void *size, uint32_t color)
 {
-    _DrawCubeV(*(Vector3 *)position, *(Vector3 *)size, color);
+    RAYLIB64_CALL(DrawCubeV)(*(Vector3 *)position, *(Vector3 *)size, color);
 }
 
 // Draw cube wires
 inline void DrawCubeWires(void *position, float width, float height, float length, uint32_t color)
 {
-    _DrawCubeWires(*(Vector3 *)position, width, height, length, color);
+    RAYLIB64_CALL(DrawCubeWires)(*(Vector3 *)position, width, height, length, color);
 }
 
 // Draw cube wires (Vector version)
 inline void DrawCubeWiresV(void *position, void *size, uint32_t color)
 {
-    _DrawCubeWiresV(*(Vector3 *)position, *(Vector3 *)size, color);
+    RAYLIB64_CALL(DrawCubeWiresV)(*(Vector3 *)position, *(Vector3 *)size, color);
 }
 
 // Draw sphere
 inline void DrawSphere(void *centerPos, float radius, uint32_t color)
 {
-    _DrawSphere(*(Vector3 *)centerPos, radius, color);
+    RAYLIB64_CALL(DrawSphere)(*(Vector3 *)centerPos, radius, color);
 }
 
 // Draw sphere with extended parameters
 inline void DrawSphereEx(void *centerPos, float radius, int rings, int slices, uint32_t color)
 {
-    _DrawSphereEx(*(Vector3 *)centerPos, radius, rings, slices, color);
+    RAYLIB64_CALL(DrawSphereEx)(*(Vector3 *)centerPos, radius, rings, slices, color);
 }
 
 // Draw sphere wires
 inline void DrawSphereWires(void *centerPos, float radius, int rings, int slices, uint32_t color)
 {
-    _DrawSphereWires(*(Vector3 *)centerPos, radius, rings, slices, color);
+    RAYLIB64_CALL(DrawSphereWires)(*(Vector3 *)centerPos, radius, rings, slices, color);
 }
 
 // Draw a cylinder/cone
 inline void DrawCylinder(void *position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color)
 {
-    _DrawCylinder(*(Vector3 *)position, radiusTop, radiusBottom, height, slices, color);
+    RAYLIB64_CALL(DrawCylinder)(*(Vector3 *)position, radiusTop, radiusBottom, height, slices, color);
 }
 
 // Draw a cylinder with base at startPos and top at endPos
 inline void DrawCylinderEx(void *startPos, void *endPos, float startRadius, float endRadius, int sides, uint32_t color)
 {
-    _DrawCylinderEx(*(Vector3 *)startPos, *(Vector3 *)endPos, startRadius, endRadius, sides, color);
+    RAYLIB64_CALL(DrawCylinderEx)(*(Vector3 *)startPos, *(Vector3 *)endPos, startRadius, endRadius, sides, color);
 }
 
 // Draw a cylinder/cone wires
 inline void DrawCylinderWires(void *position, float radiusTop, float radiusBottom, float height, int slices, uint32_t color)
 {
-    _DrawCylinderWires(*(Vector3 *)position, radiusTop, radiusBottom, height, slices, color);
+    RAYLIB64_CALL(DrawCylinderWires)(*(Vector3 *)position, radiusTop, radiusBottom, height, slices, color);
 }
 
 // Draw a cylinder wires with base at startPos and top at endPos
 inline void DrawCylinderWiresEx(void *startPos, void *endPos, float startRadius, float endRadius, int sides, uint32_t color)
 {
-    _DrawCylinderWiresEx(*(Vector3 *)startPos, *(Vector3 *)endPos, startRadius, endRadius, sides, color);
+    RAYLIB64_CALL(DrawCylinderWiresEx)(*(Vector3 *)startPos, *(Vector3 *)endPos, startRadius, endRadius, sides, color);
 }
 
 // Draw a capsule with the center of its sphere caps at startPos and endPos
 inline void DrawCapsule(void *startPos, void *endPos, float radius, int slices, int rings, uint32_t color)
 {
-    _DrawCapsule(*(Vector3 *)startPos, *(Vector3 *)endPos, radius, slices, rings, color);
+    RAYLIB64_CALL(DrawCapsule)(*(Vector3 *)startPos, *(Vector3 *)endPos, radius, slices, rings, color);
 }
 
 // Draw capsule wireframe with the center of its sphere caps at startPos and endPos
 inline void DrawCapsuleWires(void *startPos, void *endPos, float radius, int slices, int rings, uint32_t color)
 {
-    _DrawCapsuleWires(*(Vector3 *)startPos, *(Vector3 *)endPos, radius, slices, rings, color);
+    RAYLIB64_CALL(DrawCapsuleWires)(*(Vector3 *)startPos, *(Vector3 *)endPos, radius, slices, rings, color);
 }
 
 // Draw a plane XZ
 inline void DrawPlane(void *centerPos, void *size, uint32_t color)
 {
-    _DrawPlane(*(Vector3 *)centerPos, *(Vector2 *)size, color);
+    RAYLIB64_CALL(DrawPlane)(*(Vector3 *)centerPos, *(Vector2 *)size, color);
 }
 
 // Draw a ray line
 inline void DrawRay(void *ray, uint32_t color)
 {
-    _DrawRay(*(Ray *)ray, color);
+    RAYLIB64_CALL(DrawRay)(*(Ray *)ray, color);
 }
 
 // Draw a grid (centered at (0, 0, 0))
 inline void DrawGrid(int slices, float spacing)
 {
-    _DrawGrid(slices, spacing);
+    RAYLIB64_CALL(DrawGrid)(slices, spacing);
 }
 
 // Load model from files (meshes and materials)
-inline void LoadModel(char *fileName, void *retVal)
+inline void LoadModel(uintptr_t fileName, void *retVal)
 {
-    *(Model *)retVal = _LoadModel(fileName);
+    *(Model *)retVal = RAYLIB64_CALL(LoadModel)((char *)fileName);
 }
 
 // Load model from generated mesh (default material)
 inline void LoadModelFromMesh(void *mesh, void *retVal)
 {
-    *(Model *)retVal = _LoadModelFromMesh(*(Mesh *)mesh);
+    *(Model *)retVal = RAYLIB64_CALL(LoadModelFromMesh)(*(Mesh *)mesh);
 }
 
 // Check if a model is ready
 inline qb_bool IsModelReady(void *model)
 {
-    return TO_QB_BOOL(_IsModelReady(*(Model *)model));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsModelReady)(*(Model *)model));
+}
+
+struct ___animation_cache_raylib64;
+
+/// @brief The cache and frame each animated mesh was last skinned with, keyed by the mesh's animVertices buffer
+inline std::vector<std::pair<const float *, std::pair<const ___animation_cache_raylib64 *, int32_t>>> &___skinned_meshes_raylib64()
+{
+    static std::vector<std::pair<const float *, std::pair<const ___animation_cache_raylib64 *, int32_t>>> meshes;
+    return meshes;
+}
+
+/// @brief Drops a mesh from the skinned mesh registry, so a later mesh that reuses its animVertices address is not mistaken for it
+inline void ___forget_skinned_mesh_raylib64(const Mesh &mesh)
+{
+    auto &meshes = ___skinned_meshes_raylib64();
+    if (mesh.animVertices && !meshes.empty())
+        meshes.erase(std::remove_if(meshes.begin(), meshes.end(), [&](const auto &e) { return e.first == mesh.animVertices; }), meshes.end());
 }
 
 // Unload model (including meshes) from memory (RAM and/or VRAM)
 inline void UnloadModel(void *model)
 {
-    _UnloadModel(*(Model *)model);
+    auto mdl = (const Model *)model;
+    for (auto m = 0; m < mdl->meshCount; m++)
+        ___forget_skinned_mesh_raylib64(mdl->meshes[m]);
+
+    RAYLIB64_CALL(UnloadModel)(*mdl);
 }
 
 // Compute model bounding box limits (considers all meshes)
 inline void GetModelBoundingBox(void *model, void *retVal)
 {
-    *(BoundingBox *)retVal = _GetModelBoundingBox(*(Model *)model);
+    *(BoundingBox *)retVal = RAYLIB64_CALL(GetModelBoundingBox)(*(Model *)model);
 }
 
 // Draw a model (with texture if set)
 inline void DrawModel(void *model, void *position, float scale, uint32_t tint)
 {
-    _DrawModel(*(Model *)model, *(Vector3 *)position, scale, tint);
+    RAYLIB64_CALL(DrawModel)(*(Model *)model, *(Vector3 *)position, scale, tint);
 }
 
 // Draw a model with extended parameters
 inline void DrawModelEx(void *model, void *position, void *rotationAxis, float rotationAngle, void *scale, uint32_t tint)
 {
-    _DrawModelEx(*(Model *)model, *(Vector3 *)position, *(Vector3 *)rotationAxis, rotationAngle, *(Vector3 *)scale, tint);
+    RAYLIB64_CALL(DrawModelEx)(*(Model *)model, *(Vector3 *)position, *(Vector3 *)rotationAxis, rotationAngle, *(Vector3 *)scale, tint);
 }
 
 // Draw a model wires (with texture if set)
 inline void DrawModelWires(void *model, void *position, float scale, uint32_t tint)
 {
-    _DrawModelWires(*(Model *)model, *(Vector3 *)position, scale, tint);
+    RAYLIB64_CALL(DrawModelWires)(*(Model *)model, *(Vector3 *)position, scale, tint);
 }
 
 // Draw a model wires (with texture if set) with extended parameters
 inline void DrawModelWiresEx(void *model, void *position, void *rotationAxis, float rotationAngle, void *scale, uint32_t tint)
 {
-    _DrawModelWiresEx(*(Model *)model, *(Vector3 *)position, *(Vector3 *)rotationAxis, rotationAngle, *(Vector3 *)scale, tint);
+    RAYLIB64_CALL(DrawModelWiresEx)(*(Model *)model, *(Vector3 *)position, *(Vector3 *)rotationAxis, rotationAngle, *(Vector3 *)scale, tint);
 }
 
 // Draw bounding box (wires)
 inline void DrawBoundingBox(void *box, uint32_t color)
 {
-    _DrawBoundingBox(*(BoundingBox *)box, color);
+    RAYLIB64_CALL(DrawBoundingBox)(*(BoundingBox *)box, color);
 }
 
 // Draw a billboard texture
 inline void DrawBillboard(void *camera, void *texture, void *position, float size, uint32_t tint)
 {
-    _DrawBillboard(*(Camera3D *)camera, *(Texture *)texture, *(Vector3 *)position, size, tint);
+    RAYLIB64_CALL(DrawBillboard)(*(Camera3D *)camera, *(Texture *)texture, *(Vector3 *)position, size, tint);
 }
 
 // Draw a billboard texture defined by source
 inline void DrawBillboardRec(void *camera, void *texture, void *source, void *position, void *size, uint32_t tint)
 {
-    _DrawBillboardRec(*(Camera3D *)camera, *(Texture *)texture, *(RRectangle *)source, *(Vector3 *)position, *(Vector2 *)size, tint);
+    RAYLIB64_CALL(DrawBillboardRec)(*(Camera3D *)camera, *(Texture *)texture, *(RRectangle *)source, *(Vector3 *)position, *(Vector2 *)size, tint);
 }
 
 // Draw a billboard texture defined by source and rotation
 inline void DrawBillboardPro(void *camera, void *texture, void *source, void *position, void *up, void *size, void *origin, float rotation, uint32_t tint)
 {
-    _DrawBillboardPro(*(Camera3D *)camera, *(Texture *)texture, *(RRectangle *)source, *(Vector3 *)position, *(Vector3 *)up, *(Vector2 *)size, *(Vector2 *)origin, rotation, tint);
+    RAYLIB64_CALL(DrawBillboardPro)(*(Camera3D *)camera, *(Texture *)texture, *(RRectangle *)source, *(Vector3 *)position, *(Vector3 *)up, *(Vector2 *)size, *(Vector2 *)origin, rotation, tint);
 }
 
 // Upload mesh vertex data in GPU and provide VAO/VBO ids
 inline void UploadMesh(void *mesh, bool dynamic)
 {
-    _UploadMesh((Mesh *)mesh, dynamic);
+    RAYLIB64_CALL(UploadMesh)((Mesh *)mesh, dynamic);
 }
 
 // Update mesh vertex data in GPU for a specific buffer index
 inline void UpdateMeshBuffer(void *mesh, int index, uintptr_t data, int dataSize, int offset)
 {
-    _UpdateMeshBuffer(*(Mesh *)mesh, index, (void *)data, dataSize, offset);
+    RAYLIB64_CALL(UpdateMeshBuffer)(*(Mesh *)mesh, index, (void *)data, dataSize, offset);
 }
 
 // Unload mesh data from CPU and GPU
 inline void UnloadMesh(void *mesh)
 {
-    _UnloadMesh(*(Mesh *)mesh);
+    ___forget_skinned_mesh_raylib64(*(const Mesh *)mesh);
+    RAYLIB64_CALL(UnloadMesh)(*(Mesh *)mesh);
 }
 
 // Draw a 3d mesh with material and transform
 inline void DrawMesh(void *mesh, void *material, void *transform)
 {
-    _DrawMesh(*(Mesh *)mesh, *(Material *)material, *(Matrix *)transform);
+    RAYLIB64_CALL(DrawMesh)(*(Mesh *)mesh, *(Material *)material, *(Matrix *)transform);
 }
 
 // Draw multiple mesh instances with material and different transforms
 inline void DrawMeshInstanced(void *mesh, void *material, void *transforms, int instances)
 {
-    _DrawMeshInstanced(*(Mesh *)mesh, *(Material *)material, (Matrix *)transforms, instances);
+    RAYLIB64_CALL(DrawMeshInstanced)(*(Mesh *)mesh, *(Material *)material, (Matrix *)transforms, instances);
+}
+
+// raylib 5.0 enum values used by DrawInstanceBuffer(). The C enums themselves are only declared for QB64 in raylib.bi
+#define RAYLIB64_SHADER_LOC_VERTEX_COLOR      5
+#define RAYLIB64_SHADER_LOC_MATRIX_MVP        6
+#define RAYLIB64_SHADER_LOC_MATRIX_VIEW       7
+#define RAYLIB64_SHADER_LOC_MATRIX_PROJECTION 8
+#define RAYLIB64_SHADER_LOC_MATRIX_MODEL      9
+#define RAYLIB64_SHADER_LOC_MATRIX_NORMAL     10
+#define RAYLIB64_SHADER_LOC_COLOR_DIFFUSE     12
+#define RAYLIB64_SHADER_LOC_COLOR_SPECULAR    13
+#define RAYLIB64_SHADER_LOC_MAP_DIFFUSE       15
+#define RAYLIB64_MATERIAL_MAP_DIFFUSE         0
+#define RAYLIB64_MATERIAL_MAP_SPECULAR        1
+#define RAYLIB64_MATERIAL_MAP_CUBEMAP         7
+#define RAYLIB64_MATERIAL_MAP_IRRADIANCE      8
+#define RAYLIB64_MATERIAL_MAP_PREFILTER       9
+#define RAYLIB64_MAX_MATERIAL_MAPS            12
+#define RAYLIB64_SHADER_UNIFORM_VEC4          3
+#define RAYLIB64_SHADER_UNIFORM_INT           4
+#define RAYLIB64_RL_FLOAT                     0x1406
+
+/// @brief A persistent set of instance transforms for one Mesh and Material. Slots stay valid until removed while the matrices are kept packed for instanced drawing
+struct ___instance_buffer_raylib64
+{
+    Mesh mesh;
+    Material material;
+    std::vector<Matrix> transforms; // Packed transforms, drawn as is
+    std::vector<int32_t> slotIndex; // Slot -> position in transforms or -1 for a free slot
+    std::vector<int32_t> indexSlot; // Position in transforms -> slot
+    std::vector<int32_t> freeSlots;
+    std::vector<float> upload;      // Column-major staging for the dirty range
+    unsigned int vboId;             // Persistent instance VBO (0 until the first draw)
+    int32_t vboCapacity;            // VBO size in matrices
+    int32_t dirtyFirst;             // Packed range that changed since the last upload. Empty when dirtyFirst > dirtyLast
+    int32_t dirtyLast;
+
+    void MarkDirty(int32_t index)
+    {
+        dirtyFirst = std::min(dirtyFirst, index);
+        dirtyLast = std::max(dirtyLast, index);
+    }
+
+    void ClearDirty()
+    {
+        dirtyFirst = INT32_MAX;
+        dirtyLast = -1;
+    }
+};
+
+/// @brief Copies a Matrix to 16 floats in m0 - m15 order (column-major, as OpenGL expects it)
+static inline void ___matrix_to_floats_raylib64(const Matrix &mat, float *result)
+{
+    auto m = (const float *)&mat;
+
+    for (auto k = 0; k < 16; k++)
+        result[k] = m[(k & 3) * 4 + (k >> 2)];
 }
 
-// Export mesh data to file, returns true on success
-inline qb_bool ExportMesh(void *mesh, char *fileName)
+/// @brief Same as raymath's MatrixMultiply(left, right), which raylib.h does not include
+static Matrix ___matrix_multiply_raylib64(const Matrix &left, const Matrix &right)
 {
-    return TO_QB_BOOL(_ExportMesh(*(Mesh *)mesh, fileName));
+    float l[16], r[16];
+    Matrix result;
+    auto m = (float *)&result;
+
+    ___matrix_to_floats_raylib64(left, l);
+    ___matrix_to_floats_raylib64(right, r);
+
+    for (auto i = 0; i < 4; i++)
+    {
+        for (auto j = 0; j < 4; j++)
+            m[j * 4 + i] = l[i * 4] * r[j] + l[i * 4 + 1] * r[4 + j] + l[i * 4 + 2] * r[8 + j] + l[i * 4 + 3] * r[12 + j];
+    }
+
+    return result;
 }
 
-// Compute mesh bounding box limits
-inline void GetMeshBoundingBox(void *mesh, void *retVal)
+/// @brief Creates an instance buffer for a mesh and material. The mesh and material are not copied and must stay loaded while the buffer is used
+/// @param mesh The mesh to draw
+/// @param material The material to draw with (its shader needs the instancing attributes, see raylib's instancing example)
+/// @param capacity The expected number of instances (the buffer grows as needed)
+/// @return An instance buffer handle. Free it with UnloadInstanceBuffer()
+inline uintptr_t LoadInstanceBuffer(void *mesh, void *material, int32_t capacity)
 {
-    *(BoundingBox *)retVal = _GetMeshBoundingBox(*(Mesh *)mesh);
+    auto buffer = new ___instance_buffer_raylib64();
+
+    buffer->mesh = *(const Mesh *)mesh;
+    buffer->material = *(const Material *)material;
+    buffer->transforms.reserve(capacity > 0 ? capacity : 0);
+    buffer->ClearDirty();
+
+    return (uintptr_t)buffer;
 }
 
-// Compute mesh tangents
-inline void GenMeshTangents(void *mesh)
+/// @brief Frees an instance buffer and its GPU transforms. The mesh and material are not unloaded
+/// @param buffer The instance buffer handle
+inline void UnloadInstanceBuffer(uintptr_t buffer)
 {
-    _GenMeshTangents((Mesh *)mesh);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+
+    if (b->vboId)
+        RAYLIB64_CALL(rlUnloadVertexBuffer)(b->vboId);
+
+    delete b;
 }
 
-// Generate polygonal mesh
-inline void GenMeshPoly(int sides, float radius, void *retVal)
+/// @brief Adds an instance
+/// @param buffer The instance buffer handle
+/// @param transform The instance Matrix
+/// @return The instance slot. It stays valid until the instance is removed and may be reused afterwards
+inline int32_t AddInstance(uintptr_t buffer, void *transform)
 {
-    *(Mesh *)retVal = _GenMeshPoly(sides, radius);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+    int32_t slot;
+
+    if (b->freeSlots.empty())
+    {
+        slot = int32_t(b->slotIndex.size());
+        b->slotIndex.push_back(0);
+    }
+    else
+    {
+        slot = b->freeSlots.back();
+        b->freeSlots.pop_back();
+    }
+
+    b->slotIndex[slot] = int32_t(b->transforms.size());
+    b->indexSlot.push_back(slot);
+    b->transforms.push_back(*(const Matrix *)transform);
+    b->MarkDirty(b->slotIndex[slot]);
+
+    return slot;
 }
 
-// Generate plane mesh (with subdivisions)
-inline void GenMeshPlane(float width, float length, int resX, int resZ, void *retVal)
+/// @brief Replaces the transform of an instance
+/// @param buffer The instance buffer handle
+/// @param slot The instance slot from AddInstance()
+/// @param transform The new Matrix
+inline void UpdateInstance(uintptr_t buffer, int32_t slot, void *transform)
 {
-    *(Mesh *)retVal = _GenMeshPlane(width, length, resX, resZ);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+
+    if (slot >= 0 && slot < int32_t(b->slotIndex.size()) && b->slotIndex[slot] >= 0)
+    {
+        b->transforms[b->slotIndex[slot]] = *(const Matrix *)transform;
+        b->MarkDirty(b->slotIndex[slot]);
+    }
 }
 
-// Generate cuboid mesh
-inline void GenMeshCube(float width, float height, float length, void *retVal)
+/// @brief Replaces the transforms of count consecutive slots from a UDT array in one call. Free slots are skipped
+/// @param buffer The instance buffer handle
+/// @param firstSlot The first slot to update
+/// @param transforms Pointer to the first Matrix
+/// @param stride Bytes between consecutive matrices (LEN of the UDT)
+/// @param count The number of slots to update
+inline void UpdateInstances(uintptr_t buffer, int32_t firstSlot, uintptr_t transforms, size_t stride, int32_t count)
 {
-    *(Mesh *)retVal = _GenMeshCube(width, height, length);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+    auto last = std::min(firstSlot + count, int32_t(b->slotIndex.size()));
+
+    for (auto slot = std::max(firstSlot, 0); slot < last; slot++)
+    {
+        if (b->slotIndex[slot] >= 0)
+        {
+            b->transforms[b->slotIndex[slot]] = *(const Matrix *)(transforms + size_t(slot - firstSlot) * stride);
+            b->MarkDirty(b->slotIndex[slot]);
+        }
+    }
 }
 
-// Generate sphere mesh (standard sphere)
-inline void GenMeshSphere(float radius, int rings, int slices, void *retVal)
+/// @brief Removes an instance. The last packed transform moves into its place, so removal is O(1)
+/// @param buffer The instance buffer handle
+/// @param slot The instance slot from AddInstance()
+inline void RemoveInstance(uintptr_t buffer, int32_t slot)
 {
-    *(Mesh *)retVal = _GenMeshSphere(radius, rings, slices);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+
+    if (slot < 0 || slot >= int32_t(b->slotIndex.size()) || b->slotIndex[slot] < 0)
+        return;
+
+    auto index = b->slotIndex[slot];
+    auto lastSlot = b->indexSlot.back();
+
+    b->transforms[index] = b->transforms.back();
+    b->indexSlot[index] = lastSlot;
+    b->slotIndex[lastSlot] = index;
+
+    b->transforms.pop_back();
+    b->indexSlot.pop_back();
+    b->slotIndex[slot] = -1;
+    b->freeSlots.push_back(slot);
+
+    // Only the hole changed. The GPU copy past the new end is simply not drawn
+    if (index < int32_t(b->transforms.size()))
+        b->MarkDirty(index);
 }
 
-// Generate half-sphere mesh (no bottom cap)
-inline void GenMeshHemiSphere(float radius, int rings, int slices, void *retVal)
+/// @brief Removes all instances
+/// @param buffer The instance buffer handle
+inline void ClearInstances(uintptr_t buffer)
 {
-    *(Mesh *)retVal = _GenMeshHemiSphere(radius, rings, slices);
+    auto b = (___instance_buffer_raylib64 *)buffer;
+
+    b->transforms.clear();
+    b->slotIndex.clear();
+    b->indexSlot.clear();
+    b->freeSlots.clear();
+    b->ClearDirty();
 }
 
-// Generate cylinder mesh
-inline void GenMeshCylinder(float radius, float height, int slices, void *retVal)
+/// @brief Returns the number of instances
+/// @param buffer The instance buffer handle
+/// @return The instance count
+inline int32_t GetInstanceCount(uintptr_t buffer)
 {
-    *(Mesh *)retVal = _GenMeshCylinder(radius, height, slices);
+    return int32_t(((const ___instance_buffer_raylib64 *)buffer)->transforms.size());
+}
+
+/// @brief Draws every instance with one instanced draw call. The transforms live in a persistent VBO and only the range changed since the last draw is uploaded
+/// @param buffer The instance buffer handle
+inline void DrawInstanceBuffer(uintptr_t buffer)
+{
+    auto b = (___instance_buffer_raylib64 *)buffer;
+    auto count = int32_t(b->transforms.size());
+
+    if (!count)
+        return;
+
+    auto &mesh = b->mesh;
+    auto &material = b->material;
+    auto locs = material.shader.locs;
+
+    // Stereo rendering and meshes without a VAO need raylib's own path (which uploads everything)
+    if (!mesh.vaoId || !locs || locs[RAYLIB64_SHADER_LOC_MATRIX_MODEL] < 0 || RAYLIB64_CALL(rlIsStereoRenderEnabled)())
+    {
+        RAYLIB64_CALL(DrawMeshInstanced)(mesh, material, b->transforms.data(), count);
+        return;
+    }
+
+    const auto matrixSize = int32_t(16 * sizeof(float));
+
+    if (count > b->vboCapacity)
+    {
+        if (b->vboId)
+            RAYLIB64_CALL(rlUnloadVertexBuffer)(b->vboId);
+
+        b->vboCapacity = std::max({count, int32_t(b->transforms.capacity()), b->vboCapacity * 2});
+        b->vboId = RAYLIB64_CALL(rlLoadVertexBuffer)(nullptr, b->vboCapacity * matrixSize, true);
+        b->dirtyFirst = 0;
+        b->dirtyLast = count - 1;
+    }
+
+    if (b->dirtyFirst <= b->dirtyLast)
+    {
+        auto last = std::min(b->dirtyLast, count - 1);
+        auto dirty = last - b->dirtyFirst + 1;
+
+        if (dirty > 0)
+        {
+            b->upload.resize(size_t(dirty) * 16);
+
+            for (auto i = 0; i < dirty; i++)
+                ___matrix_to_floats_raylib64(b->transforms[b->dirtyFirst + i], &b->upload[size_t(i) * 16]);
+
+            RAYLIB64_CALL(rlUpdateVertexBuffer)(b->vboId, b->upload.data(), dirty * matrixSize, b->dirtyFirst * matrixSize);
+        }
+
+        b->ClearDirty();
+    }
+
+    // What follows mirrors raylib 5.0's DrawMeshInstanced() minus the per-call VBO
+    RAYLIB64_CALL(rlEnableShader)(material.shader.id);
+
+    if (locs[RAYLIB64_SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        auto color = material.maps[RAYLIB64_MATERIAL_MAP_DIFFUSE].color;
+        float values[4] = {float(color & 0xFF) / 255.0f, float((color >> 8) & 0xFF) / 255.0f, float((color >> 16) & 0xFF) / 255.0f, float(color >> 24) / 255.0f};
+        RAYLIB64_CALL(rlSetUniform)(locs[RAYLIB64_SHADER_LOC_COLOR_DIFFUSE], values, RAYLIB64_SHADER_UNIFORM_VEC4, 1);
+    }
+
+    if (locs[RAYLIB64_SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        auto color = material.maps[RAYLIB64_MATERIAL_MAP_SPECULAR].color;
+        float values[4] = {float(color & 0xFF) / 255.0f, float((color >> 8) & 0xFF) / 255.0f, float((color >> 16) & 0xFF) / 255.0f, float(color >> 24) / 255.0f};
+        RAYLIB64_CALL(rlSetUniform)(locs[RAYLIB64_SHADER_LOC_COLOR_SPECULAR], values, RAYLIB64_SHADER_UNIFORM_VEC4, 1);
+    }
+
+    auto matView = RAYLIB64_CALL(rlGetMatrixModelview)();
+    auto matProjection = RAYLIB64_CALL(rlGetMatrixProjection)();
+
+    if (locs[RAYLIB64_SHADER_LOC_MATRIX_VIEW] != -1)
+        RAYLIB64_CALL(rlSetUniformMatrix)(locs[RAYLIB64_SHADER_LOC_MATRIX_VIEW], matView);
+    if (locs[RAYLIB64_SHADER_LOC_MATRIX_PROJECTION] != -1)
+        RAYLIB64_CALL(rlSetUniformMatrix)(locs[RAYLIB64_SHADER_LOC_MATRIX_PROJECTION], matProjection);
+
+    // The VAO may be shared with other draws, so the instance attributes are attached every time
+    RAYLIB64_CALL(rlEnableVertexArray)(mesh.vaoId);
+    RAYLIB64_CALL(rlEnableVertexBuffer)(b->vboId);
+
+    for (auto i = 0u; i < 4u; i++)
+    {
+        auto loc = unsigned(locs[RAYLIB64_SHADER_LOC_MATRIX_MODEL]) + i;
+        RAYLIB64_CALL(rlEnableVertexAttribute)(loc);
+        RAYLIB64_CALL(rlSetVertexAttribute)(loc, 4, RAYLIB64_RL_FLOAT, false, matrixSize, (const void *)(uintptr_t(i) * 4 * sizeof(float)));
+        RAYLIB64_CALL(rlSetVertexAttributeDivisor)(loc, 1);
+    }
+
+    RAYLIB64_CALL(rlDisableVertexBuffer)();
+    RAYLIB64_CALL(rlDisableVertexArray)();
+
+    auto matModelView = ___matrix_multiply_raylib64(RAYLIB64_CALL(rlGetMatrixTransform)(), matView);
+
+    if (locs[RAYLIB64_SHADER_LOC_MATRIX_NORMAL] != -1)
+        RAYLIB64_CALL(rlSetUniformMatrix)(locs[RAYLIB64_SHADER_LOC_MATRIX_NORMAL], Matrix{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
+
+    for (auto i = 0; i < RAYLIB64_MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            RAYLIB64_CALL(rlActiveTextureSlot)(i);
+
+            if (i == RAYLIB64_MATERIAL_MAP_CUBEMAP || i == RAYLIB64_MATERIAL_MAP_IRRADIANCE || i == RAYLIB64_MATERIAL_MAP_PREFILTER)
+                RAYLIB64_CALL(rlEnableTextureCubemap)(material.maps[i].texture.id);
+            else
+                RAYLIB64_CALL(rlEnableTexture)(material.maps[i].texture.id);
+
+            RAYLIB64_CALL(rlSetUniform)(locs[RAYLIB64_SHADER_LOC_MAP_DIFFUSE + i], &i, RAYLIB64_SHADER_UNIFORM_INT, 1);
+        }
+    }
+
+    // The mesh attributes are already bound in the VAO. Only vertex colors need switching off when the mesh has none
+    if (!RAYLIB64_CALL(rlEnableVertexArray)(mesh.vaoId))
+    {
+        RAYLIB64_CALL(rlDisableShader)();
+        return;
+    }
+
+    if (locs[RAYLIB64_SHADER_LOC_VERTEX_COLOR] != -1 && !mesh.vboId[3])
+        RAYLIB64_CALL(rlDisableVertexAttribute)(unsigned(locs[RAYLIB64_SHADER_LOC_VERTEX_COLOR]));
+
+    RAYLIB64_CALL(rlSetUniformMatrix)(locs[RAYLIB64_SHADER_LOC_MATRIX_MVP], ___matrix_multiply_raylib64(matModelView, matProjection));
+
+    if (mesh.indices)
+        RAYLIB64_CALL(rlDrawVertexArrayElementsInstanced)(0, mesh.triangleCount * 3, nullptr, count);
+    else
+        RAYLIB64_CALL(rlDrawVertexArrayInstanced)(0, mesh.vertexCount, count);
+
+    for (auto i = 0; i < RAYLIB64_MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            RAYLIB64_CALL(rlActiveTextureSlot)(i);
+
+            if (i == RAYLIB64_MATERIAL_MAP_CUBEMAP || i == RAYLIB64_MATERIAL_MAP_IRRADIANCE || i == RAYLIB64_MATERIAL_MAP_PREFILTER)
+                RAYLIB64_CALL(rlDisableTextureCubemap)();
+            else
+                RAYLIB64_CALL(rlDisableTexture)();
+        }
+    }
+
+    RAYLIB64_CALL(rlDisableVertexArray)();
+    RAYLIB64_CALL(rlDisableVertexBuffer)();
+    RAYLIB64_CALL(rlDisableVertexBufferElement)();
+    RAYLIB64_CALL(rlDisableShader)();
+}
+
+// Export mesh data to file, returns true on success
+inline qb_bool ExportMesh(void *mesh, uintptr_t fileName)
+{
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportMesh)(*(Mesh *)mesh, (char *)fileName));
+}
+
+// Compute mesh bounding box limits
+inline void GetMeshBoundingBox(void *mesh, void *retVal)
+{
+    *(BoundingBox *)retVal = RAYLIB64_CALL(GetMeshBoundingBox)(*(Mesh *)mesh);
+}
+
+// Compute mesh tangents
+inline void GenMeshTangents(void *mesh)
+{
+    RAYLIB64_CALL(GenMeshTangents)((Mesh *)mesh);
+}
+
+// Generate polygonal mesh
+inline void GenMeshPoly(int sides, float radius, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshPoly)(sides, radius);
+}
+
+// Generate plane mesh (with subdivisions)
+inline void GenMeshPlane(float width, float length, int resX, int resZ, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshPlane)(width, length, resX, resZ);
+}
+
+// Generate cuboid mesh
+inline void GenMeshCube(float width, float height, float length, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshCube)(width, height, length);
+}
+
+// Generate sphere mesh (standard sphere)
+inline void GenMeshSphere(float radius, int rings, int slices, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshSphere)(radius, rings, slices);
+}
+
+// Generate half-sphere mesh (no bottom cap)
+inline void GenMeshHemiSphere(float radius, int rings, int slices, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshHemiSphere)(radius, rings, slices);
+}
+
+// Generate cylinder mesh
+inline void GenMeshCylinder(float radius, float height, int slices, void *retVal)
+{
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshCylinder)(radius, height, slices);
 }
 
 // Generate cone/pyramid mesh
 inline void GenMeshCone(float radius, float height, int slices, void *retVal)
 {
-    *(Mesh *)retVal = _GenMeshCone(radius, height, slices);
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshCone)(radius, height, slices);
 }
 
 // Generate torus mesh
 inline void GenMeshTorus(float radius, float size, int radSeg, int sides, void *retVal)
 {
-    *(Mesh *)retVal = _GenMeshTorus(radius, size, radSeg, sides);
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshTorus)(radius, size, radSeg, sides);
 }
 
 // Generate trefoil knot mesh
 inline void GenMeshKnot(float radius, float size, int radSeg, int sides, void *retVal)
 {
-    *(Mesh *)retVal = _GenMeshKnot(radius, size, radSeg, sides);
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshKnot)(radius, size, radSeg, sides);
 }
 
 // Generate heightmap mesh from image data
 inline void GenMeshHeightmap(void *heightmap, void *size, void *retVal)
 {
-    *(Mesh *)retVal = _GenMeshHeightmap(*(Image *)heightmap, *(Vector3 *)size);
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshHeightmap)(*(Image *)heightmap, *(Vector3 *)size);
 }
 
 // Generate cubes-based map mesh from image data
 inline void GenMeshCubicmap(void *cubicmap, void *cubeSize, void *retVal)
 {
-    *(Mesh *)retVal = _GenMeshCubicmap(*(Image *)cubicmap, *(Vector3 *)cubeSize);
+    *(Mesh *)retVal = RAYLIB64_CALL(GenMeshCubicmap)(*(Image *)cubicmap, *(Vector3 *)cubeSize);
 }
 
 // Load materials from model file
-inline void *LoadMaterials(char *fileName, void *materialCount)
+inline void *LoadMaterials(uintptr_t fileName, void *materialCount)
 {
-    return _LoadMaterials(fileName, (int *)materialCount);
+    return RAYLIB64_CALL(LoadMaterials)((char *)fileName, (int *)materialCount);
 }
 
 // Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
 inline void LoadMaterialDefault(void *retVal)
 {
-    *(Material *)retVal = _LoadMaterialDefault();
+    *(Material *)retVal = RAYLIB64_CALL(LoadMaterialDefault)();
 }
 
 // Check if a material is ready
 inline qb_bool IsMaterialReady(void *material)
 {
-    return TO_QB_BOOL(_IsMaterialReady(*(Material *)material));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMaterialReady)(*(Material *)material));
 }
 
 // Unload material from GPU memory (VRAM)
 inline void UnloadMaterial(void *material)
 {
-    _UnloadMaterial(*(Material *)material);
+    RAYLIB64_CALL(UnloadMaterial)(*(Material *)material);
 }
 
 // Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
 inline void SetMaterialTexture(void *material, int mapType, void *texture)
 {
-    _SetMaterialTexture((Material *)material, mapType, *(Texture *)texture);
+    RAYLIB64_CALL(SetMaterialTexture)((Material *)material, mapType, *(Texture *)texture);
 }
 
 // Set material for a mesh
 inline void SetModelMeshMaterial(void *model, int meshId, int materialId)
 {
-    _SetModelMeshMaterial((Model *)model, meshId, materialId);
+    RAYLIB64_CALL(SetModelMeshMaterial)((Model *)model, meshId, materialId);
 }
 
 // Load model animations from file
-inline void *LoadModelAnimations(char *fileName, void *animCount)
+inline void *LoadModelAnimations(uintptr_t fileName, void *animCount)
 {
-    return _LoadModelAnimations(fileName, (int *)animCount);
+    return RAYLIB64_CALL(LoadModelAnimations)((char *)fileName, (int *)animCount);
 }
 
 // Update model animation pose
 inline void UpdateModelAnimation(void *model, void *anim, int frame)
 {
-    _UpdateModelAnimation(*(Model *)model, *(ModelAnimation *)anim, frame);
+    RAYLIB64_CALL(UpdateModelAnimation)(*(Model *)model, *(ModelAnimation *)anim, frame);
+
+    // The meshes no longer show what UpdateModelAnimationCached() last put there
+    auto mdl = (const Model *)model;
+    for (auto m = 0; m < mdl->meshCount; m++)
+        ___forget_skinned_mesh_raylib64(mdl->meshes[m]);
+}
+
+/// @brief Skinning transform of one bone for one animation frame. position is a 3x4 row-major matrix (bind pose vertex to animated vertex)
+/// and normal is the 3x3 rotation part
+struct ___bone_skin_raylib64
+{
+    float position[12];
+    float normal[9];
+};
+
+/// @brief Bone transforms for every frame of a ModelAnimation, computed once against a model's bind pose
+struct ___animation_cache_raylib64
+{
+    int32_t boneCount;
+    int32_t frameCount;
+    std::vector<___bone_skin_raylib64> bones; // frameCount * boneCount
+};
+
+/// @brief Computes the skinning transform of a bone posed at pose, given its bind pose
+inline void ___bone_skin_from_pose_raylib64(const Transform &in, const Transform &out, ___bone_skin_raylib64 *skin)
+{
+    // QuaternionMultiply(out.rotation, QuaternionInvert(in.rotation))
+    auto inv = in.rotation;
+    auto lengthSq = inv.x * inv.x + inv.y * inv.y + inv.z * inv.z + inv.w * inv.w;
+    if (lengthSq != 0.0f)
+    {
+        auto invLength = 1.0f / lengthSq;
+        inv = {-inv.x * invLength, -inv.y * invLength, -inv.z * invLength, inv.w * invLength};
+    }
+    auto &o = out.rotation;
+    Vector4 q = {o.x * inv.w + o.w * inv.x + o.y * inv.z - o.z * inv.y, o.y * inv.w + o.w * inv.y + o.z * inv.x - o.x * inv.z,
+                 o.z * inv.w + o.w * inv.z + o.x * inv.y - o.y * inv.x, o.w * inv.w - o.x * inv.x - o.y * inv.y - o.z * inv.z};
+
+    // Vector3RotateByQuaternion() as a matrix
+    auto r = skin->normal;
+    r[0] = q.x * q.x + q.w * q.w - q.y * q.y - q.z * q.z;
+    r[1] = 2 * q.x * q.y - 2 * q.w * q.z;
+    r[2] = 2 * q.x * q.z + 2 * q.w * q.y;
+    r[3] = 2 * q.w * q.z + 2 * q.x * q.y;
+    r[4] = q.w * q.w - q.x * q.x + q.y * q.y - q.z * q.z;
+    r[5] = -2 * q.w * q.x + 2 * q.y * q.z;
+    r[6] = -2 * q.w * q.y + 2 * q.x * q.z;
+    r[7] = 2 * q.w * q.x + 2 * q.y * q.z;
+    r[8] = q.w * q.w - q.x * q.x - q.y * q.y + q.z * q.z;
+
+    // Rotate((vertex - in.translation) * out.scale) + out.translation
+    const float scale[3] = {out.scale.x, out.scale.y, out.scale.z};
+    const float offset[3] = {-in.translation.x * out.scale.x, -in.translation.y * out.scale.y, -in.translation.z * out.scale.z};
+    const float translation[3] = {out.translation.x, out.translation.y, out.translation.z};
+    for (auto row = 0; row < 3; row++)
+    {
+        auto m = &skin->position[row * 4];
+        m[0] = r[row * 3] * scale[0];
+        m[1] = r[row * 3 + 1] * scale[1];
+        m[2] = r[row * 3 + 2] * scale[2];
+        m[3] = r[row * 3] * offset[0] + r[row * 3 + 1] * offset[1] + r[row * 3 + 2] * offset[2] + translation[row];
+    }
+}
+
+/// @brief Skins vertices [begin, end) of a mesh. This is the same per-vertex math as raylib's UpdateModelAnimation() with the bone transforms precomputed
+inline void ___skin_mesh_raylib64(const Mesh &mesh, const ___bone_skin_raylib64 *bones, int32_t boneCount, size_t begin, size_t end)
+{
+    for (auto v = begin; v < end; v++)
+    {
+        auto src = &mesh.vertices[v * 3];
+        auto nrm = mesh.normals && mesh.animNormals ? &mesh.normals[v * 3] : nullptr;
+        float px = 0.0f, py = 0.0f, pz = 0.0f, nx = 0.0f, ny = 0.0f, nz = 0.0f;
+
+        for (auto j = v * 4; j < v * 4 + 4; j++)
+        {
+            auto weight = mesh.boneWeights[j];
+            if (weight == 0.0f || mesh.boneIds[j] >= boneCount)
+                continue;
+
+            auto b = &bones[mesh.boneIds[j]];
+            auto m = b->position;
+            px += (m[0] * src[0] + m[1] * src[1] + m[2] * src[2] + m[3]) * weight;
+            py += (m[4] * src[0] + m[5] * src[1] + m[6] * src[2] + m[7]) * weight;
+            pz += (m[8] * src[0] + m[9] * src[1] + m[10] * src[2] + m[11]) * weight;
+
+            if (nrm)
+            {
+                auto n = b->normal;
+                nx += (n[0] * nrm[0] + n[1] * nrm[1] + n[2] * nrm[2]) * weight;
+                ny += (n[3] * nrm[0] + n[4] * nrm[1] + n[5] * nrm[2]) * weight;
+                nz += (n[6] * nrm[0] + n[7] * nrm[1] + n[8] * nrm[2]) * weight;
+            }
+        }
+
+        mesh.animVertices[v * 3] = px;
+        mesh.animVertices[v * 3 + 1] = py;
+        mesh.animVertices[v * 3 + 2] = pz;
+
+        if (nrm)
+        {
+            mesh.animNormals[v * 3] = nx;
+            mesh.animNormals[v * 3 + 1] = ny;
+            mesh.animNormals[v * 3 + 2] = nz;
+        }
+    }
+}
+
+/// @brief Precomputes the bone transforms of every frame of an animation for a model's bind pose. The cache can be shared by every model loaded with the same skeleton
+/// @param model The model (only its bind pose is read)
+/// @param anim The animation (it can be unloaded once the cache is made)
+/// @return An animation cache handle or 0 if the animation does not match the model. Free it with UnloadAnimationCache()
+inline uintptr_t LoadAnimationCache(void *model, void *anim)
+{
+    auto mdl = (const Model *)model;
+    auto a = (const ModelAnimation *)anim;
+
+    if (!a->framePoses || !a->bones || a->frameCount <= 0 || !mdl->bindPose || a->boneCount > mdl->boneCount)
+    {
+        RAYLIB_DEBUG_PRINT("Animation does not match the model");
+        return 0;
+    }
+
+    auto cache = new ___animation_cache_raylib64();
+    cache->boneCount = a->boneCount;
+    cache->frameCount = a->frameCount;
+    cache->bones.resize(size_t(a->frameCount) * a->boneCount);
+
+    for (auto f = 0; f < a->frameCount; f++)
+    {
+        for (auto b = 0; b < a->boneCount; b++)
+            ___bone_skin_from_pose_raylib64(mdl->bindPose[b], a->framePoses[f][b], &cache->bones[size_t(f) * a->boneCount + b]);
+    }
+
+    return (uintptr_t)cache;
+}
+
+/// @brief Frees an animation cache
+/// @param cache The animation cache handle
+inline void UnloadAnimationCache(uintptr_t cache)
+{
+    auto &meshes = ___skinned_meshes_raylib64();
+    meshes.erase(std::remove_if(meshes.begin(), meshes.end(), [&](const auto &m) { return m.second.first == (const ___animation_cache_raylib64 *)cache; }), meshes.end());
+
+    delete (___animation_cache_raylib64 *)cache;
+}
+
+/// @brief Skins every animated mesh of a model on the worker pool and uploads the results. With a cache, meshes already showing that cache's frame are skipped.
+/// Without one (blended poses) every mesh is skinned
+inline void ___skin_model_raylib64(const Model *mdl, const ___bone_skin_raylib64 *bones, int32_t boneCount, const ___animation_cache_raylib64 *cache, int32_t frame)
+{
+    // Split the meshes that need skinning into chunks of vertices for the worker pool
+    struct Task
+    {
+        const Mesh *mesh;
+        size_t begin;
+        size_t end;
+    };
+    const size_t chunk = 2048;
+    std::vector<Task> tasks;
+    auto &meshes = ___skinned_meshes_raylib64();
+
+    for (auto m = 0; m < mdl->meshCount; m++)
+    {
+        auto &mesh = mdl->meshes[m];
+        if (!mesh.boneIds || !mesh.boneWeights || !mesh.animVertices)
+            continue;
+
+        auto it = std::find_if(meshes.begin(), meshes.end(), [&](const auto &e) { return e.first == mesh.animVertices; });
+        if (it == meshes.end())
+            it = meshes.insert(meshes.end(), {mesh.animVertices, {nullptr, -1}});
+        else if (cache && it->second.first == cache && it->second.second == frame)
+            continue;
+        it->second = {cache, cache ? frame : -1};
+
+        for (size_t v = 0; v < size_t(mesh.vertexCount); v += chunk)
+            tasks.push_back({&mesh, v, std::min(v + chunk, size_t(mesh.vertexCount))});
+    }
+
+    if (tasks.empty())
+        return;
+
+    ___parallel_for_raylib64(tasks.size(), 1, [&](size_t begin, size_t end) {
+        for (auto t = begin; t < end; t++)
+            ___skin_mesh_raylib64(*tasks[t].mesh, bones, boneCount, tasks[t].begin, tasks[t].end);
+    });
+
+    // GPU uploads stay on the calling thread
+    for (size_t t = 0; t < tasks.size(); t++)
+    {
+        auto &mesh = *tasks[t].mesh;
+        if (tasks[t].begin != 0)
+            continue;
+
+        RAYLIB64_CALL(UpdateMeshBuffer)(mesh, 0, mesh.animVertices, mesh.vertexCount * 3 * sizeof(float), 0);
+        if (mesh.animNormals)
+            RAYLIB64_CALL(UpdateMeshBuffer)(mesh, 2, mesh.animNormals, mesh.vertexCount * 3 * sizeof(float), 0);
+    }
+}
+
+/// @brief Poses a model like UpdateModelAnimation() using cached bone transforms. Meshes are skinned on the worker pool (see SetWorkerThreadCount())
+/// and meshes already showing this frame of this cache are skipped. Call it from the thread that owns the OpenGL context
+/// @param model The model to pose
+/// @param cache The animation cache handle
+/// @param frame The animation frame (wraps around like UpdateModelAnimation())
+inline void UpdateModelAnimationCached(void *model, uintptr_t cache, int32_t frame)
+{
+    auto c = (const ___animation_cache_raylib64 *)cache;
+
+    if (!c)
+        return;
+
+    frame %= c->frameCount;
+    if (frame < 0)
+        frame += c->frameCount;
+
+    ___skin_model_raylib64((const Model *)model, &c->bones[size_t(frame) * c->boneCount], c->boneCount, c, frame);
+}
+
+/// @brief Blends the bone poses of two animations. Each one is sampled between its two nearest frames, then the two samples are mixed by weight.
+/// Translations and scales are interpolated linearly and rotations with nlerp along the shortest arc
+inline void ___blend_poses_raylib64(const ModelAnimation &a, float frameA, const ModelAnimation &b, float frameB, float weight, int32_t boneCount, Transform *out)
+{
+    const Transform *src[4];
+    float w[4];
+
+    auto sample = [](const ModelAnimation &anim, float frame, float amount, const Transform **s, float *sw) {
+        auto whole = std::floor(frame);
+        auto fraction = frame - whole;
+        auto f = int32_t(std::fmod(double(whole), double(anim.frameCount)));
+        if (f < 0)
+            f += anim.frameCount;
+
+        s[0] = anim.framePoses[f];
+        s[1] = anim.framePoses[(f + 1) % anim.frameCount];
+        sw[0] = (1.0f - fraction) * amount;
+        sw[1] = fraction * amount;
+    };
+    sample(a, frameA, 1.0f - weight, src, w);
+    sample(b, frameB, weight, src + 2, w + 2);
+
+    // A Transform is 10 floats, read as three overlapping groups of 4 so every load stays inside it:
+    // [0, 4) translation (+ rotation.x), [3, 7) rotation, [6, 10) (rotation.w +) scale
+    auto i = 0;
+#if defined(RAYLIB64_SSE2)
+    auto sign = _mm_set1_ps(-0.0f);
+    auto zero = _mm_setzero_ps();
+    auto dot = [](__m128 x, __m128 y) {
+        auto m = _mm_mul_ps(x, y);
+        m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+    };
+
+    for (; i < boneCount; i++)
+    {
+        auto p0 = (const float *)&src[0][i];
+        auto wk = _mm_set1_ps(w[0]);
+        auto t = _mm_mul_ps(wk, _mm_loadu_ps(p0));
+        auto r0 = _mm_loadu_ps(p0 + 3);
+        auto r = _mm_mul_ps(wk, r0);
+        auto s = _mm_mul_ps(wk, _mm_loadu_ps(p0 + 6));
+
+        for (auto k = 1; k < 4; k++)
+        {
+            auto p = (const float *)&src[k][i];
+            auto rk = _mm_loadu_ps(p + 3);
+            wk = _mm_set1_ps(w[k]);
+            t = _mm_add_ps(t, _mm_mul_ps(wk, _mm_loadu_ps(p)));
+            s = _mm_add_ps(s, _mm_mul_ps(wk, _mm_loadu_ps(p + 6)));
+            // q and -q are the same rotation; take the one on r0's side
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_xor_ps(wk, _mm_and_ps(_mm_cmplt_ps(dot(r0, rk), zero), sign)), rk));
+        }
+
+        auto lengthSq = dot(r, r);
+        r = _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(lengthSq, zero), _mm_div_ps(r, _mm_sqrt_ps(lengthSq))), _mm_andnot_ps(_mm_cmpgt_ps(lengthSq, zero), r0));
+
+        auto o = (float *)&out[i];
+        _mm_storeu_ps(o, t);
+        _mm_storeu_ps(o + 6, s);
+        _mm_storeu_ps(o + 3, r);
+    }
+#endif
+    for (; i < boneCount; i++)
+    {
+        auto &r0 = src[0][i].rotation;
+        Transform result = {};
+
+        for (auto k = 0; k < 4; k++)
+        {
+            auto &pose = src[k][i];
+            auto wr = r0.x * pose.rotation.x + r0.y * pose.rotation.y + r0.z * pose.rotation.z + r0.w * pose.rotation.w < 0.0f ? -w[k] : w[k];
+            result.translation = {result.translation.x + w[k] * pose.translation.x, result.translation.y + w[k] * pose.translation.y, result.translation.z + w[k] * pose.translation.z};
+            result.rotation = {result.rotation.x + wr * pose.rotation.x, result.rotation.y + wr * pose.rotation.y, result.rotation.z + wr * pose.rotation.z, result.rotation.w + wr * pose.rotation.w};
+            result.scale = {result.scale.x + w[k] * pose.scale.x, result.scale.y + w[k] * pose.scale.y, result.scale.z + w[k] * pose.scale.z};
+        }
+
+        auto &q = result.rotation;
+        auto lengthSq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+        if (lengthSq > 0.0f)
+        {
+            auto length = std::sqrt(lengthSq);
+            q = {q.x / length, q.y / length, q.z / length, q.w / length};
+        }
+        else
+        {
+            q = r0;
+        }
+
+        out[i] = result;
+    }
+}
+
+/// @brief Blends the bone poses of two animations without touching any model (for bone attachments or custom skinning)
+/// @param animA The first animation
+/// @param frameA Position in animA in frames. Fractions interpolate between neighbouring frames and it wraps around
+/// @param animB The second animation (it must use the same skeleton as animA)
+/// @param frameB Position in animB in frames
+/// @param weight 0 gives animA's pose, 1 gives animB's pose
+/// @param poses Transform array that receives one pose per bone
+inline void BlendModelAnimationPoses(void *animA, float frameA, void *animB, float frameB, float weight, void *poses)
+{
+    auto a = (const ModelAnimation *)animA;
+    auto b = (const ModelAnimation *)animB;
+
+    if (a->framePoses && b->framePoses && a->frameCount > 0 && b->frameCount > 0)
+        ___blend_poses_raylib64(*a, frameA, *b, frameB, weight, std::min(a->boneCount, b->boneCount), (Transform *)poses);
+}
+
+/// @brief Poses a model with a blend of two animations, for crossfades and for smooth playback between frames. Skinning runs on the worker pool
+/// @param model The model to pose
+/// @param animA The first animation
+/// @param frameA Position in animA in frames. Fractions interpolate between neighbouring frames and it wraps around
+/// @param animB The second animation (it must use the model's skeleton, like animA)
+/// @param frameB Position in animB in frames
+/// @param weight 0 gives animA's pose, 1 gives animB's pose
+inline void UpdateModelAnimationBlend(void *model, void *animA, float frameA, void *animB, float frameB, float weight)
+{
+    auto mdl = (const Model *)model;
+    auto a = (const ModelAnimation *)animA;
+    auto b = (const ModelAnimation *)animB;
+
+    if (!a->framePoses || !b->framePoses || a->frameCount <= 0 || b->frameCount <= 0 || !mdl->bindPose)
+        return;
+
+    auto boneCount = std::min({a->boneCount, b->boneCount, mdl->boneCount});
+    thread_local std::vector<Transform> poses;
+    thread_local std::vector<___bone_skin_raylib64> skins;
+    poses.resize(boneCount);
+    skins.resize(boneCount);
+
+    ___blend_poses_raylib64(*a, frameA, *b, frameB, weight, boneCount, poses.data());
+    for (auto i = 0; i < boneCount; i++)
+        ___bone_skin_from_pose_raylib64(mdl->bindPose[i], poses[i], &skins[i]);
+
+    ___skin_model_raylib64(mdl, skins.data(), boneCount, nullptr, 0);
 }
 
 // Unload animation data
 inline void UnloadModelAnimation(void *anim)
 {
-    _UnloadModelAnimation(*(ModelAnimation *)anim);
+    RAYLIB64_CALL(UnloadModelAnimation)(*(ModelAnimation *)anim);
 }
 
 // Unload animation array data
 inline void UnloadModelAnimations(void *animations, int animCount)
 {
-    _UnloadModelAnimations((ModelAnimation *)animations, animCount);
+    RAYLIB64_CALL(UnloadModelAnimations)((ModelAnimation *)animations, animCount);
 }
 
 // Check model animation skeleton match
 inline qb_bool IsModelAnimationValid(void *model, void *anim)
 {
-    return TO_QB_BOOL(_IsModelAnimationValid(*(Model *)model, *(ModelAnimation *)anim));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsModelAnimationValid)(*(Model *)model, *(ModelAnimation *)anim));
 }
 
 // Check collision between two spheres
 inline qb_bool CheckCollisionSpheres(void *center1, float radius1, void *center2, float radius2)
 {
-    return TO_QB_BOOL(_CheckCollisionSpheres(*(Vector3 *)center1, radius1, *(Vector3 *)center2, radius2));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionSpheres)(*(Vector3 *)center1, radius1, *(Vector3 *)center2, radius2));
 }
 
 // Check collision between two bounding boxes
 inline qb_bool CheckCollisionBoxes(void *box1, void *box2)
 {
-    return TO_QB_BOOL(_CheckCollisionBoxes(*(BoundingBox *)box1, *(BoundingBox *)box2));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionBoxes)(*(BoundingBox *)box1, *(BoundingBox *)box2));
 }
 
 // Check collision between box and sphere
 inline qb_bool CheckCollisionBoxSphere(void *box, void *center, float radius)
 {
-    return TO_QB_BOOL(_CheckCollisionBoxSphere(*(BoundingBox *)box, *(Vector3 *)center, radius));
+    return TO_QB_BOOL(RAYLIB64_CALL(CheckCollisionBoxSphere)(*(BoundingBox *)box, *(Vector3 *)center, radius));
 }
 
 // Get collision info between ray and sphere
 inline void GetRayCollisionSphere(void *ray, void *center, float radius, void *retVal)
 {
-    *(RayCollision *)retVal = _GetRayCollisionSphere(*(Ray *)ray, *(Vector3 *)center, radius);
+    *(RayCollision *)retVal = RAYLIB64_CALL(GetRayCollisionSphere)(*(Ray *)ray, *(Vector3 *)center, radius);
 }
 
 // Get collision info between ray and box
 inline void GetRayCollisionBox(void *ray, void *box, void *retVal)
 {
-    *(RayCollision *)retVal = _GetRayCollisionBox(*(Ray *)ray, *(BoundingBox *)box);
+    *(RayCollision *)retVal = RAYLIB64_CALL(GetRayCollisionBox)(*(Ray *)ray, *(BoundingBox *)box);
 }
 
 // Get collision info between ray and mesh
 inline void GetRayCollisionMesh(void *ray, void *mesh, void *transform, void *retVal)
 {
-    *(RayCollision *)retVal = _GetRayCollisionMesh(*(Ray *)ray, *(Mesh *)mesh, *(Matrix *)transform);
+    *(RayCollision *)retVal = RAYLIB64_CALL(GetRayCollisionMesh)(*(Ray *)ray, *(Mesh *)mesh, *(Matrix *)transform);
+}
+
+/// @brief A bounding volume hierarchy over the triangles of a Mesh or Model, built with the surface area heuristic (SAH)
+struct ___bvh_raylib64
+{
+    // 32-byte node. Children of an inner node are stored next to each other at first and first + 1
+    struct Node
+    {
+        float min[3];
+        uint32_t first; // First triangle (leaf) or left child (inner node)
+        float max[3];
+        uint32_t count; // Triangle count (leaf) or 0 (inner node)
+    };
+
+    // Triangles are stored in the order the leaves reference them, with the edges precomputed for the intersection test
+    struct Triangle
+    {
+        Vector3 v0, e1, e2;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Triangle> triangles;
+};
+
+#define RAYLIB64_BVH_BINS 16
+#define RAYLIB64_BVH_LEAF_SIZE 4
+#define RAYLIB64_BVH_MAX_DEPTH 64
+
+/// @brief Adds the triangles of a mesh, transformed to world space, to a triangle list
+static void ___bvh_add_mesh_raylib64(std::vector<___bvh_raylib64::Triangle> &triangles, const Mesh &mesh, const Matrix &m)
+{
+    if (!mesh.vertices)
+        return;
+
+    auto vertex = [&](int32_t index)
+    {
+        auto v = &mesh.vertices[index * 3];
+        return Vector3{m.m0 * v[0] + m.m4 * v[1] + m.m8 * v[2] + m.m12, m.m1 * v[0] + m.m5 * v[1] + m.m9 * v[2] + m.m13, m.m2 * v[0] + m.m6 * v[1] + m.m10 * v[2] + m.m14};
+    };
+
+    for (int32_t i = 0; i < mesh.triangleCount; i++)
+    {
+        auto a = vertex(mesh.indices ? mesh.indices[i * 3] : i * 3);
+        auto b = vertex(mesh.indices ? mesh.indices[i * 3 + 1] : i * 3 + 1);
+        auto c = vertex(mesh.indices ? mesh.indices[i * 3 + 2] : i * 3 + 2);
+
+        triangles.push_back({a, {b.x - a.x, b.y - a.y, b.z - a.z}, {c.x - a.x, c.y - a.y, c.z - a.z}});
+    }
+}
+
+/// @brief Builds the node hierarchy. Every split is chosen from RAYLIB64_BVH_BINS centroid bins per axis with the lowest SAH cost
+static uintptr_t ___bvh_build_raylib64(std::vector<___bvh_raylib64::Triangle> &&triangles)
+{
+    struct Bounds
+    {
+        float min[3] = {INFINITY, INFINITY, INFINITY};
+        float max[3] = {-INFINITY, -INFINITY, -INFINITY};
+
+        void grow(const float *p)
+        {
+            for (auto a = 0; a < 3; a++)
+            {
+                min[a] = std::min(min[a], p[a]);
+                max[a] = std::max(max[a], p[a]);
+            }
+        }
+
+        void grow(const Bounds &b)
+        {
+            if (b.min[0] <= b.max[0]) // skip empty bounds
+            {
+                grow(b.min);
+                grow(b.max);
+            }
+        }
+
+        float area() const
+        {
+            auto x = max[0] - min[0], y = max[1] - min[1], z = max[2] - min[2];
+            return x < 0.0f ? 0.0f : x * y + y * z + z * x;
+        }
+    };
+
+    auto bvh = new ___bvh_raylib64();
+    auto count = uint32_t(triangles.size());
+
+    // Per triangle bounds and centroid
+    std::vector<Bounds> bounds(count);
+    std::vector<Vector3> centroid(count);
+    std::vector<uint32_t> index(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto &t = triangles[i];
+        float v[3][3] = {{t.v0.x, t.v0.y, t.v0.z}, {t.v0.x + t.e1.x, t.v0.y + t.e1.y, t.v0.z + t.e1.z}, {t.v0.x + t.e2.x, t.v0.y + t.e2.y, t.v0.z + t.e2.z}};
+
+        for (auto &p : v)
+            bounds[i].grow(p);
+
+        centroid[i] = {(v[0][0] + v[1][0] + v[2][0]) / 3.0f, (v[0][1] + v[1][1] + v[2][1]) / 3.0f, (v[0][2] + v[1][2] + v[2][2]) / 3.0f};
+        index[i] = i;
+    }
+
+    bvh->nodes.reserve(count ? count * 2 - 1 : 1);
+    bvh->nodes.push_back({{0.0f, 0.0f, 0.0f}, 0, {0.0f, 0.0f, 0.0f}, count});
+
+    // Split nodes depth first with an explicit stack of (node, depth)
+    std::vector<std::pair<uint32_t, uint32_t>> stack = {{0, 1}};
+    while (!stack.empty())
+    {
+        auto n = stack.back().first, depth = stack.back().second;
+        stack.pop_back();
+
+        auto first = bvh->nodes[n].first, items = bvh->nodes[n].count;
+
+        Bounds box, centers;
+        for (auto i = first; i < first + items; i++)
+        {
+            box.grow(bounds[index[i]]);
+            centers.grow(&centroid[index[i]].x);
+        }
+
+        for (auto a = 0; a < 3; a++)
+        {
+            bvh->nodes[n].min[a] = box.min[a];
+            bvh->nodes[n].max[a] = box.max[a];
+        }
+
+        if (items <= RAYLIB64_BVH_LEAF_SIZE || depth >= RAYLIB64_BVH_MAX_DEPTH)
+            continue;
+
+        // Find the cheapest bin boundary on any axis
+        auto bestCost = box.area() * items, bestSplit = 0.0f; // cost of keeping this as a leaf
+        auto bestAxis = -1;
+
+        for (auto a = 0; a < 3; a++)
+        {
+            auto extent = centers.max[a] - centers.min[a];
+            if (extent <= 0.0f)
+                continue;
+
+            Bounds binBox[RAYLIB64_BVH_BINS];
+            uint32_t binCount[RAYLIB64_BVH_BINS] = {};
+            auto scale = RAYLIB64_BVH_BINS / extent;
+
+            for (auto i = first; i < first + items; i++)
+            {
+                auto b = std::min(int32_t(((&centroid[index[i]].x)[a] - centers.min[a]) * scale), RAYLIB64_BVH_BINS - 1);
+                binBox[b].grow(bounds[index[i]]);
+                binCount[b]++;
+            }
+
+            // Sweep from the right to get the cost of every right side, then from the left
+            float rightArea[RAYLIB64_BVH_BINS];
+            uint32_t rightCount[RAYLIB64_BVH_BINS];
+            Bounds right;
+            uint32_t sum = 0;
+            for (auto b = RAYLIB64_BVH_BINS - 1; b > 0; b--)
+            {
+                right.grow(binBox[b]);
+                sum += binCount[b];
+                rightArea[b] = right.area();
+                rightCount[b] = sum;
+            }
+
+            Bounds left;
+            sum = 0;
+            for (auto b = 0; b < RAYLIB64_BVH_BINS - 1; b++)
+            {
+                left.grow(binBox[b]);
+                sum += binCount[b];
+
+                auto cost = left.area() * sum + rightArea[b + 1] * rightCount[b + 1];
+                if (sum && rightCount[b + 1] && cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = a;
+                    bestSplit = centers.min[a] + extent * (b + 1) / RAYLIB64_BVH_BINS;
+                }
+            }
+        }
+
+        if (bestAxis < 0)
+            continue; // splitting does not pay off
+
+        // Partition the triangle indices around the split plane
+        auto mid = uint32_t(std::partition(index.begin() + first, index.begin() + first + items, [&](uint32_t i)
+                                           { return (&centroid[i].x)[bestAxis] < bestSplit; }) -
+                            index.begin());
+
+        auto left = uint32_t(bvh->nodes.size());
+        bvh->nodes.push_back({{0.0f, 0.0f, 0.0f}, first, {0.0f, 0.0f, 0.0f}, mid - first});
+        bvh->nodes.push_back({{0.0f, 0.0f, 0.0f}, mid, {0.0f, 0.0f, 0.0f}, first + items - mid});
+        bvh->nodes[n].first = left;
+        bvh->nodes[n].count = 0;
+
+        stack.push_back({left + 1, depth + 1});
+        stack.push_back({left, depth + 1});
+    }
+
+    bvh->triangles.resize(count);
+    for (uint32_t i = 0; i < count; i++)
+        bvh->triangles[i] = triangles[index[i]];
+
+    return (uintptr_t)bvh;
+}
+
+/// @brief Finds the closest triangle hit with t in (0, tMax]. Same triangle test as GetRayCollisionTriangle()
+static RayCollision ___bvh_intersect_raylib64(const ___bvh_raylib64 *bvh, const Ray &ray, float tMax)
+{
+    const auto EPSILON = 0.000001f;
+
+    RayCollision collision = {};
+    if (bvh->triangles.empty())
+        return collision;
+
+    auto &o = ray.position;
+    auto &d = ray.direction;
+    const float origin[3] = {o.x, o.y, o.z}, direction[3] = {d.x, d.y, d.z};
+    const float inv[3] = {1.0f / d.x, 1.0f / d.y, 1.0f / d.z};
+    auto best = tMax;
+    int32_t hit = -1;
+
+    uint32_t stack[RAYLIB64_BVH_MAX_DEPTH + 1];
+    auto top = 0;
+    stack[top++] = 0;
+
+    // Slab test returning the entry distance or INFINITY on a miss
+    auto enter = [&](const ___bvh_raylib64::Node &node)
+    {
+        auto tNear = -INFINITY, tFar = INFINITY;
+
+        for (auto a = 0; a < 3; a++)
+        {
+            // A ray parallel to the slab only needs its origin inside it. The slab math would give 0 * inf = NaN for an origin on a bound
+            if (direction[a] == 0.0f)
+            {
+                if (origin[a] < node.min[a] || origin[a] > node.max[a])
+                    return INFINITY;
+                continue;
+            }
+
+            auto t1 = (node.min[a] - origin[a]) * inv[a], t2 = (node.max[a] - origin[a]) * inv[a];
+            tNear = std::max(tNear, std::min(t1, t2)), tFar = std::min(tFar, std::max(t1, t2));
+        }
+
+        return tFar >= std::max(tNear, 0.0f) && tNear <= best ? tNear : INFINITY;
+    };
+
+    if (enter(bvh->nodes[0]) == INFINITY)
+        return collision;
+
+    while (top)
+    {
+        auto &node = bvh->nodes[stack[--top]];
+
+        if (node.count)
+        {
+            for (auto i = node.first; i < node.first + node.count; i++)
+            {
+                auto &tri = bvh->triangles[i];
+
+                // Möller-Trumbore
+                Vector3 p = {d.y * tri.e2.z - d.z * tri.e2.y, d.z * tri.e2.x - d.x * tri.e2.z, d.x * tri.e2.y - d.y * tri.e2.x};
+                auto det = tri.e1.x * p.x + tri.e1.y * p.y + tri.e1.z * p.z;
+                if (det > -EPSILON && det < EPSILON)
+                    continue;
+
+                auto invDet = 1.0f / det;
+                Vector3 s = {o.x - tri.v0.x, o.y - tri.v0.y, o.z - tri.v0.z};
+                auto u = (s.x * p.x + s.y * p.y + s.z * p.z) * invDet;
+                if (u < 0.0f || u > 1.0f)
+                    continue;
+
+                Vector3 q = {s.y * tri.e1.z - s.z * tri.e1.y, s.z * tri.e1.x - s.x * tri.e1.z, s.x * tri.e1.y - s.y * tri.e1.x};
+                auto v = (d.x * q.x + d.y * q.y + d.z * q.z) * invDet;
+                if (v < 0.0f || u + v > 1.0f)
+                    continue;
+
+                auto t = (tri.e2.x * q.x + tri.e2.y * q.y + tri.e2.z * q.z) * invDet;
+                if (t > EPSILON && t < best)
+                {
+                    best = t;
+                    hit = int32_t(i);
+                }
+            }
+        }
+        else
+        {
+            // Visit the nearer child first
+            auto &left = bvh->nodes[node.first], &right = bvh->nodes[node.first + 1];
+            auto tLeft = enter(left), tRight = enter(right);
+
+            if (tLeft > tRight)
+            {
+                std::swap(tLeft, tRight);
+                if (tLeft != INFINITY)
+                {
+                    if (tRight != INFINITY)
+                        stack[top++] = node.first;
+                    stack[top++] = node.first + 1;
+                }
+            }
+            else if (tLeft != INFINITY)
+            {
+                if (tRight != INFINITY)
+                    stack[top++] = node.first + 1;
+                stack[top++] = node.first;
+            }
+        }
+    }
+
+    if (hit >= 0)
+    {
+        auto &tri = bvh->triangles[hit];
+        Vector3 n = {tri.e1.y * tri.e2.z - tri.e1.z * tri.e2.y, tri.e1.z * tri.e2.x - tri.e1.x * tri.e2.z, tri.e1.x * tri.e2.y - tri.e1.y * tri.e2.x};
+        auto length = sqrtf(n.x * n.x + n.y * n.y + n.z * n.z);
+        if (length > 0.0f)
+            n = {n.x / length, n.y / length, n.z / length};
+
+        collision.hit = true;
+        collision.distance = best;
+        collision.point = {o.x + d.x * best, o.y + d.y * best, o.z + d.z * best};
+        collision.normal = n;
+    }
+
+    return collision;
+}
+
+/// @brief Builds a BVH from the triangles of a mesh. The BVH is a snapshot; rebuild it if the mesh or transform changes
+/// @param mesh The mesh
+/// @param transform The mesh transform (same as for GetRayCollisionMesh())
+/// @return A BVH handle. Free it with UnloadBVH()
+inline uintptr_t LoadMeshBVH(void *mesh, void *transform)
+{
+    std::vector<___bvh_raylib64::Triangle> triangles;
+    ___bvh_add_mesh_raylib64(triangles, *(const Mesh *)mesh, *(const Matrix *)transform);
+
+    return ___bvh_build_raylib64(std::move(triangles));
+}
+
+/// @brief Builds a single BVH from all meshes of a model, transformed by the model transform
+/// @param model The model
+/// @return A BVH handle. Free it with UnloadBVH()
+inline uintptr_t LoadModelBVH(void *model)
+{
+    auto m = (const Model *)model;
+    std::vector<___bvh_raylib64::Triangle> triangles;
+
+    for (int32_t i = 0; i < m->meshCount; i++)
+        ___bvh_add_mesh_raylib64(triangles, m->meshes[i], m->transform);
+
+    return ___bvh_build_raylib64(std::move(triangles));
+}
+
+/// @brief Frees a BVH created by LoadMeshBVH() or LoadModelBVH()
+/// @param bvh The BVH handle
+inline void UnloadBVH(uintptr_t bvh)
+{
+    delete (___bvh_raylib64 *)bvh;
+}
+
+/// @brief Gets collision info between a ray and the triangles of a BVH. Same result as GetRayCollisionMesh() without testing every triangle
+/// @param bvh The BVH handle
+/// @param ray The ray
+/// @param retVal Receives the RayCollision of the nearest hit
+inline void GetRayCollisionBVH(uintptr_t bvh, void *ray, void *retVal)
+{
+    *(RayCollision *)retVal = ___bvh_intersect_raylib64((const ___bvh_raylib64 *)bvh, *(const Ray *)ray, INFINITY);
+}
+
+/// @brief Gets collision info between a line segment and the triangles of a BVH
+/// @param bvh The BVH handle
+/// @param startPos The segment start
+/// @param endPos The segment end
+/// @param retVal Receives the RayCollision of the hit nearest to startPos. The distance is measured from startPos in world units
+inline void GetSegmentCollisionBVH(uintptr_t bvh, void *startPos, void *endPos, void *retVal)
+{
+    auto a = *(const Vector3 *)startPos, b = *(const Vector3 *)endPos;
+    Ray ray = {a, {b.x - a.x, b.y - a.y, b.z - a.z}};
+
+    auto collision = ___bvh_intersect_raylib64((const ___bvh_raylib64 *)bvh, ray, 1.0f);
+    collision.distance *= sqrtf(ray.direction.x * ray.direction.x + ray.direction.y * ray.direction.y + ray.direction.z * ray.direction.z);
+
+    *(RayCollision *)retVal = collision;
+}
+
+/// @brief Returns the number of triangles in a BVH
+/// @param bvh The BVH handle
+/// @return The triangle count
+inline int32_t GetBVHTriangleCount(uintptr_t bvh)
+{
+    return int32_t(((const ___bvh_raylib64 *)bvh)->triangles.size());
+}
+
+/// @brief The six inward facing planes (n.x, n.y, n.z, d) of a camera's view volume. A point p is inside a plane when dot(n, p) + d >= 0
+struct ___frustum_raylib64
+{
+    float plane[6][4];
+};
+
+static ___frustum_raylib64 ___camera_frustum_raylib64(const Camera3D &camera, float aspect, float nearPlane, float farPlane)
+{
+    auto normalize = [](Vector3 v)
+    {
+        auto length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+        return length > 0.0f ? Vector3{v.x / length, v.y / length, v.z / length} : v;
+    };
+    auto cross = [](Vector3 a, Vector3 b)
+    { return Vector3{a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; };
+
+    auto &p = camera.position;
+    auto forward = normalize({camera.target.x - p.x, camera.target.y - p.y, camera.target.z - p.z});
+    auto right = normalize(cross(forward, camera.up));
+    auto up = cross(right, forward);
+
+    ___frustum_raylib64 f;
+    auto set = [&](int32_t i, Vector3 n, float d)
+    {
+        f.plane[i][0] = n.x;
+        f.plane[i][1] = n.y;
+        f.plane[i][2] = n.z;
+        f.plane[i][3] = d;
+    };
+    auto dot = [](Vector3 a, Vector3 b)
+    { return a.x * b.x + a.y * b.y + a.z * b.z; };
+
+    set(0, forward, -dot(forward, p) - nearPlane);
+    set(1, {-forward.x, -forward.y, -forward.z}, dot(forward, p) + farPlane);
+
+    if (camera.projection == 1) // CAMERA_ORTHOGRAPHIC: fovy is the view height (same as BeginMode3D())
+    {
+        auto halfHeight = camera.fovy * 0.5f, halfWidth = halfHeight * aspect;
+
+        set(2, right, -dot(right, p) + halfWidth);
+        set(3, {-right.x, -right.y, -right.z}, dot(right, p) + halfWidth);
+        set(4, up, -dot(up, p) + halfHeight);
+        set(5, {-up.x, -up.y, -up.z}, dot(up, p) + halfHeight);
+    }
+    else
+    {
+        auto halfHeight = tanf(camera.fovy * 0.5f * 3.14159265358979f / 180.0f), halfWidth = halfHeight * aspect;
+
+        Vector3 n[4] = {normalize({right.x + forward.x * halfWidth, right.y + forward.y * halfWidth, right.z + forward.z * halfWidth}),
+                        normalize({-right.x + forward.x * halfWidth, -right.y + forward.y * halfWidth, -right.z + forward.z * halfWidth}),
+                        normalize({up.x + forward.x * halfHeight, up.y + forward.y * halfHeight, up.z + forward.z * halfHeight}),
+                        normalize({-up.x + forward.x * halfHeight, -up.y + forward.y * halfHeight, -up.z + forward.z * halfHeight})};
+
+        for (auto i = 0; i < 4; i++)
+            set(i + 2, n[i], -dot(n[i], p));
+    }
+
+    return f;
+}
+
+/// @brief Tests count boxes or spheres against a frustum, 4 at a time, and calls visible(i) for each one that is at least partly inside
+/// @param spheres False: a points to BoundingBox min and b to max. True: a points to the Vector3 center and b to the SINGLE radius
+template <bool spheres, typename Visible>
+static void ___cull_raylib64(const ___frustum_raylib64 &f, uintptr_t a, uintptr_t b, size_t stride, int32_t count, Visible visible)
+{
+    int32_t i = 0;
+
+#if defined(RAYLIB64_SSE2)
+    // Planes and box corner selection are the same for every object, so each plane test is a 4-wide multiply-add over 4 objects
+    for (; i + 4 <= count; i += 4)
+    {
+        alignas(16) float lo[3][4], hi[3][4];
+        for (auto k = 0; k < 4; k++)
+        {
+            auto p = (const float *)(a + (i + k) * stride);
+            auto q = (const float *)(b + (i + k) * stride);
+            for (auto c = 0; c < 3; c++)
+            {
+                lo[c][k] = p[c];
+                hi[c][k] = spheres ? -fabsf(q[0]) : q[c]; // spheres: hi holds -radius in every lane
+            }
+        }
+
+        auto inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (auto pl = 0; pl < 6; pl++)
+        {
+            auto &n = f.plane[pl];
+            __m128 distance;
+
+            if (spheres)
+            {
+                distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(n[0]), _mm_load_ps(lo[0])), _mm_mul_ps(_mm_set1_ps(n[1]), _mm_load_ps(lo[1]))),
+                                      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(n[2]), _mm_load_ps(lo[2])), _mm_set1_ps(n[3])));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_load_ps(hi[0])));
+            }
+            else
+            {
+                // Corner furthest along the plane normal
+                auto x = _mm_load_ps(n[0] >= 0.0f ? hi[0] : lo[0]), y = _mm_load_ps(n[1] >= 0.0f ? hi[1] : lo[1]), z = _mm_load_ps(n[2] >= 0.0f ? hi[2] : lo[2]);
+                distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(n[0]), x), _mm_mul_ps(_mm_set1_ps(n[1]), y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(n[2]), z), _mm_set1_ps(n[3])));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+            }
+        }
+
+        auto mask = _mm_movemask_ps(inside);
+        for (auto k = 0; k < 4; k++)
+        {
+            if (mask & (1 << k))
+                visible(i + k);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        auto p = (const float *)(a + i * stride);
+        auto q = (const float *)(b + i * stride);
+        auto inside = true;
+
+        for (auto pl = 0; pl < 6 && inside; pl++)
+        {
+            auto &n = f.plane[pl];
+
+            if (spheres)
+                inside = n[0] * p[0] + n[1] * p[1] + n[2] * p[2] + n[3] >= -fabsf(q[0]);
+            else
+                inside = n[0] * (n[0] >= 0.0f ? q[0] : p[0]) + n[1] * (n[1] >= 0.0f ? q[1] : p[1]) + n[2] * (n[2] >= 0.0f ? q[2] : p[2]) + n[3] >= 0.0f;
+        }
+
+        if (inside)
+            visible(i);
+    }
+}
+
+/// @brief Finds the bounding boxes that are at least partly inside a camera's view
+/// @param camera The camera
+/// @param aspect The view aspect ratio (width / height)
+/// @param nearPlane The near clip distance (e.g. 0.01)
+/// @param farPlane The far clip distance (e.g. 1000.0)
+/// @param boxes Pointer to the first BoundingBox
+/// @param stride Bytes between consecutive boxes (LEN of the UDT)
+/// @param count The number of boxes
+/// @param indices Receives the LONG index of every visible box, in order
+/// @return The number of visible boxes
+inline int32_t GetVisibleBoundingBoxes(void *camera, float aspect, float nearPlane, float farPlane, uintptr_t boxes, size_t stride, int32_t count, void *indices)
+{
+    auto out = (int32_t *)indices;
+    int32_t visible = 0;
+
+    ___cull_raylib64<false>(___camera_frustum_raylib64(*(const Camera3D *)camera, aspect, nearPlane, farPlane), boxes, boxes + sizeof(Vector3), stride, count, [&](int32_t i)
+                            { out[visible++] = i; });
+
+    return visible;
+}
+
+/// @brief Computes a visibility mask for bounding boxes
+/// @param camera The camera
+/// @param aspect The view aspect ratio (width / height)
+/// @param nearPlane The near clip distance
+/// @param farPlane The far clip distance
+/// @param boxes Pointer to the first BoundingBox
+/// @param stride Bytes between consecutive boxes (LEN of the UDT)
+/// @param count The number of boxes
+/// @param mask Receives a _BYTE per box: true (-1) when visible or false (0)
+/// @return The number of visible boxes
+inline int32_t GetBoundingBoxesVisibility(void *camera, float aspect, float nearPlane, float farPlane, uintptr_t boxes, size_t stride, int32_t count, void *mask)
+{
+    auto out = (qb_bool *)mask;
+    int32_t visible = 0;
+
+    memset(out, QB_FALSE, count > 0 ? count : 0);
+    ___cull_raylib64<false>(___camera_frustum_raylib64(*(const Camera3D *)camera, aspect, nearPlane, farPlane), boxes, boxes + sizeof(Vector3), stride, count, [&](int32_t i)
+                            { out[i] = QB_TRUE, visible++; });
+
+    return visible;
+}
+
+/// @brief Finds the spheres that are at least partly inside a camera's view
+/// @param camera The camera
+/// @param aspect The view aspect ratio (width / height)
+/// @param nearPlane The near clip distance
+/// @param farPlane The far clip distance
+/// @param centers Pointer to the first Vector3 center
+/// @param radii Pointer to the first SINGLE radius
+/// @param stride Bytes between consecutive spheres (LEN of the UDT)
+/// @param count The number of spheres
+/// @param indices Receives the LONG index of every visible sphere, in order
+/// @return The number of visible spheres
+inline int32_t GetVisibleSpheres(void *camera, float aspect, float nearPlane, float farPlane, uintptr_t centers, uintptr_t radii, size_t stride, int32_t count, void *indices)
+{
+    auto out = (int32_t *)indices;
+    int32_t visible = 0;
+
+    ___cull_raylib64<true>(___camera_frustum_raylib64(*(const Camera3D *)camera, aspect, nearPlane, farPlane), centers, radii, stride, count, [&](int32_t i)
+                           { out[visible++] = i; });
+
+    return visible;
+}
+
+/// @brief Computes a visibility mask for spheres
+/// @param camera The camera
+/// @param aspect The view aspect ratio (width / height)
+/// @param nearPlane The near clip distance
+/// @param farPlane The far clip distance
+/// @param centers Pointer to the first Vector3 center
+/// @param radii Pointer to the first SINGLE radius
+/// @param stride Bytes between consecutive spheres (LEN of the UDT)
+/// @param count The number of spheres
+/// @param mask Receives a _BYTE per sphere: true (-1) when visible or false (0)
+/// @return The number of visible spheres
+inline int32_t GetSpheresVisibility(void *camera, float aspect, float nearPlane, float farPlane, uintptr_t centers, uintptr_t radii, size_t stride, int32_t count, void *mask)
+{
+    auto out = (qb_bool *)mask;
+    int32_t visible = 0;
+
+    memset(out, QB_FALSE, count > 0 ? count : 0);
+    ___cull_raylib64<true>(___camera_frustum_raylib64(*(const Camera3D *)camera, aspect, nearPlane, farPlane), centers, radii, stride, count, [&](int32_t i)
+                           { out[i] = QB_TRUE, visible++; });
+
+    return visible;
 }
 
 // Get collision info between ray and triangle
 inline void GetRayCollisionTriangle(void *ray, void *p1, void *p2, void *p3, void *retVal)
 {
-    *(RayCollision *)retVal = _GetRayCollisionTriangle(*(Ray *)ray, *(Vector3 *)p1, *(Vector3 *)p2, *(Vector3 *)p3);
+    *(RayCollision *)retVal = RAYLIB64_CALL(GetRayCollisionTriangle)(*(Ray *)ray, *(Vector3 *)p1, *(Vector3 *)p2, *(Vector3 *)p3);
 }
 
 // Get collision info between ray and quad
 inline void GetRayCollisionQuad(void *ray, void *p1, void *p2, void *p3, void *p4, void *retVal)
 {
-    *(RayCollision *)retVal = _GetRayCollisionQuad(*(Ray *)ray, *(Vector3 *)p1, *(Vector3 *)p2, *(Vector3 *)p3, *(Vector3 *)p4);
+    *(RayCollision *)retVal = RAYLIB64_CALL(GetRayCollisionQuad)(*(Ray *)ray, *(Vector3 *)p1, *(Vector3 *)p2, *(Vector3 *)p3, *(Vector3 *)p4);
 }
 
 // Initialize audio device and context
 inline void InitAudioDevice()
 {
-    _InitAudioDevice();
+    RAYLIB64_CALL(InitAudioDevice)();
 }
 
 // Close the audio device and context
 inline void CloseAudioDevice()
 {
-    _CloseAudioDevice();
+    RAYLIB64_CALL(CloseAudioDevice)();
 }
 
 // Check if audio device has been initialized successfully
 inline qb_bool IsAudioDeviceReady()
 {
-    return TO_QB_BOOL(_IsAudioDeviceReady());
+    return TO_QB_BOOL(RAYLIB64_CALL(IsAudioDeviceReady)());
 }
 
 // Set master volume (listener)
 inline void SetMasterVolume(float volume)
 {
-    _SetMasterVolume(volume);
+    RAYLIB64_CALL(SetMasterVolume)(volume);
 }
 
 // Get master volume (listener)
 inline float GetMasterVolume()
 {
-    return _GetMasterVolume();
+    return RAYLIB64_CALL(GetMasterVolume)();
 }
 
 // Load wave data from file
-inline void LoadWave(char *fileName, void *retVal)
+inline void LoadWave(uintptr_t fileName, void *retVal)
 {
-    *(Wave *)retVal = _LoadWave(fileName);
+    *(Wave *)retVal = RAYLIB64_CALL(LoadWave)((char *)fileName);
 }
 
 // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
-inline void LoadWaveFromMemory(char *fileType, uintptr_t fileData, int dataSize, void *retVal)
+inline void LoadWaveFromMemory(uintptr_t fileType, uintptr_t fileData, int dataSize, void *retVal)
 {
-    *(Wave *)retVal = _LoadWaveFromMemory(fileType, (unsigned char *)fileData, dataSize);
+    *(Wave *)retVal = RAYLIB64_CALL(LoadWaveFromMemory)((char *)fileType, (unsigned char *)fileData, dataSize);
 }
 
 // Checks if wave data is ready
 inline qb_bool IsWaveReady(void *wave)
 {
-    return TO_QB_BOOL(_IsWaveReady(*(Wave *)wave));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsWaveReady)(*(Wave *)wave));
 }
 
 // Load sound from file
-inline void LoadSound(char *fileName, void *retVal)
+inline void LoadSound(uintptr_t fileName, void *retVal)
 {
-    *(RSound *)retVal = _LoadSound(fileName);
+    *(RSound *)retVal = RAYLIB64_CALL(LoadSound)((char *)fileName);
 }
 
 // Load sound from wave data
 inline void LoadSoundFromWave(void *wave, void *retVal)
 {
-    *(RSound *)retVal = _LoadSoundFromWave(*(Wave *)wave);
+    *(RSound *)retVal = RAYLIB64_CALL(LoadSoundFromWave)(*(Wave *)wave);
 }
 
 // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 inline void LoadSoundAlias(void *source, void *retVal)
 {
-    *(RSound *)retVal = _LoadSoundAlias(*(RSound *)source);
+    *(RSound *)retVal = RAYLIB64_CALL(LoadSoundAlias)(*(RSound *)source);
 }
 
 // Checks if a sound is ready
 inline qb_bool IsSoundReady(void *sound)
 {
-    return TO_QB_BOOL(_IsSoundReady(*(RSound *)sound));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsSoundReady)(*(RSound *)sound));
 }
 
 // Update sound buffer with new data
 inline void UpdateSound(void *sound, uintptr_t data, int sampleCount)
 {
-    _UpdateSound(*(RSound *)sound, (void *)data, sampleCount);
+    RAYLIB64_CALL(UpdateSound)(*(RSound *)sound, (void *)data, sampleCount);
 }
 
 // Unload wave data
 inline void UnloadWave(void *wave)
 {
-    _UnloadWave(*(Wave *)wave);
+    RAYLIB64_CALL(UnloadWave)(*(Wave *)wave);
 }
 
 // Unload sound
 inline void UnloadSound(void *sound)
 {
-    _UnloadSound(*(RSound *)sound);
+    RAYLIB64_CALL(UnloadSound)(*(RSound *)sound);
 }
 
 // Unload a sound alias (does not deallocate sample data)
 inline void UnloadSoundAlias(void *alias)
 {
-    _UnloadSoundAlias(*(RSound *)alias);
+    RAYLIB64_CALL(UnloadSoundAlias)(*(RSound *)alias);
 }
 
 // Export wave data to file, returns true on success
-inline qb_bool ExportWave(void *wave, char *fileName)
+inline qb_bool ExportWave(void *wave, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportWave(*(Wave *)wave, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportWave)(*(Wave *)wave, (char *)fileName));
 }
 
 // Export wave sample data to code (.h), returns true on success
-inline qb_bool ExportWaveAsCode(void *wave, char *fileName)
+inline qb_bool ExportWaveAsCode(void *wave, uintptr_t fileName)
 {
-    return TO_QB_BOOL(_ExportWaveAsCode(*(Wave *)wave, fileName));
+    return TO_QB_BOOL(RAYLIB64_CALL(ExportWaveAsCode)(*(Wave *)wave, (char *)fileName));
 }
 
 // Play a sound
 inline void PlaySound(void *sound)
 {
-    _PlaySound(*(RSound *)sound);
+    RAYLIB64_CALL(PlaySound)(*(RSound *)sound);
 }
 
 // Stop playing a sound
 inline void StopSound(void *sound)
 {
-    _StopSound(*(RSound *)sound);
+    RAYLIB64_CALL(StopSound)(*(RSound *)sound);
 }
 
 // Pause a sound
 inline void PauseSound(void *sound)
 {
-    _PauseSound(*(RSound *)sound);
+    RAYLIB64_CALL(PauseSound)(*(RSound *)sound);
 }
 
 // Resume a paused sound
 inline void ResumeSound(void *sound)
 {
-    _ResumeSound(*(RSound *)sound);
+    RAYLIB64_CALL(ResumeSound)(*(RSound *)sound);
 }
 
 // Check if a sound is currently playing
 inline qb_bool IsSoundPlaying(void *sound)
 {
-    return TO_QB_BOOL(_IsSoundPlaying(*(RSound *)sound));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsSoundPlaying)(*(RSound *)sound));
 }
 
 // Set volume for a sound (1.0 is max level)
 inline void SetSoundVolume(void *sound, float volume)
 {
-    _SetSoundVolume(*(RSound *)sound, volume);
+    RAYLIB64_CALL(SetSoundVolume)(*(RSound *)sound, volume);
 }
 
 // Set pitch for a sound (1.0 is base level)
 inline void SetSoundPitch(void *sound, float pitch)
 {
-    _SetSoundPitch(*(RSound *)sound, pitch);
+    RAYLIB64_CALL(SetSoundPitch)(*(RSound *)sound, pitch);
 }
 
 // Set pan for a sound (0.5 is center)
 inline void SetSoundPan(void *sound, float pan)
 {
-    _SetSoundPan(*(RSound *)sound, pan);
+    RAYLIB64_CALL(SetSoundPan)(*(RSound *)sound, pan);
 }
 
 // Copy a wave to a new wave
 inline void WaveCopy(void *wave, void *retVal)
 {
-    *(Wave *)retVal = _WaveCopy(*(Wave *)wave);
+    *(Wave *)retVal = RAYLIB64_CALL(WaveCopy)(*(Wave *)wave);
 }
 
 // Crop a wave to defined samples range
 inline void WaveCrop(void *wave, int initSample, int finalSample)
 {
-    _WaveCrop((Wave *)wave, initSample, finalSample);
+    RAYLIB64_CALL(WaveCrop)((Wave *)wave, initSample, finalSample);
 }
 
 // Convert wave data to desired format
 inline void WaveFormat(void *wave, int sampleRate, int sampleSize, int channels)
 {
-    _WaveFormat((Wave *)wave, sampleRate, sampleSize, channels);
+    RAYLIB64_CALL(WaveFormat)((Wave *)wave, sampleRate, sampleSize, channels);
 }
 
 // Load samples data from wave as a 32bit float data array
 inline void *LoadWaveSamples(void *wave)
 {
-    return _LoadWaveSamples(*(Wave *)wave);
+    return RAYLIB64_CALL(LoadWaveSamples)(*(Wave *)wave);
 }
 
 // Unload samples data loaded with LoadWaveSamples()
 inline void UnloadWaveSamples(uintptr_t samples)
 {
-    _UnloadWaveSamples((float *)samples);
+    RAYLIB64_CALL(UnloadWaveSamples)((float *)samples);
 }
 
 // Load music stream from file
-inline void LoadMusicStream(char *fileName, void *retVal)
+inline void LoadMusicStream(uintptr_t fileName, void *retVal)
 {
-    *(Music *)retVal = _LoadMusicStream(fileName);
+    *(Music *)retVal = RAYLIB64_CALL(LoadMusicStream)((char *)fileName);
 }
 
 // Load music stream from data
-inline void LoadMusicStreamFromMemory(char *fileType, uintptr_t data, int dataSize, void *retVal)
+inline void LoadMusicStreamFromMemory(uintptr_t fileType, uintptr_t data, int dataSize, void *retVal)
 {
-    *(Music *)retVal = _LoadMusicStreamFromMemory(fileType, (unsigned char *)data, dataSize);
+    *(Music *)retVal = RAYLIB64_CALL(LoadMusicStreamFromMemory)((char *)fileType, (unsigned char *)data, dataSize);
 }
 
 // Checks if a music stream is ready
 inline qb_bool IsMusicReady(void *music)
 {
-    return TO_QB_BOOL(_IsMusicReady(*(Music *)music));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMusicReady)(*(Music *)music));
 }
 
 // Unload music stream
 inline void UnloadMusicStream(void *music)
 {
-    _UnloadMusicStream(*(Music *)music);
+    RAYLIB64_CALL(UnloadMusicStream)(*(Music *)music);
 }
 
 // Start music playing
 inline void PlayMusicStream(void *music)
 {
-    _PlayMusicStream(*(Music *)music);
+    RAYLIB64_CALL(PlayMusicStream)(*(Music *)music);
 }
 
 // Check if music is playing
 inline qb_bool IsMusicStreamPlaying(void *music)
 {
-    return TO_QB_BOOL(_IsMusicStreamPlaying(*(Music *)music));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsMusicStreamPlaying)(*(Music *)music));
 }
 
 // Updates buffers for music streaming
 inline void UpdateMusicStream(void *music)
 {
-    _UpdateMusicStream(*(Music *)music);
+    RAYLIB64_CALL(UpdateMusicStream)(*(Music *)music);
 }
 
 // Stop music playing
 inline void StopMusicStream(void *music)
 {
-    _StopMusicStream(*(Music *)music);
+    RAYLIB64_CALL(StopMusicStream)(*(Music *)music);
 }
 
 // Pause music playing
 inline void PauseMusicStream(void *music)
 {
-    _PauseMusicStream(*(Music *)music);
+    RAYLIB64_CALL(PauseMusicStream)(*(Music *)music);
 }
 
 // Resume playing paused music
 inline void ResumeMusicStream(void *music)
 {
-    _ResumeMusicStream(*(Music *)music);
+    RAYLIB64_CALL(ResumeMusicStream)(*(Music *)music);
 }
 
 // Seek music to a position (in seconds)
 inline void SeekMusicStream(void *music, float position)
 {
-    _SeekMusicStream(*(Music *)music, position);
+    RAYLIB64_CALL(SeekMusicStream)(*(Music *)music, position);
 }
 
 // Set volume for music (1.0 is max level)
 inline void SetMusicVolume(void *music, float volume)
 {
-    _SetMusicVolume(*(Music *)music, volume);
+    RAYLIB64_CALL(SetMusicVolume)(*(Music *)music, volume);
 }
 
 // Set pitch for a music (1.0 is base level)
 inline void SetMusicPitch(void *music, float pitch)
 {
-    _SetMusicPitch(*(Music *)music, pitch);
+    RAYLIB64_CALL(SetMusicPitch)(*(Music *)music, pitch);
 }
 
 // Set pan for a music (0.5 is center)
 inline void SetMusicPan(void *music, float pan)
 {
-    _SetMusicPan(*(Music *)music, pan);
+    RAYLIB64_CALL(SetMusicPan)(*(Music *)music, pan);
 }
 
 // Get music time length (in seconds)
 inline float GetMusicTimeLength(void *music)
 {
-    return _GetMusicTimeLength(*(Music *)music);
+    return RAYLIB64_CALL(GetMusicTimeLength)(*(Music *)music);
 }
 
 // Get current music time played (in seconds)
 inline float GetMusicTimePlayed(void *music)
 {
-    return _GetMusicTimePlayed(*(Music *)music);
+    return RAYLIB64_CALL(GetMusicTimePlayed)(*(Music *)music);
 }
 
 // Load audio stream (to stream raw audio pcm data)
 inline void LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, void *retVal)
 {
-    *(AudioStream *)retVal = _LoadAudioStream(sampleRate, sampleSize, channels);
+    *(AudioStream *)retVal = RAYLIB64_CALL(LoadAudioStream)(sampleRate, sampleSize, channels);
 }
 
 // Checks if an audio stream is ready
 inline qb_bool IsAudioStreamReady(void *stream)
 {
-    return TO_QB_BOOL(_IsAudioStreamReady(*(AudioStream *)stream));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsAudioStreamReady)(*(AudioStream *)stream));
 }
 
 // Unload audio stream and free memory
 inline void UnloadAudioStream(void *stream)
 {
-    _UnloadAudioStream(*(AudioStream *)stream);
+    RAYLIB64_CALL(UnloadAudioStream)(*(AudioStream *)stream);
 }
 
 // Update audio stream buffers with data
 inline void UpdateAudioStream(void *stream, uintptr_t data, int frameCount)
 {
-    _UpdateAudioStream(*(AudioStream *)stream, (void *)data, frameCount);
+    RAYLIB64_CALL(UpdateAudioStream)(*(AudioStream *)stream, (void *)data, frameCount);
 }
 
 // Check if any audio stream buffers requires refill
 inline qb_bool IsAudioStreamProcessed(void *stream)
 {
-    return TO_QB_BOOL(_IsAudioStreamProcessed(*(AudioStream *)stream));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsAudioStreamProcessed)(*(AudioStream *)stream));
 }
 
 // Play audio stream
 inline void PlayAudioStream(void *stream)
 {
-    _PlayAudioStream(*(AudioStream *)stream);
+    RAYLIB64_CALL(PlayAudioStream)(*(AudioStream *)stream);
 }
 
 // Pause audio stream
 inline void PauseAudioStream(void *stream)
 {
-    _PauseAudioStream(*(AudioStream *)stream);
+    RAYLIB64_CALL(PauseAudioStream)(*(AudioStream *)stream);
 }
 
 // Resume audio stream
 inline void ResumeAudioStream(void *stream)
 {
-    _ResumeAudioStream(*(AudioStream *)stream);
+    RAYLIB64_CALL(ResumeAudioStream)(*(AudioStream *)stream);
 }
 
 // Check if audio stream is playing
 inline qb_bool IsAudioStreamPlaying(void *stream)
 {
-    return TO_QB_BOOL(_IsAudioStreamPlaying(*(AudioStream *)stream));
+    return TO_QB_BOOL(RAYLIB64_CALL(IsAudioStreamPlaying)(*(AudioStream *)stream));
 }
 
 // Stop audio stream
 inline void StopAudioStream(void *stream)
 {
-    _StopAudioStream(*(AudioStream *)stream);
+    RAYLIB64_CALL(StopAudioStream)(*(AudioStream *)stream);
 }
 
 // Set volume for audio stream (1.0 is max level)
 inline void SetAudioStreamVolume(void *stream, float volume)
 {
-    _SetAudioStreamVolume(*(AudioStream *)stream, volume);
+    RAYLIB64_CALL(SetAudioStreamVolume)(*(AudioStream *)stream, volume);
 }
 
 // Set pitch for audio stream (1.0 is base level)
 inline void SetAudioStreamPitch(void *stream, float pitch)
 {
-    _SetAudioStreamPitch(*(AudioStream *)stream, pitch);
+    RAYLIB64_CALL(SetAudioStreamPitch)(*(AudioStream *)stream, pitch);
 }
 
 // Set pan for audio stream (0.5 is centered)
 inline void SetAudioStreamPan(void *stream, float pan)
 {
-    _SetAudioStreamPan(*(AudioStream *)stream, pan);
+    RAYLIB64_CALL(SetAudioStreamPan)(*(AudioStream *)stream, pan);
 }
 
 // Default size for new audio streams
 inline void SetAudioStreamBufferSizeDefault(int size)
 {
-    _SetAudioStreamBufferSizeDefault(size);
+    RAYLIB64_CALL(SetAudioStreamBufferSizeDefault)(size);
 }
 
 // Audio thread callback to request new data
 inline void SetAudioStreamCallback(void *stream, void *callback)
 {
-    _SetAudioStreamCallback(*(AudioStream *)stream, (AudioCallback)callback);
+    RAYLIB64_CALL(SetAudioStreamCallback)(*(AudioStream *)stream, (AudioCallback)callback);
 }
 
 // Attach audio stream processor to stream, receives the samples as <float>s
 inline void AttachAudioStreamProcessor(void *stream, void *processor)
 {
-    _AttachAudioStreamProcessor(*(AudioStream *)stream, (AudioCallback)processor);
+    RAYLIB64_CALL(AttachAudioStreamProcessor)(*(AudioStream *)stream, (AudioCallback)processor);
 }
 
 // Detach audio stream processor from stream
 inline void DetachAudioStreamProcessor(void *stream, void *processor)
 {
-    _DetachAudioStreamProcessor(*(AudioStream *)stream, (AudioCallback)processor);
+    RAYLIB64_CALL(DetachAudioStreamProcessor)(*(AudioStream *)stream, (AudioCallback)processor);
 }
 
 // Attach audio stream processor to the entire audio pipeline, receives the samples as <float>s
 inline void AttachAudioMixedProcessor(void *processor)
 {
-    _AttachAudioMixedProcessor((AudioCallback)processor);
+    RAYLIB64_CALL(AttachAudioMixedProcessor)((AudioCallback)processor);
 }
 
 // Detach audio stream processor from the entire audio pipeline
 inline void DetachAudioMixedProcessor(void *processor)
 {
-    _DetachAudioMixedProcessor((AudioCallback)processor);
+    RAYLIB64_CALL(DetachAudioMixedProcessor)((AudioCallback)processor);
 }
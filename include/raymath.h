@@ -673,3 +673,724 @@ inline void __MatrixDecompose(void *mat, void *translation, void *rotation, void
 {
     MatrixDecompose(*(Matrix *)mat, (Vector3 *)translation, (Quaternion *)rotation, (Vector3 *)scale);
 }
+
+// Array variants of the raymath functions above. They work on packed QB64 arrays (pass the first element) and use SSE2 or AVX2 when the CPU has it
+// SIMD level: 0 = scalar, 1 = SSE2, 2 = AVX2
+#if defined(RAYLIB64_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RAYLIB64_AVX2 1
+#define RAYLIB64_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+inline int32_t ___get_cpu_simd_level_raymath64()
+{
+#if defined(RAYLIB64_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return 2;
+#endif
+#if defined(RAYLIB64_SSE2)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+inline int32_t &___simd_level_raymath64()
+{
+    static int32_t level = ___get_cpu_simd_level_raymath64();
+    return level;
+}
+
+/// @brief Returns the SIMD level used by the array functions (0 = scalar, 1 = SSE2, 2 = AVX2)
+inline int32_t __GetMathArraySIMDLevel()
+{
+    return ___simd_level_raymath64();
+}
+
+/// @brief Limits the SIMD level used by the array functions. Levels the CPU does not support are clamped
+/// @param level 0 = scalar, 1 = SSE2, 2 = AVX2
+inline void __SetMathArraySIMDLevel(int32_t level)
+{
+    ___simd_level_raymath64() = std::clamp(level, 0, ___get_cpu_simd_level_raymath64());
+}
+
+#if defined(RAYLIB64_SSE2)
+// AoS <-> SoA for 4 packed Vector3 (a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3)
+inline void ___vector3_to_soa_raymath64(__m128 a, __m128 b, __m128 c, __m128 &x, __m128 &y, __m128 &z)
+{
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+inline void ___vector3_from_soa_raymath64(__m128 x, __m128 y, __m128 z, __m128 &a, __m128 &b, __m128 &c)
+{
+    a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+#endif
+
+#if defined(RAYLIB64_AVX2)
+// Same as above per 128-bit lane. The low lane holds vectors 0-3 and the high lane vectors 4-7
+RAYLIB64_AVX2_TARGET inline void ___vector3_load8_raymath64(const float *p, __m256 &x, __m256 &y, __m256 &z)
+{
+    auto a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+    auto b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+    auto c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+    x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+RAYLIB64_AVX2_TARGET inline void ___vector3_store8_raymath64(float *p, __m256 x, __m256 y, __m256 z)
+{
+    auto a = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    auto b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    auto c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm_storeu_ps(p, _mm256_castps256_ps128(a));
+    _mm_storeu_ps(p + 4, _mm256_castps256_ps128(b));
+    _mm_storeu_ps(p + 8, _mm256_castps256_ps128(c));
+    _mm_storeu_ps(p + 12, _mm256_extractf128_ps(a, 1));
+    _mm_storeu_ps(p + 16, _mm256_extractf128_ps(b, 1));
+    _mm_storeu_ps(p + 20, _mm256_extractf128_ps(c, 1));
+}
+
+// The kernels return how many floats / vectors / matrices they handled. The dispatchers finish the tail in scalar code
+RAYLIB64_AVX2_TARGET inline size_t ___add_floats_avx2_raymath64(const float *a, const float *b, float *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___scale_floats_avx2_raymath64(const float *a, float s, float *r, size_t n)
+{
+    auto vs = _mm256_set1_ps(s);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(r + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), vs));
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___lerp_floats_avx2_raymath64(const float *a, const float *b, float t, float *r, size_t n)
+{
+    auto vt = _mm256_set1_ps(t);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        auto va = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(r + i, _mm256_add_ps(va, _mm256_mul_ps(vt, _mm256_sub_ps(_mm256_loadu_ps(b + i), va))));
+    }
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___vector2_normalize_avx2_raymath64(const float *v, float *r, size_t count)
+{
+    auto zero = _mm256_setzero_ps();
+    auto one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        auto a = _mm256_loadu_ps(v + i * 2);
+        auto b = _mm256_loadu_ps(v + i * 2 + 8);
+        auto x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        auto y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        auto length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+        auto ilength = _mm256_and_ps(_mm256_cmp_ps(length, zero, _CMP_GT_OQ), _mm256_div_ps(one, length));
+        _mm256_storeu_ps(r + i * 2, _mm256_mul_ps(a, _mm256_unpacklo_ps(ilength, ilength)));
+        _mm256_storeu_ps(r + i * 2 + 8, _mm256_mul_ps(b, _mm256_unpackhi_ps(ilength, ilength)));
+    }
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___vector2_transform_avx2_raymath64(const float *v, const Matrix &m, float *r, size_t count)
+{
+    auto c0 = _mm256_setr_ps(m.m0, m.m1, m.m0, m.m1, m.m0, m.m1, m.m0, m.m1);
+    auto c1 = _mm256_setr_ps(m.m4, m.m5, m.m4, m.m5, m.m4, m.m5, m.m4, m.m5);
+    auto c3 = _mm256_setr_ps(m.m12, m.m13, m.m12, m.m13, m.m12, m.m13, m.m12, m.m13);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        auto a = _mm256_loadu_ps(v + i * 2);
+        auto x = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0));
+        auto y = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm256_storeu_ps(r + i * 2, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c0, x), _mm256_mul_ps(c1, y)), c3));
+    }
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___vector3_normalize_avx2_raymath64(const float *v, float *r, size_t count)
+{
+    auto zero = _mm256_setzero_ps();
+    auto one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x, y, z;
+        ___vector3_load8_raymath64(v + i * 3, x, y, z);
+        auto length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)));
+        auto mask = _mm256_cmp_ps(length, zero, _CMP_NEQ_UQ);
+        auto ilength = _mm256_or_ps(_mm256_and_ps(mask, _mm256_div_ps(one, length)), _mm256_andnot_ps(mask, one));
+        ___vector3_store8_raymath64(r + i * 3, _mm256_mul_ps(x, ilength), _mm256_mul_ps(y, ilength), _mm256_mul_ps(z, ilength));
+    }
+    return i;
+}
+
+// c holds the 3x4 coefficients as c[row * 4 + column], with column 3 being the translation
+template <bool translate>
+RAYLIB64_AVX2_TARGET inline size_t ___vector3_transform_avx2_raymath64(const float *v, const float *c, float *r, size_t count)
+{
+    __m256 k[12];
+    for (auto j = 0; j < 12; j++)
+        k[j] = _mm256_set1_ps(c[j]);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x, y, z;
+        ___vector3_load8_raymath64(v + i * 3, x, y, z);
+        auto rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(k[0], x), _mm256_mul_ps(k[1], y)), _mm256_mul_ps(k[2], z));
+        auto ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(k[4], x), _mm256_mul_ps(k[5], y)), _mm256_mul_ps(k[6], z));
+        auto rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(k[8], x), _mm256_mul_ps(k[9], y)), _mm256_mul_ps(k[10], z));
+        if (translate)
+        {
+            rx = _mm256_add_ps(rx, k[3]);
+            ry = _mm256_add_ps(ry, k[7]);
+            rz = _mm256_add_ps(rz, k[11]);
+        }
+        ___vector3_store8_raymath64(r + i * 3, rx, ry, rz);
+    }
+    return i;
+}
+
+RAYLIB64_AVX2_TARGET inline size_t ___matrix_multiply_avx2_raymath64(const Matrix *mats, const Matrix &right, Matrix *result, size_t count)
+{
+    // Memory row j of MatrixMultiply(left, right) is the sum over k of right's row j element k times left's row k. Rows 0-1 and 2-3 share a register
+    auto rp = &right.m0;
+    __m256 k01[4], k23[4];
+    for (auto k = 0; k < 4; k++)
+    {
+        k01[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(rp[k])), _mm_set1_ps(rp[4 + k]), 1);
+        k23[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(rp[8 + k])), _mm_set1_ps(rp[12 + k]), 1);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto lp = &mats[i].m0;
+        auto l0 = _mm256_broadcast_ps((const __m128 *)lp);
+        auto l1 = _mm256_broadcast_ps((const __m128 *)(lp + 4));
+        auto l2 = _mm256_broadcast_ps((const __m128 *)(lp + 8));
+        auto l3 = _mm256_broadcast_ps((const __m128 *)(lp + 12));
+        auto r01 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(l0, k01[0]), _mm256_mul_ps(l1, k01[1])), _mm256_mul_ps(l2, k01[2])), _mm256_mul_ps(l3, k01[3]));
+        auto r23 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(l0, k23[0]), _mm256_mul_ps(l1, k23[1])), _mm256_mul_ps(l2, k23[2])), _mm256_mul_ps(l3, k23[3]));
+        _mm256_storeu_ps(&result[i].m0, r01);
+        _mm256_storeu_ps(&result[i].m0 + 8, r23);
+    }
+    return count;
+}
+#endif
+
+#if defined(RAYLIB64_SSE2)
+inline size_t ___add_floats_sse2_raymath64(const float *a, const float *b, float *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    return i;
+}
+
+inline size_t ___scale_floats_sse2_raymath64(const float *a, float s, float *r, size_t n)
+{
+    auto vs = _mm_set1_ps(s);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(r + i, _mm_mul_ps(_mm_loadu_ps(a + i), vs));
+    return i;
+}
+
+inline size_t ___lerp_floats_sse2_raymath64(const float *a, const float *b, float t, float *r, size_t n)
+{
+    auto vt = _mm_set1_ps(t);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        auto va = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(r + i, _mm_add_ps(va, _mm_mul_ps(vt, _mm_sub_ps(_mm_loadu_ps(b + i), va))));
+    }
+    return i;
+}
+
+inline size_t ___vector2_normalize_sse2_raymath64(const float *v, float *r, size_t count)
+{
+    auto zero = _mm_setzero_ps();
+    auto one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        auto a = _mm_loadu_ps(v + i * 2);
+        auto b = _mm_loadu_ps(v + i * 2 + 4);
+        auto x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        auto y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        auto length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+        auto ilength = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_div_ps(one, length));
+        _mm_storeu_ps(r + i * 2, _mm_mul_ps(a, _mm_unpacklo_ps(ilength, ilength)));
+        _mm_storeu_ps(r + i * 2 + 4, _mm_mul_ps(b, _mm_unpackhi_ps(ilength, ilength)));
+    }
+    return i;
+}
+
+inline size_t ___vector2_transform_sse2_raymath64(const float *v, const Matrix &m, float *r, size_t count)
+{
+    auto c0 = _mm_setr_ps(m.m0, m.m1, m.m0, m.m1);
+    auto c1 = _mm_setr_ps(m.m4, m.m5, m.m4, m.m5);
+    auto c3 = _mm_setr_ps(m.m12, m.m13, m.m12, m.m13);
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        auto a = _mm_loadu_ps(v + i * 2);
+        auto x = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0));
+        auto y = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(r + i * 2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)), c3));
+    }
+    return i;
+}
+
+inline size_t ___vector3_normalize_sse2_raymath64(const float *v, float *r, size_t count)
+{
+    auto zero = _mm_setzero_ps();
+    auto one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z, a, b, c;
+        ___vector3_to_soa_raymath64(_mm_loadu_ps(v + i * 3), _mm_loadu_ps(v + i * 3 + 4), _mm_loadu_ps(v + i * 3 + 8), x, y, z);
+        auto length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        auto mask = _mm_cmpneq_ps(length, zero);
+        auto ilength = _mm_or_ps(_mm_and_ps(mask, _mm_div_ps(one, length)), _mm_andnot_ps(mask, one));
+        ___vector3_from_soa_raymath64(_mm_mul_ps(x, ilength), _mm_mul_ps(y, ilength), _mm_mul_ps(z, ilength), a, b, c);
+        _mm_storeu_ps(r + i * 3, a);
+        _mm_storeu_ps(r + i * 3 + 4, b);
+        _mm_storeu_ps(r + i * 3 + 8, c);
+    }
+    return i;
+}
+
+template <bool translate>
+inline size_t ___vector3_transform_sse2_raymath64(const float *v, const float *c, float *r, size_t count)
+{
+    __m128 k[12];
+    for (auto j = 0; j < 12; j++)
+        k[j] = _mm_set1_ps(c[j]);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z, a, b, d;
+        ___vector3_to_soa_raymath64(_mm_loadu_ps(v + i * 3), _mm_loadu_ps(v + i * 3 + 4), _mm_loadu_ps(v + i * 3 + 8), x, y, z);
+        auto rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(k[0], x), _mm_mul_ps(k[1], y)), _mm_mul_ps(k[2], z));
+        auto ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(k[4], x), _mm_mul_ps(k[5], y)), _mm_mul_ps(k[6], z));
+        auto rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(k[8], x), _mm_mul_ps(k[9], y)), _mm_mul_ps(k[10], z));
+        if (translate)
+        {
+            rx = _mm_add_ps(rx, k[3]);
+            ry = _mm_add_ps(ry, k[7]);
+            rz = _mm_add_ps(rz, k[11]);
+        }
+        ___vector3_from_soa_raymath64(rx, ry, rz, a, b, d);
+        _mm_storeu_ps(r + i * 3, a);
+        _mm_storeu_ps(r + i * 3 + 4, b);
+        _mm_storeu_ps(r + i * 3 + 8, d);
+    }
+    return i;
+}
+#endif
+
+inline void ___add_floats_raymath64(const float *a, const float *b, float *r, size_t n)
+{
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___add_floats_avx2_raymath64(a, b, r, n);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___add_floats_sse2_raymath64(a + i, b + i, r + i, n - i);
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] + b[i];
+}
+
+inline void ___scale_floats_raymath64(const float *a, float s, float *r, size_t n)
+{
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___scale_floats_avx2_raymath64(a, s, r, n);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___scale_floats_sse2_raymath64(a + i, s, r + i, n - i);
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] * s;
+}
+
+inline void ___lerp_floats_raymath64(const float *a, const float *b, float t, float *r, size_t n)
+{
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___lerp_floats_avx2_raymath64(a, b, t, r, n);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___lerp_floats_sse2_raymath64(a + i, b + i, t, r + i, n - i);
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] + t * (b[i] - a[i]);
+}
+
+inline void ___vector3_transform_raymath64(const Vector3 *v, const float *c, bool translate, Vector3 *r, size_t count)
+{
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = translate ? ___vector3_transform_avx2_raymath64<true>(&v->x, c, &r->x, count) : ___vector3_transform_avx2_raymath64<false>(&v->x, c, &r->x, count);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += translate ? ___vector3_transform_sse2_raymath64<true>(&v[i].x, c, &r[i].x, count - i) : ___vector3_transform_sse2_raymath64<false>(&v[i].x, c, &r[i].x, count - i);
+#endif
+    for (; i < count; i++)
+    {
+        auto p = v[i];
+        r[i].x = c[0] * p.x + c[1] * p.y + c[2] * p.z;
+        r[i].y = c[4] * p.x + c[5] * p.y + c[6] * p.z;
+        r[i].z = c[8] * p.x + c[9] * p.y + c[10] * p.z;
+        if (translate)
+        {
+            r[i].x += c[3];
+            r[i].y += c[7];
+            r[i].z += c[11];
+        }
+    }
+}
+
+/// @brief result(i) = v1(i) + v2(i) for count elements. result may be the same array as an input
+inline void __Vector2AddArray(void *v1, void *v2, void *result, int32_t count)
+{
+    if (count > 0)
+        ___add_floats_raymath64((const float *)v1, (const float *)v2, (float *)result, size_t(count) * 2);
+}
+
+/// @brief result(i) = v(i) * scale for count elements
+inline void __Vector2ScaleArray(void *v, float scale, void *result, int32_t count)
+{
+    if (count > 0)
+        ___scale_floats_raymath64((const float *)v, scale, (float *)result, size_t(count) * 2);
+}
+
+/// @brief result(i) = Vector2Lerp(v1(i), v2(i), amount) for count elements
+inline void __Vector2LerpArray(void *v1, void *v2, float amount, void *result, int32_t count)
+{
+    if (count > 0)
+        ___lerp_floats_raymath64((const float *)v1, (const float *)v2, amount, (float *)result, size_t(count) * 2);
+}
+
+/// @brief result(i) = Vector2Normalize(v(i)) for count elements
+inline void __Vector2NormalizeArray(void *v, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto src = (const Vector2 *)v;
+    auto dst = (Vector2 *)result;
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___vector2_normalize_avx2_raymath64(&src->x, &dst->x, count);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___vector2_normalize_sse2_raymath64(&src[i].x, &dst[i].x, count - i);
+#endif
+    for (; i < size_t(count); i++)
+        dst[i] = Vector2Normalize(src[i]);
+}
+
+/// @brief result(i) = Vector2Transform(v(i), mat) for count elements
+inline void __Vector2TransformArray(void *v, void *mat, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto src = (const Vector2 *)v;
+    auto dst = (Vector2 *)result;
+    auto m = *(const Matrix *)mat;
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___vector2_transform_avx2_raymath64(&src->x, m, &dst->x, count);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___vector2_transform_sse2_raymath64(&src[i].x, m, &dst[i].x, count - i);
+#endif
+    for (; i < size_t(count); i++)
+        dst[i] = Vector2Transform(src[i], m);
+}
+
+/// @brief result(i) = v1(i) + v2(i) for count elements. result may be the same array as an input
+inline void __Vector3AddArray(void *v1, void *v2, void *result, int32_t count)
+{
+    if (count > 0)
+        ___add_floats_raymath64((const float *)v1, (const float *)v2, (float *)result, size_t(count) * 3);
+}
+
+/// @brief result(i) = v(i) * scalar for count elements
+inline void __Vector3ScaleArray(void *v, float scalar, void *result, int32_t count)
+{
+    if (count > 0)
+        ___scale_floats_raymath64((const float *)v, scalar, (float *)result, size_t(count) * 3);
+}
+
+/// @brief result(i) = Vector3Lerp(v1(i), v2(i), amount) for count elements
+inline void __Vector3LerpArray(void *v1, void *v2, float amount, void *result, int32_t count)
+{
+    if (count > 0)
+        ___lerp_floats_raymath64((const float *)v1, (const float *)v2, amount, (float *)result, size_t(count) * 3);
+}
+
+/// @brief result(i) = Vector3Normalize(v(i)) for count elements
+inline void __Vector3NormalizeArray(void *v, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto src = (const Vector3 *)v;
+    auto dst = (Vector3 *)result;
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___vector3_normalize_avx2_raymath64(&src->x, &dst->x, count);
+#endif
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+        i += ___vector3_normalize_sse2_raymath64(&src[i].x, &dst[i].x, count - i);
+#endif
+    for (; i < size_t(count); i++)
+        dst[i] = Vector3Normalize(src[i]);
+}
+
+/// @brief result(i) = Vector3Transform(v(i), mat) for count elements
+inline void __Vector3TransformArray(void *v, void *mat, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto m = (const Matrix *)mat;
+    const float c[12] = {m->m0, m->m4, m->m8, m->m12, m->m1, m->m5, m->m9, m->m13, m->m2, m->m6, m->m10, m->m14};
+
+    ___vector3_transform_raymath64((const Vector3 *)v, c, true, (Vector3 *)result, count);
+}
+
+/// @brief result(i) = Vector3RotateByQuaternion(v(i), q) for count elements
+inline void __Vector3RotateByQuaternionArray(void *v, void *q, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    // Same coefficients as Vector3RotateByQuaternion(), computed once for the whole array
+    auto p = *(const Quaternion *)q;
+    const float c[12] = {p.x * p.x + p.w * p.w - p.y * p.y - p.z * p.z, 2 * p.x * p.y - 2 * p.w * p.z, 2 * p.x * p.z + 2 * p.w * p.y, 0.0f,
+                         2 * p.w * p.z + 2 * p.x * p.y, p.w * p.w - p.x * p.x + p.y * p.y - p.z * p.z, -2 * p.w * p.x + 2 * p.y * p.z, 0.0f,
+                         -2 * p.w * p.y + 2 * p.x * p.z, 2 * p.w * p.x + 2 * p.y * p.z, p.w * p.w - p.x * p.x - p.y * p.y + p.z * p.z, 0.0f};
+
+    ___vector3_transform_raymath64((const Vector3 *)v, c, false, (Vector3 *)result, count);
+}
+
+/// @brief result(i) = MatrixMultiply(mats(i), mat) for count elements. result may be the same array as mats
+inline void __MatrixMultiplyArray(void *mats, void *mat, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto src = (const Matrix *)mats;
+    auto dst = (Matrix *)result;
+    auto right = *(const Matrix *)mat;
+    size_t i = 0;
+#if defined(RAYLIB64_AVX2)
+    if (___simd_level_raymath64() >= 2)
+        i = ___matrix_multiply_avx2_raymath64(src, right, dst, count);
+#endif
+    // No SSE2 kernel here: compilers already vectorize the scalar MatrixMultiply() about as well
+    for (; i < size_t(count); i++)
+        dst[i] = MatrixMultiply(src[i], right);
+}
+
+#if defined(RAYLIB64_SSE2)
+// MatrixInvert() for 4 matrices at once. Each register holds one field of the 4 matrices and the arithmetic is the same as raymath's, so results match it exactly
+inline void ___matrix_invert4_sse2_raymath64(const Matrix *mats, Matrix *result)
+{
+    __m128 f[16]; // f[memory position], m_n is at position (n % 4) * 4 + n / 4
+
+    for (auto b = 0; b < 4; b++)
+    {
+        auto r0 = _mm_loadu_ps(&mats[0].m0 + b * 4), r1 = _mm_loadu_ps(&mats[1].m0 + b * 4), r2 = _mm_loadu_ps(&mats[2].m0 + b * 4), r3 = _mm_loadu_ps(&mats[3].m0 + b * 4);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        f[b * 4] = r0, f[b * 4 + 1] = r1, f[b * 4 + 2] = r2, f[b * 4 + 3] = r3;
+    }
+
+#define RAYLIB64_M(n) f[((n) % 4) * 4 + (n) / 4]
+#define RAYLIB64_MUL(a, b) _mm_mul_ps(a, b)
+#define RAYLIB64_DIFF(a, b, c, d) _mm_sub_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d))
+    auto a00 = RAYLIB64_M(0), a01 = RAYLIB64_M(1), a02 = RAYLIB64_M(2), a03 = RAYLIB64_M(3);
+    auto a10 = RAYLIB64_M(4), a11 = RAYLIB64_M(5), a12 = RAYLIB64_M(6), a13 = RAYLIB64_M(7);
+    auto a20 = RAYLIB64_M(8), a21 = RAYLIB64_M(9), a22 = RAYLIB64_M(10), a23 = RAYLIB64_M(11);
+    auto a30 = RAYLIB64_M(12), a31 = RAYLIB64_M(13), a32 = RAYLIB64_M(14), a33 = RAYLIB64_M(15);
+
+    auto b00 = RAYLIB64_DIFF(a00, a11, a01, a10);
+    auto b01 = RAYLIB64_DIFF(a00, a12, a02, a10);
+    auto b02 = RAYLIB64_DIFF(a00, a13, a03, a10);
+    auto b03 = RAYLIB64_DIFF(a01, a12, a02, a11);
+    auto b04 = RAYLIB64_DIFF(a01, a13, a03, a11);
+    auto b05 = RAYLIB64_DIFF(a02, a13, a03, a12);
+    auto b06 = RAYLIB64_DIFF(a20, a31, a21, a30);
+    auto b07 = RAYLIB64_DIFF(a20, a32, a22, a30);
+    auto b08 = RAYLIB64_DIFF(a20, a33, a23, a30);
+    auto b09 = RAYLIB64_DIFF(a21, a32, a22, a31);
+    auto b10 = RAYLIB64_DIFF(a21, a33, a23, a31);
+    auto b11 = RAYLIB64_DIFF(a22, a33, a23, a32);
+
+    auto det = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_add_ps(RAYLIB64_DIFF(b00, b11, b01, b10), RAYLIB64_MUL(b02, b09)), RAYLIB64_MUL(b03, b08)), RAYLIB64_MUL(b04, b07)), RAYLIB64_MUL(b05, b06));
+    auto invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+    // -a * b + c * d is computed as c * d - a * b, which rounds the same
+    RAYLIB64_M(0) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a11, b11, a12, b10), RAYLIB64_MUL(a13, b09)), invDet);
+    RAYLIB64_M(1) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a02, b10, a01, b11), RAYLIB64_MUL(a03, b09)), invDet);
+    RAYLIB64_M(2) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a31, b05, a32, b04), RAYLIB64_MUL(a33, b03)), invDet);
+    RAYLIB64_M(3) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a22, b04, a21, b05), RAYLIB64_MUL(a23, b03)), invDet);
+    RAYLIB64_M(4) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a12, b08, a10, b11), RAYLIB64_MUL(a13, b07)), invDet);
+    RAYLIB64_M(5) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a00, b11, a02, b08), RAYLIB64_MUL(a03, b07)), invDet);
+    RAYLIB64_M(6) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a32, b02, a30, b05), RAYLIB64_MUL(a33, b01)), invDet);
+    RAYLIB64_M(7) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a20, b05, a22, b02), RAYLIB64_MUL(a23, b01)), invDet);
+    RAYLIB64_M(8) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a10, b10, a11, b08), RAYLIB64_MUL(a13, b06)), invDet);
+    RAYLIB64_M(9) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a01, b08, a00, b10), RAYLIB64_MUL(a03, b06)), invDet);
+    RAYLIB64_M(10) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a30, b04, a31, b02), RAYLIB64_MUL(a33, b00)), invDet);
+    RAYLIB64_M(11) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a21, b02, a20, b04), RAYLIB64_MUL(a23, b00)), invDet);
+    RAYLIB64_M(12) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a11, b07, a10, b09), RAYLIB64_MUL(a12, b06)), invDet);
+    RAYLIB64_M(13) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a00, b09, a01, b07), RAYLIB64_MUL(a02, b06)), invDet);
+    RAYLIB64_M(14) = _mm_mul_ps(_mm_sub_ps(RAYLIB64_DIFF(a31, b01, a30, b03), RAYLIB64_MUL(a32, b00)), invDet);
+    RAYLIB64_M(15) = _mm_mul_ps(_mm_add_ps(RAYLIB64_DIFF(a20, b03, a21, b01), RAYLIB64_MUL(a22, b00)), invDet);
+#undef RAYLIB64_DIFF
+#undef RAYLIB64_MUL
+#undef RAYLIB64_M
+
+    for (auto b = 0; b < 4; b++)
+    {
+        auto r0 = f[b * 4], r1 = f[b * 4 + 1], r2 = f[b * 4 + 2], r3 = f[b * 4 + 3];
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(&result[0].m0 + b * 4, r0);
+        _mm_storeu_ps(&result[1].m0 + b * 4, r1);
+        _mm_storeu_ps(&result[2].m0 + b * 4, r2);
+        _mm_storeu_ps(&result[3].m0 + b * 4, r3);
+    }
+}
+#endif
+
+/// @brief result(i) = MatrixInvert(mats(i)) for count elements. result may be the same array as mats
+inline void __MatrixInvertArray(void *mats, void *result, int32_t count)
+{
+    if (count <= 0)
+        return;
+
+    auto src = (const Matrix *)mats;
+    auto dst = (Matrix *)result;
+    size_t i = 0;
+#if defined(RAYLIB64_SSE2)
+    if (___simd_level_raymath64() >= 1)
+    {
+        for (; i + 4 <= size_t(count); i += 4)
+            ___matrix_invert4_sse2_raymath64(src + i, dst + i);
+    }
+#endif
+    for (; i < size_t(count); i++)
+        dst[i] = MatrixInvert(src[i]);
+}
+
+/// @brief Computes world matrices for a transform hierarchy in one pass. Each node's local transform is scale, then rotation, then translation
+/// (the same as MatrixMultiply(MatrixMultiply(MatrixMultiply(MatrixScale(s), QuaternionToMatrix(q)), MatrixTranslate(t)), parentWorld))
+/// @param translations Packed Vector3 array of local translations
+/// @param rotations Packed Quaternion array of local rotations
+/// @param scales Packed Vector3 array of local scales
+/// @param parents LONG array of parent indices. Parents must come before their children; -1 (or any index not below the node's own) marks a root
+/// @param dirty Optional _BYTE array (0 to update every node). Only nodes that are flagged, or whose parent was updated, are recomputed. The flags are cleared on return
+/// @param world Packed Matrix array that receives the world transforms
+/// @param count The number of nodes
+/// @return The number of nodes that were recomputed
+inline int32_t __UpdateTransformHierarchy(void *translations, void *rotations, void *scales, void *parents, uintptr_t dirty, void *world, int32_t count)
+{
+    auto t = (const Vector3 *)translations;
+    auto q = (const Quaternion *)rotations;
+    auto s = (const Vector3 *)scales;
+    auto parent = (const int32_t *)parents;
+    auto flags = (int8_t *)dirty;
+    auto w = (Matrix *)world;
+    int32_t updated = 0;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        auto p = parent[i];
+        auto isRoot = p < 0 || p >= i;
+
+        if (flags && !flags[i] && (isRoot || !flags[p]))
+            continue;
+
+        if (flags)
+            flags[i] = 1; // marks the subtree for the children; cleared below
+
+        // QuaternionToMatrix() with the scale folded into its columns. Multiplying by MatrixScale() and MatrixTranslate() only adds exact zeros
+        auto a2 = q[i].x * q[i].x, b2 = q[i].y * q[i].y, c2 = q[i].z * q[i].z;
+        auto ac = q[i].x * q[i].z, ab = q[i].x * q[i].y, bc = q[i].y * q[i].z;
+        auto ad = q[i].w * q[i].x, bd = q[i].w * q[i].y, cd = q[i].w * q[i].z;
+
+        Matrix local = {(1 - 2 * (b2 + c2)) * s[i].x, 2 * (ab - cd) * s[i].y, 2 * (ac + bd) * s[i].z, t[i].x,
+                        2 * (ab + cd) * s[i].x, (1 - 2 * (a2 + c2)) * s[i].y, 2 * (bc - ad) * s[i].z, t[i].y,
+                        2 * (ac - bd) * s[i].x, 2 * (bc + ad) * s[i].y, (1 - 2 * (a2 + b2)) * s[i].z, t[i].z,
+                        0.0f, 0.0f, 0.0f, 1.0f};
+
+        if (isRoot)
+        {
+            w[i] = local;
+        }
+        else
+        {
+#if defined(RAYLIB64_SSE2)
+            // Memory row j of MatrixMultiply(local, parentWorld) is the sum over k of the parent's row j element k times local's row k
+            auto l0 = _mm_loadu_ps(&local.m0), l1 = _mm_loadu_ps(&local.m1), l2 = _mm_loadu_ps(&local.m2), l3 = _mm_loadu_ps(&local.m3);
+            auto pw = &w[p].m0;
+            for (auto j = 0; j < 4; j++)
+            {
+                auto r = _mm_loadu_ps(pw + j * 4);
+                auto sum = _mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1))));
+                sum = _mm_add_ps(sum, _mm_mul_ps(l2, _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2))));
+                _mm_storeu_ps(&w[i].m0 + j * 4, _mm_add_ps(sum, _mm_mul_ps(l3, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)))));
+            }
+#else
+            w[i] = MatrixMultiply(local, w[p]);
+#endif
+        }
+
+        updated++;
+    }
+
+    if (flags && count > 0)
+        std::memset(flags, 0, count);
+
+    return updated;
+}